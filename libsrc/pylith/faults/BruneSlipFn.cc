@@ -167,6 +167,7 @@ pylith::faults::BruneSlipFn::initialize(const topology::Mesh& faultMesh,
   PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
   _slipVertex.resize(spaceDim);
+  _resetActiveTimes();
   for (PetscInt v = vStart; v < vEnd; ++v) {
     if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
       continue;
@@ -229,6 +230,10 @@ pylith::faults::BruneSlipFn::initialize(const topology::Mesh& faultMesh,
     }
     slipTimeArray[stoff] = _slipTimeVertex;
     riseTimeArray[rtoff] = _riseTimeVertex;
+
+    // Slip approaches the final slip asymptotically; after 45 time
+    // constants the difference is below machine precision.
+    _updateActiveTimes(_slipTimeVertex, _slipTimeVertex + 45.0*0.21081916*_riseTimeVertex);
   } // for
 
   // Close databases
@@ -22,11 +22,39 @@
 
 #include "TopologyOps.hh" // USES TopologyOps
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "journal/info.h" // USES journal::info_t
 
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _CohesiveTopology {
+
+      /** Write memory usage at the end of a phase of createBatch().
+       *
+       * @param info Journal for output.
+       * @param phase Name of phase.
+       */
+      void logMemoryUsage(journal::info_t& info,
+			  const char* phase) {
+	PetscLogDouble memory = 0.0;
+	PetscErrorCode err = PetscMemoryGetCurrentUsage(&memory);PYLITH_CHECK_ERROR(err);
+	info << journal::at(__HERE__)
+	     << "Memory usage after " << phase << ": " << memory/(1024.0*1024.0) << " MB." << journal::endl;
+      } // logMemoryUsage
+
+    } // _CohesiveTopology
+  } // faults
+} // pylith
+
 // ----------------------------------------------------------------------
 void
 pylith::faults::CohesiveTopology::createFault(topology::Mesh* faultMesh,
@@ -106,7 +134,7 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
   PetscDM        sdm = NULL;
   PetscDM        dm  = mesh->dmMesh();assert(dm);
   PetscDMLabel   subpointMap = NULL, label = NULL, mlabel = NULL;
-  PetscInt       dim, cMax, cEnd, numCohesiveCellsOld;
+  PetscInt       cMax, cEnd, numCohesiveCellsOld;
   PetscErrorCode err;
 
   // Have to remember the old number of cohesive cells
@@ -118,6 +146,225 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
   err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
   err = DMLabelClearStratum(label, mesh->dimension());PYLITH_CHECK_ERROR(err);
   // Fix over-aggressive completion of boundary label
+  _fixFaultBoundaryLabel(dm, label, faultBdLabel);
+  // Completes the set of cells scheduled to be replaced
+  err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
+  err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+
+  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
+  if (mlabel) {
+    err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    assert(cEnd > cMax + numCohesiveCellsOld);
+    for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
+      PetscInt onBd;
+
+      /* Eliminate hybrid cells on the boundary of the split from cohesive label,
+         they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
+      err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
+      //if (onBd == dim) continue;
+      err = DMLabelSetValue(mlabel, cell, materialId);PYLITH_CHECK_ERROR(err);
+    }
+  }
+  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(sdm);
+} // createInterpolated
+
+// ----------------------------------------------------------------------
+// Create cohesive cells for several faults in an interpolated mesh
+// with a single split of the mesh.
+bool
+pylith::faults::CohesiveTopology::createBatch(topology::Mesh* mesh,
+					      const topology::Mesh* const* faultMeshes,
+					      PetscDMLabel* faultBdLabels,
+					      const int* materialIds,
+					      const int numFaults)
+{ // createBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(numFaults > 0);
+  assert(faultMeshes);
+  assert(faultBdLabels);
+  assert(materialIds);
+
+  utils::EventLogger logger;
+  logger.className("CohesiveTopology");
+  logger.initialize();
+  const int labelEvent = logger.registerEvent("CoTo label");
+  const int splitEvent = logger.registerEvent("CoTo split");
+  const int materialEvent = logger.registerEvent("CoTo material");
+
+  journal::info_t info("cohesivetopology");
+  const bool logMemory = 0 == mesh->commRank() && info.state();
+  if (logMemory) {
+    _CohesiveTopology::logMemoryUsage(info, "creating fault meshes");
+  } // if
+
+  PetscDM dm = mesh->dmMesh();assert(dm);
+  PetscDM sdm = NULL;
+  PetscInt depth = 0, cMax = 0, cEnd = 0, numCohesiveCellsOld = 0;
+  PetscErrorCode err;
+
+  // Have to remember the old number of cohesive cells
+  err = DMPlexGetHeightStratum(dm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  numCohesiveCellsOld = cEnd - (cMax < 0 ? cEnd : cMax);
+  err = DMPlexGetDepth(dm, &depth);PYLITH_CHECK_ERROR(err);
+
+  // Complete the label of points to split for each fault and merge
+  // them into a single label. If faults share any points, give up
+  // without changing the mesh, so the faults can be inserted one at
+  // a time.
+  logger.eventBegin(labelEvent);
+  PetscDMLabel label = NULL;
+  err = DMLabelCreate(PETSC_COMM_SELF, "cohesive", &label);PYLITH_CHECK_ERROR(err);
+  std::vector<int> faceFault; // Fault associated with each face to split (indexed by point).
+  PetscInt fStart = 0, fEnd = 0;
+  err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
+  faceFault.resize(fEnd-fStart, -1);
+  for (int iFault=0; iFault < numFaults; ++iFault) {
+    assert(faultMeshes[iFault]);
+    PetscDMLabel subpointMap = NULL, faultLabel = NULL;
+    err = DMPlexGetSubpointMap(faultMeshes[iFault]->dmMesh(), &subpointMap);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDuplicate(subpointMap, &faultLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelClearStratum(faultLabel, mesh->dimension());PYLITH_CHECK_ERROR(err);
+    _fixFaultBoundaryLabel(dm, faultLabel, faultBdLabels[iFault]);
+    err = DMPlexLabelCohesiveComplete(dm, faultLabel, faultBdLabels[iFault], PETSC_FALSE, faultMeshes[iFault]->dmMesh());PYLITH_CHECK_ERROR(err);
+
+    PetscIS valueIS = NULL;
+    const PetscInt* values = NULL;
+    PetscInt numValues = 0;
+    err = DMLabelGetValueIS(faultLabel, &valueIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valueIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valueIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+      const PetscInt value = values[iValue];
+      PetscIS pointIS = NULL;
+      const PetscInt* points = NULL;
+      PetscInt numPoints = 0;
+      err = DMLabelGetStratumIS(faultLabel, value, &pointIS);PYLITH_CHECK_ERROR(err);
+      err = ISGetLocalSize(pointIS, &numPoints);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+      for (PetscInt iPoint=0; iPoint < numPoints; ++iPoint) {
+	const PetscInt point = points[iPoint];
+	if (point < 0) {
+	  // Hybrid cells on the boundary of the split are marked with
+	  // -(cell number), which aliases points in the old mesh.
+	  err = DMLabelSetValue(label, point, value);PYLITH_CHECK_ERROR(err);
+	  continue;
+	} // if
+	PetscInt valueOld = 0;
+	err = DMLabelGetValue(label, point, &valueOld);PYLITH_CHECK_ERROR(err);
+	if (-1 != valueOld) {
+	  if (0 == mesh->commRank()) {
+	    info << journal::at(__HERE__)
+		 << "Point " << point << " is associated with more than one fault, so cohesive cells "
+		 << "cannot be created for all faults in a single pass." << journal::endl;
+	  } // if
+	  err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+	  err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+	  err = ISRestoreIndices(valueIS, &values);PYLITH_CHECK_ERROR(err);
+	  err = ISDestroy(&valueIS);PYLITH_CHECK_ERROR(err);
+	  err = DMLabelDestroy(&faultLabel);PYLITH_CHECK_ERROR(err);
+	  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+	  logger.eventEnd(labelEvent);
+	  PYLITH_METHOD_RETURN(false);
+	} // if
+	err = DMLabelSetValue(label, point, value);PYLITH_CHECK_ERROR(err);
+	if (value == depth-1) {
+	  assert(point >= fStart && point < fEnd);
+	  faceFault[point-fStart] = iFault;
+	} // if
+      } // for
+      err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valueIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valueIS);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&faultLabel);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Material id for each new cohesive cell. DMPlex creates the
+  // cohesive cells in the order of the faces in the label stratum.
+  std::vector<int> cellMaterialIds;
+  PetscIS faceIS = NULL;
+  err = DMLabelGetStratumIS(label, depth-1, &faceIS);PYLITH_CHECK_ERROR(err);
+  if (faceIS) {
+    const PetscInt* faces = NULL;
+    PetscInt numFaces = 0;
+    err = ISGetLocalSize(faceIS, &numFaces);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(faceIS, &faces);PYLITH_CHECK_ERROR(err);
+    cellMaterialIds.resize(numFaces);
+    for (PetscInt iFace=0; iFace < numFaces; ++iFace) {
+      const int iFault = faceFault[faces[iFace]-fStart];assert(iFault >= 0);
+      cellMaterialIds[iFace] = materialIds[iFault];
+    } // for
+    err = ISRestoreIndices(faceIS, &faces);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&faceIS);PYLITH_CHECK_ERROR(err);
+  } // if
+  logger.eventEnd(labelEvent);
+  if (logMemory) {
+    _CohesiveTopology::logMemoryUsage(info, "labeling points to split");
+  } // if
+
+  // Split the mesh along all of the faults.
+  logger.eventBegin(splitEvent);
+  err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+  logger.eventEnd(splitEvent);
+  if (logMemory) {
+    _CohesiveTopology::logMemoryUsage(info, "splitting mesh");
+  } // if
+
+  logger.eventBegin(materialEvent);
+  PetscDMLabel mlabel = NULL;
+  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
+  if (mlabel) {
+    err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    if (cEnd - numCohesiveCellsOld - cMax != PetscInt(cellMaterialIds.size())) {
+      std::ostringstream msg;
+      msg << "Internal error while creating cohesive cells. Expected " << cellMaterialIds.size()
+	  << " new cohesive cells but found " << cEnd - numCohesiveCellsOld - cMax << ".";
+      throw std::logic_error(msg.str());
+    } // if
+    for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
+      err = DMLabelSetValue(mlabel, cell, cellMaterialIds[cell-cMax]);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+  logger.eventEnd(materialEvent);
+
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(sdm);
+  if (logMemory) {
+    _CohesiveTopology::logMemoryUsage(info, "setting material ids");
+  } // if
+
+  PYLITH_METHOD_RETURN(true);
+} // createBatch
+
+// ----------------------------------------------------------------------
+// Remove faces and cross edges on the buried edges of a fault that
+// were added by over-aggressive completion of the boundary label.
+void
+pylith::faults::CohesiveTopology::_fixFaultBoundaryLabel(PetscDM dm,
+							 PetscDMLabel label,
+							 PetscDMLabel faultBdLabel)
+{ // _fixFaultBoundaryLabel
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+  assert(label);
+  PetscInt dim = 0;
+  PetscErrorCode err;
+
   err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
   if (faultBdLabel && (dim > 2)) {
     PetscIS         bdIS;
@@ -184,32 +431,9 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
     err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
     err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
   }
-  // Completes the set of cells scheduled to be replaced
-  err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
-  err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
-
-  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
-  if (mlabel) {
-    err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
-    assert(cEnd > cMax + numCohesiveCellsOld);
-    for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
-      PetscInt onBd;
-
-      /* Eliminate hybrid cells on the boundary of the split from cohesive label,
-         they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
-      err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
-      //if (onBd == dim) continue;
-      err = DMLabelSetValue(mlabel, cell, materialId);PYLITH_CHECK_ERROR(err);
-    }
-  }
-  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
 
-  PetscReal lengthScale = 1.0;
-  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
-  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
-  mesh->dmMesh(sdm);
-} // createInterpolated
+  PYLITH_METHOD_END;
+} // _fixFaultBoundaryLabel
 
 // ----------------------------------------------------------------------
 // Form a parallel fault mesh using the cohesive cell information
@@ -78,6 +78,32 @@ public :
               int& firstFaultCell,
               const bool constraintCell = false);
 
+  /** Create cohesive cells for several faults in an interpolated mesh
+   * with a single split of the mesh.
+   *
+   * The points to split are labeled for each fault and merged into a
+   * single label, so the mesh is rebuilt once rather than once per
+   * fault. If any point belongs to more than one fault, the mesh is
+   * left unchanged and the faults must be inserted one at a time.
+   * Logging events report the time spent labeling, splitting, and
+   * setting material ids; the "cohesivetopology" journal reports the
+   * memory usage at the end of each of these phases.
+   *
+   * @param mesh Finite-element mesh
+   * @param faultMeshes Finite-element meshes of faults.
+   * @param faultBdLabels Labels for buried edges of faults (NULL if none).
+   * @param materialIds Material ids for cohesive cells of faults.
+   * @param numFaults Number of faults.
+   * @returns True if cohesive cells were created, false if faults
+   *   share points.
+   */
+  static
+  bool createBatch(topology::Mesh* mesh,
+		   const topology::Mesh* const* faultMeshes,
+		   PetscDMLabel* faultBdLabels,
+		   const int* materialIds,
+		   const int numFaults);
+
   /** Create (distributed) fault mesh from cohesive cells.
    *
    * @param faultMesh Finite-element mesh of fault (output).
@@ -94,6 +120,21 @@ public :
 			   const char* label,
 			   const bool constraintCell =false);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Remove faces and cross edges on the buried edges of a fault that
+   * were added by over-aggressive completion of the boundary label.
+   *
+   * @param dm PETSc DM of mesh.
+   * @param label Label of points on fault.
+   * @param faultBdLabel Label for buried edges of fault (NULL if none).
+   */
+  static
+  void _fixFaultBoundaryLabel(PetscDM dm,
+			      PetscDMLabel label,
+			      PetscDMLabel faultBdLabel);
+
 }; // class CohesiveTopology
 
 #endif // pylith_faults_cohesivetopology_hh
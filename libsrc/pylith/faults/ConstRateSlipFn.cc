@@ -27,6 +27,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -152,6 +153,7 @@ pylith::faults::ConstRateSlipFn::initialize(const topology::Mesh& faultMesh,
   PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
   _slipRateVertex.resize(spaceDim);
+  _resetActiveTimes();
   for(PetscInt v = vStart; v < vEnd; ++v) {
     if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
       continue;
@@ -199,6 +201,9 @@ pylith::faults::ConstRateSlipFn::initialize(const topology::Mesh& faultMesh,
       slipRateArray[sroff+d] = _slipRateVertex[d];
     } // for
     slipTimeArray[stoff] = _slipTimeVertex;
+
+    // Slip grows without bound.
+    _updateActiveTimes(_slipTimeVertex, pylith::PYLITH_MAXSCALAR);
   } // for
 
   // Close databases
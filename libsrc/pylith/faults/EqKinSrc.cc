@@ -127,5 +127,24 @@ pylith::faults::EqKinSrc::slipTime(void) const
   PYLITH_METHOD_RETURN(_slipfn->slipTime());
 } // slipTime
 
+// ----------------------------------------------------------------------
+// Get earliest time when slip begins at any local point.
+PylithScalar
+pylith::faults::EqKinSrc::startTime(void) const
+{ // startTime
+  assert(_slipfn);
+  return _slipfn->startTime();
+} // startTime
+
+// ----------------------------------------------------------------------
+// Get time after which slip at all local points is equal to the final
+// slip.
+PylithScalar
+pylith::faults::EqKinSrc::completionTime(void) const
+{ // completionTime
+  assert(_slipfn);
+  return _slipfn->completionTime();
+} // completionTime
+
 
 // End of file 
@@ -102,6 +102,19 @@ public :
    */
   const topology::Field& slipTime(void) const;
 
+  /** Get earliest time when slip begins at any local point.
+   *
+   * @returns Time when slip begins.
+   */
+  PylithScalar startTime(void) const;
+
+  /** Get time after which slip at all local points is equal to the
+   * final slip.
+   *
+   * @returns Time when slip is complete.
+   */
+  PylithScalar completionTime(void) const;
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -28,6 +28,7 @@
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -119,42 +120,9 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   try {
     topology::Mesh faultMesh;
   
-    // Get group of vertices associated with fault
-    PetscDM dmMesh = mesh->dmMesh();assert(dmMesh);
-    
     if (!_useFaultMesh) {
-      const char* charlabel = label();
-
-      PetscDMLabel   groupField;
-      PetscBool      hasLabel;
-      PetscInt       depth, gdepth, dim;
-      PetscMPIInt    rank;
-      PetscErrorCode err;
-      // We do not have labels on all ranks until after distribution
-      err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
-      err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
-      if (!hasLabel && !rank) {
-        std::ostringstream msg;
-        msg << "Mesh missing group of vertices '" << label()
-            << "' for fault interface condition.";
-        throw std::runtime_error(msg.str());
-      } // if
-      err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
-      err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
-      err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh->comm());PYLITH_CHECK_ERROR(err);
-      err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
-      CohesiveTopology::createFault(&faultMesh, *mesh, groupField);
       PetscDMLabel faultBdLabel = NULL;
-
-      // We do not have labels on all ranks until after distribution
-      if (strlen(edge()) > 0 && !rank) {
-	err = DMGetLabel(dmMesh, edge(), &faultBdLabel);PYLITH_CHECK_ERROR(err);
-	if (!faultBdLabel) {
-	  std::ostringstream msg;
-	  msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
-	  throw std::runtime_error(msg.str());
-	} // if
-      } // if
+      _createFaultMesh(&faultMesh, &faultBdLabel, *mesh);
       CohesiveTopology::create(mesh, faultMesh, faultBdLabel, id(), *firstFaultVertex, *firstLagrangeVertex, *firstFaultCell, useLagrangeConstraints());
     } else {
       assert(3 == mesh->dimension());
@@ -176,5 +144,126 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   PYLITH_METHOD_END;
 } // adjustTopology
 
+// ----------------------------------------------------------------------
+// Adjust mesh topology for several faults with a single split of the
+// mesh.
+bool
+pylith::faults::FaultCohesive::adjustTopologyBatch(topology::Mesh* const mesh,
+						   FaultCohesive** faults,
+						   const int numFaults)
+{ // adjustTopologyBatch
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(!numFaults || faults);
+
+  if (!numFaults) {
+    PYLITH_METHOD_RETURN(true);
+  } // if
+
+  bool created = false;
+  std::vector<topology::Mesh*> faultMeshes(numFaults);
+  std::vector<PetscDMLabel> faultBdLabels(numFaults);
+  std::vector<int> materialIds(numFaults);
+  for (int i=0; i < numFaults; ++i) {
+    faultMeshes[i] = new topology::Mesh;
+  } // for
+
+  try {
+    for (int i=0; i < numFaults; ++i) {
+      FaultCohesive* fault = faults[i];assert(fault);
+      assert(std::string("") != fault->label());
+      if (fault->_useFaultMesh) {
+	assert(3 == mesh->dimension());
+	throw std::logic_error("Support for UCD fault files no longer implemented."); 
+      } // if
+      try {
+	fault->_createFaultMesh(faultMeshes[i], &faultBdLabels[i], *mesh);
+      } catch (const std::exception& err) {
+	std::ostringstream msg;
+	msg << "Error occurred while creating fault mesh for fault '" << fault->label() << "'.\n"
+	    << err.what();
+	throw std::runtime_error(msg.str());
+      } // try/catch
+      materialIds[i] = fault->id();
+    } // for
+
+    created = CohesiveTopology::createBatch(mesh, &faultMeshes[0], &faultBdLabels[0], &materialIds[0], numFaults);
+
+    // Check consistency of mesh.
+    if (created) {
+      topology::MeshOps::checkTopology(*mesh);
+      for (int i=0; i < numFaults; ++i) {
+	topology::MeshOps::checkTopology(*faultMeshes[i]);
+      } // for
+    } // if
+
+  } catch (const std::exception& err) {
+    for (int i=0; i < numFaults; ++i) {
+      delete faultMeshes[i]; faultMeshes[i] = 0;
+    } // for
+    std::ostringstream msg;
+    msg << "Error occurred while adjusting topology to create cohesive cells for " << numFaults << " faults.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  for (int i=0; i < numFaults; ++i) {
+    delete faultMeshes[i]; faultMeshes[i] = 0;
+  } // for
+
+  PYLITH_METHOD_RETURN(created);
+} // adjustTopologyBatch
+
+// ----------------------------------------------------------------------
+// Create fault mesh from group of vertices associated with fault.
+void
+pylith::faults::FaultCohesive::_createFaultMesh(topology::Mesh* faultMesh,
+						PetscDMLabel* faultBdLabel,
+						const topology::Mesh& mesh) const
+{ // _createFaultMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(faultMesh);
+  assert(faultBdLabel);
+
+  // Get group of vertices associated with fault
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  const char* charlabel = label();
+
+  PetscDMLabel   groupField;
+  PetscBool      hasLabel;
+  PetscInt       depth, gdepth, dim;
+  PetscMPIInt    rank;
+  PetscErrorCode err;
+  // We do not have labels on all ranks until after distribution
+  err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
+  err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
+  if (!hasLabel && !rank) {
+    std::ostringstream msg;
+    msg << "Mesh missing group of vertices '" << label()
+	<< "' for fault interface condition.";
+    throw std::runtime_error(msg.str());
+  } // if
+  err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+  err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
+  CohesiveTopology::createFault(faultMesh, mesh, groupField);
+
+  *faultBdLabel = NULL;
+  // We do not have labels on all ranks until after distribution
+  if (strlen(edge()) > 0 && !rank) {
+    err = DMGetLabel(dmMesh, edge(), faultBdLabel);PYLITH_CHECK_ERROR(err);
+    if (!*faultBdLabel) {
+      std::ostringstream msg;
+      msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // _createFaultMesh
+
 
 // End of file 
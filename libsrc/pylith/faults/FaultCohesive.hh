@@ -89,6 +89,25 @@ public :
                       int *firstLagrangeVertex,
                       int *firstFaultCell);
 
+  /** Adjust mesh topology for several faults with a single split of
+   * the mesh.
+   *
+   * The mesh is rebuilt once for all of the faults instead of once
+   * per fault. If the faults share any points, the mesh is left
+   * unchanged and the faults must be inserted one at a time using
+   * adjustTopology().
+   *
+   * @param mesh PETSc mesh.
+   * @param faults Array of faults.
+   * @param numFaults Number of faults.
+   * @returns True if cohesive cells were created, false if faults
+   *   share points.
+   */
+  static
+  bool adjustTopologyBatch(topology::Mesh* const mesh,
+			   FaultCohesive** faults,
+			   const int numFaults);
+
   /** Cohesive cells use Lagrange multiplier constraints?
    *
    * @returns True if implementation using Lagrange multiplier
@@ -113,6 +132,19 @@ protected :
   /// Map label of cohesive cell to label of fault cell.
   std::map<PetscInt, PetscInt> _cohesiveToFault;
 
+// PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create fault mesh from group of vertices associated with fault.
+   *
+   * @param faultMesh Finite-element mesh of fault (output).
+   * @param faultBdLabel Label for buried edges of fault (output).
+   * @param mesh Finite-element mesh of domain.
+   */
+  void _createFaultMesh(topology::Mesh* faultMesh,
+			PetscDMLabel* faultBdLabel,
+			const topology::Mesh& mesh) const;
+
 // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -39,14 +39,14 @@
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
-#include "pylith/utils/constdefs.h" // USES PYLITH_MAXFLOAT
-#include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cmath> // USES pow(), sqrt()
+#include <algorithm> // USES std::min()
 #include <strings.h> // USES strcasecmp()
 #include <cstring> // USES strlen()
 #include <cstdlib> // USES atoi()
@@ -59,6 +59,8 @@
 
 //#define DETAILED_EVENT_LOGGING
 
+#include "pylith/utils/threaddefs.h" // USES THREADED_VERTEX_LOOPS
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
@@ -67,9 +69,18 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _tractPerturbation(0),
     _friction(0),
     _jacobian(0),
+    _jacobianPositive(0),
     _ksp(0),
-    _openFreeSurf(true)
+    _kspPositive(0),
+    _reuseSensitivityFactorization(false),
+    _openFreeSurf(true),
+    _activeSetMargin(1.0),
+    _activeSetTime(-PYLITH_MAXSCALAR),
+    _ruptureMetrics(false),
+    _ruptureSlipRateThreshold(0.0)
 { // constructor
+    _jacobianDomainMat[0] = _jacobianDomainMat[1] = 0;
+    _jacobianDomainState[0] = _jacobianDomainState[1] = 0;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -91,7 +102,10 @@ void pylith::faults::FaultCohesiveDyn::deallocate(void)
     _friction = 0; // :TODO: Use shared pointer
 
     delete _jacobian; _jacobian = 0;
+    delete _jacobianPositive; _jacobianPositive = 0;
     PetscErrorCode err = KSPDestroy(&_ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPDestroy(&_kspPositive); PYLITH_CHECK_ERROR(err);
+    _jacobianDomainMat[0] = _jacobianDomainMat[1] = 0;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -151,6 +165,53 @@ pylith::faults::FaultCohesiveDyn::openFreeSurf(const bool value)
     _openFreeSurf = value;
 } // openFreeSurf
 
+// ----------------------------------------------------------------------
+// Set flag for reusing factorization of sensitivity problem.
+void
+pylith::faults::FaultCohesiveDyn::reuseSensitivityFactorization(const bool value)
+{ // reuseSensitivityFactorization
+    _reuseSensitivityFactorization = value;
+} // reuseSensitivityFactorization
+
+// ----------------------------------------------------------------------
+// Set margin below friction strength for treating locked vertices as
+// inactive.
+void
+pylith::faults::FaultCohesiveDyn::activeSetMargin(const PylithScalar value)
+{ // activeSetMargin
+    if (value < 0.0 || value > 1.0) {
+        std::ostringstream msg;
+        msg << "Margin (" << value << ") below friction strength for active set of "
+        "fault " << label() << " must be in the range [0, 1].";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _activeSetMargin = value;
+} // activeSetMargin
+
+// ----------------------------------------------------------------------
+// Set flag for accumulating rupture metrics.
+void
+pylith::faults::FaultCohesiveDyn::ruptureMetrics(const bool value)
+{ // ruptureMetrics
+    _ruptureMetrics = value;
+} // ruptureMetrics
+
+// ----------------------------------------------------------------------
+// Set threshold for slip rate defining the rupture time.
+void
+pylith::faults::FaultCohesiveDyn::ruptureSlipRateThreshold(const PylithScalar value)
+{ // ruptureSlipRateThreshold
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Slip rate threshold (" << value << ") for rupture time of "
+        "fault " << label() << " must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _ruptureSlipRateThreshold = value;
+} // ruptureSlipRateThreshold
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -178,6 +239,26 @@ pylith::faults::FaultCohesiveDyn::initialize(const topology::Mesh& mesh,
     _friction->normalizer(*_normalizer);
     _friction->initialize(*_faultMesh, _quadrature);
 
+    // Friction criterion must be evaluated at all vertices until they
+    // have been classified.
+    const int numVertices = _cohesiveVertices.size();
+    _activeSetStatus.resize(numVertices);
+    _activeSetStatus = int(VERTEX_UNKNOWN);
+    _activeSetStrength.resize(numVertices);
+    _activeSetStrength = 0.0;
+    _activeSetNormal.resize(numVertices);
+    _activeSetNormal = 0.0;
+    _activeSetTime = -PYLITH_MAXSCALAR;
+
+    if (_ruptureMetrics) {
+        _ruptureTime.resize(numVertices);
+        _ruptureTime = PYLITH_MAXSCALAR;
+        _peakSlipRate.resize(numVertices);
+        _peakSlipRate = 0.0;
+        _peakSlipRateTime.resize(numVertices);
+        _peakSlipRateTime = PYLITH_MAXSCALAR;
+    } // if
+
     const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();
     assert(cs);
 
@@ -189,6 +270,13 @@ pylith::faults::FaultCohesiveDyn::initialize(const topology::Mesh& mesh,
     velRel.vectorFieldType(topology::FieldBase::VECTOR);
     velRel.scale(_normalizer->lengthScale() / _normalizer->timeScale());
 
+    // Report cost of sensitivity problem separately from the rest of
+    // constrainSolnSpace().
+    assert(_logger);
+    _logger->registerEvent("FaSe jacobian");
+    _logger->registerEvent("FaSe residual");
+    _logger->registerEvent("FaSe solve");
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -227,9 +315,6 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
     // Get cell geometry information that doesn't depend on cell
     const int spaceDim = _quadrature->spaceDim();
 
-    // Get sections associated with cohesive cells
-    PetscSection residualGlobalSection = residual.globalSection(); assert(residualGlobalSection);
-
     topology::VecVisitorMesh residualVisitor(residual);
     PetscScalar* residualArray = residualVisitor.localArray();
 
@@ -262,39 +347,39 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
     topology::VecVisitorMesh orientationVisitor(orientation);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
+    // Offsets are shared by all fields over the domain (and by all
+    // vector fields over the fault).
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+    const int_array& offsetsOrientation = _cohesiveOffsets.orientation;
+    const int_array& offsetsArea = _cohesiveOffsets.area;
+
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
     // Loop over fault vertices
-    PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        // Skip clamped vertices
-        if (e_lagrange < 0) {
+        // Skip clamped vertices and compute contribution only if
+        // Lagrange constraint is local.
+        if (offsetsLGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff = 0;
-        err = PetscSectionGetOffset(residualGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0)
-            continue;
-
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventBegin(restrictEvent);
 #endif
 
         // Get prescribed traction perturbation at fault vertex.
         if (_tractPerturbation) {
-            const PetscInt toff = tractionsVisitor->sectionOffset(v_fault);
-            assert(spaceDim == tractionsVisitor->sectionDof(v_fault));
+            const PetscInt toff = offsetsFault[iVertex];
+            assert(toff == tractionsVisitor->sectionOffset(_cohesiveVertices[iVertex].fault));
             for(PetscInt d = 0; d < spaceDim; ++d) {
                 tractPerturbVertex[d] = tractionsArray[toff+d];
             } // for
@@ -302,33 +387,16 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
             tractPerturbVertex = 0.0;
         } // if/else
 
-        // Get orientation associated with fault vertex.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-
-        // Get disp(t) at conventional vertices and Lagrange vertex.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t->t+dt) at conventional vertices and Lagrange vertex.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        const PetscInt ooff = offsetsOrientation[iVertex];
+        const PetscInt aoff = offsetsArea[iVertex];
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        assert(ooff == orientationVisitor.sectionOffset(_cohesiveVertices[iVertex].fault));
+        assert(aoff == areaVisitor.sectionOffset(_cohesiveVertices[iVertex].fault));
+        assert(noff == dispTVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == residualVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(restrictEvent);
@@ -340,8 +408,8 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         PylithScalar tractionNormal = 0.0;
         const PetscInt indexN = spaceDim - 1;
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            slipNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d]);
-            tractionNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
+            slipNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d]);
+            tractionNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[loff+d] + dispTIncrArray[loff+d]);
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -351,22 +419,16 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         if (slipNormal < _zeroToleranceNormal || !_openFreeSurf) {
             // if no opening or flag indicates to still impose initial tractions when fault is open.
             // Assemble contributions into field
-            const PetscInt rnoff = residualVisitor.sectionOffset(v_negative);
-            assert(spaceDim == residualVisitor.sectionDof(v_negative));
-
-            const PetscInt rpoff = residualVisitor.sectionOffset(v_positive);
-            assert(spaceDim == residualVisitor.sectionDof(v_positive));
-
             // Initial (external) tractions oppose (internal) tractions associated with Lagrange multiplier.
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                residualArray[rnoff+d] +=  areaArray[aoff] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d] - tractPerturbVertex[d]);
-                residualArray[rpoff+d] += -areaArray[aoff] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d] - tractPerturbVertex[d]);
+                residualArray[noff+d] +=  areaArray[aoff] * (dispTArray[loff+d] + dispTIncrArray[loff+d] - tractPerturbVertex[d]);
+                residualArray[poff+d] += -areaArray[aoff] * (dispTArray[loff+d] + dispTIncrArray[loff+d] - tractPerturbVertex[d]);
             } // for
         } else { // opening, normal traction should be zero
             std::ostringstream msg;
             if (fabs(tractionNormal) > _zeroTolerance) {
                 msg << "WARNING! Fault opening with nonzero traction."
-                    << ", v_fault: " << v_fault
+                    << ", v_fault: " << _cohesiveVertices[iVertex].fault
                     << ", opening: " << slipNormal
                     << ", normal traction: " << tractionNormal
                     << std::endl;
@@ -429,7 +491,14 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
     topology::VecVisitorMesh orientationVisitor(orientation);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
+    // Gather slip, slip rate, and normal traction for all vertices so
+    // the friction model can update the state variables in one batch.
     const int numVertices = _cohesiveVertices.size();
+    int_array batchVertices(numVertices);
+    scalar_array batchSlip(numVertices);
+    scalar_array batchSlipRate(numVertices);
+    scalar_array batchTractionNormal(numVertices);
+    int numBatch = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -471,41 +540,57 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
             } // for
         } // for
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
-
-        // Use fault constitutive model to compute traction associated with
-        // friction.
+        batchVertices[numBatch] = v_fault;
         switch (spaceDim) { // switch
         case 1: { // case 1
-            const PylithScalar slipMag = 0.0;
-            const PylithScalar slipRateMag = 0.0;
-            const PylithScalar tractionNormal = tractionTpdtVertex[0];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            batchSlip[numBatch] = 0.0;
+            batchSlipRate[numBatch] = 0.0;
+            batchTractionNormal[numBatch] = tractionTpdtVertex[0];
             break;
         } // case 1
         case 2: { // case 2
-            const PylithScalar slipMag = fabs(slipVertex[0]);
-            const PylithScalar slipRateMag = fabs(slipRateVertex[0]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[1];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            batchSlip[numBatch] = fabs(slipVertex[0]);
+            batchSlipRate[numBatch] = fabs(slipRateVertex[0]);
+            batchTractionNormal[numBatch] = tractionTpdtVertex[1];
             break;
         } // case 2
         case 3: { // case 3
-            const PylithScalar slipMag =
+            batchSlip[numBatch] =
                 sqrt(slipVertex[0]*slipVertex[0] + slipVertex[1]*slipVertex[1]);
-            const PylithScalar slipRateMag =
+            batchSlipRate[numBatch] =
                 sqrt(slipRateVertex[0]*slipRateVertex[0] +
                      slipRateVertex[1]*slipRateVertex[1]);
-            const PylithScalar tractionNormal = tractionTpdtVertex[2];
-            _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            batchTractionNormal[numBatch] = tractionTpdtVertex[2];
             break;
         } // case 3
         default:
             assert(0);
             throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::updateStateVars().");
         } // switch
+
+        if (_ruptureMetrics) {
+            const PylithScalar slipRateMag = batchSlipRate[numBatch];
+            if (slipRateMag > _ruptureSlipRateThreshold && t < _ruptureTime[iVertex]) {
+                _ruptureTime[iVertex] = t;
+            } // if
+            if (slipRateMag > _peakSlipRate[iVertex]) {
+                _peakSlipRate[iVertex] = slipRateMag;
+                _peakSlipRateTime[iVertex] = t;
+            } // if
+        } // if
+        ++numBatch;
     } // for
+    if (0 == numBatch) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Use fault constitutive model to update the state variables.
+    _friction->createPropsStateVarsVisitors();
+    scalar_array propsStateVars(numBatch*_friction->propsStateVarsSize());
+    _friction->retrievePropsStateVars(&propsStateVars[0], &batchVertices[0], numBatch);
+    _friction->updateStateVars(t, &batchSlip[0], &batchSlipRate[0], &batchTractionNormal[0], &propsStateVars[0], numBatch);
+    _friction->storeStateVars(&propsStateVars[0], &batchVertices[0], numBatch);
+    _friction->destroyPropsStateVarsVisitors();
 
     PYLITH_METHOD_END;
 } // updateStateVars
@@ -519,15 +604,36 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 { // constrainSolnSpace
     PYLITH_METHOD_BEGIN;
 
-    /// Member prototype for _constrainSolnSpaceXD()
-    typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
-        (scalar_array*,
-        const PylithScalar,
-        const scalar_array&,
-        const scalar_array&,
-        const scalar_array&,
-        const PylithScalar,
-        const bool);
+    assert(_quadrature);
+
+    switch (_quadrature->spaceDim()) { // switch
+    case 1:
+        _constrainSolnSpaceDim<1>(fields, t, jacobian);
+        break;
+    case 2:
+        _constrainSolnSpaceDim<2>(fields, t, jacobian);
+        break;
+    case 3:
+        _constrainSolnSpaceDim<3>(fields, t, jacobian);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in "
+                               "FaultCohesiveDyn::constrainSolnSpace().");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // constrainSolnSpace
+
+// ----------------------------------------------------------------------
+// Constrain solution based on friction for spatial dimension dim.
+template<int dim>
+void
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceDim(topology::SolutionFields* const fields,
+                                                         const PylithScalar t,
+                                                         const topology::Jacobian& jacobian)
+{ // _constrainSolnSpaceDim
+    PYLITH_METHOD_BEGIN;
 
     assert(fields);
     assert(_quadrature);
@@ -540,16 +646,11 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     _friction->timeStep(_dt);
     const PylithScalar dt = _dt;
 
-    const int spaceDim = _quadrature->spaceDim();
+    const int spaceDim = dim;
     const int indexN = spaceDim - 1;
-
-    // Allocate arrays for vertex values
-    scalar_array tractionTpdtVertex(spaceDim);
-    scalar_array dDispRelVertex(spaceDim);
+    assert(_quadrature->spaceDim() == spaceDim);
 
     // Get sections
-    scalar_array slipTpdtVertex(spaceDim);
-    scalar_array slipRateVertex(spaceDim);
     topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
 
     topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
@@ -558,76 +659,66 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     topology::VecVisitorMesh dispTVisitor(fields->get("disp(t)"));
     const PetscScalar* dispTArray = dispTVisitor.localArray();
 
-    scalar_array dDispTIncrVertexN(spaceDim);
-    scalar_array dDispTIncrVertexP(spaceDim);
     topology::VecVisitorMesh dispTIncrVisitor(fields->get("dispIncr(t->t+dt)"));
     const PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
 
-    PetscSection dispTIncrGlobalSection = fields->get("dispIncr(t->t+dt)").globalSection(); assert(dispTIncrGlobalSection);
-
     topology::VecVisitorMesh dispTIncrAdjVisitor(fields->get("dispIncr adjust"));
     PetscScalar* dispTIncrAdjArray = dispTIncrAdjVisitor.localArray();
 
-    scalar_array dTractionTpdtVertex(spaceDim);
-    scalar_array dLagrangeTpdtVertex(spaceDim);
     topology::VecVisitorMesh dLagrangeVisitor(_fields->get("sensitivity dLagrange"));
     PetscScalar* dLagrangeArray = dLagrangeVisitor.localArray();
 
-    constrainSolnSpace_fn_type constrainSolnSpaceFn;
-    switch (spaceDim) { // switch
-    case 1:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D;
-        break;
-    case 2:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D;
-        break;
-    case 3:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D;
-        break;
-    default:
-        assert(0);
-        throw std::logic_error("Unknown spatial dimension in "
-                               "FaultCohesiveDyn::constrainSolnSpace().");
-    } // switch
+    // Offsets are shared by all fields over the domain (and by all
+    // vector fields over the fault).
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+    const int_array& offsetsOrientation = _cohesiveOffsets.orientation;
+
+    // Vertices are independent, so work arrays are private to each
+    // thread and friction properties go into a per-thread buffer.
+    const int propsStateVarsSize = _friction->propsStateVarsSize();
+    assert(propsStateVarsSize > 0);
+    scalar_array propsStateVarsVertex(propsStateVarsSize);
+
+    // Vertices that remain locked are only checked against the
+    // friction strength from the last full evaluation.
+    const bool useActiveSet = spaceDim > 1 && _activeSetMargin < 1.0;
+    _activeSetReset(t);
+    int numActiveLocal = 0; // Number of vertices with changes in Lagrange multipliers
 
     const int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
+#if defined(THREADED_VERTEX_LOOPS)
+#pragma omp parallel for schedule(static) firstprivate(propsStateVarsVertex) reduction(+:numActiveLocal)
+#endif
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        // Vertex values in fault coordinate system.
+        PylithScalar slipTpdtVertex[dim];
+        PylithScalar slipRateVertex[dim];
+        PylithScalar tractionTpdtVertex[dim];
+        PylithScalar dTractionTpdtVertex[dim];
+        PylithScalar dLagrangeTpdtVertex[dim];
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        if (_cohesiveVertices[iVertex].lagrange < 0) {
             continue;
         } // if
 
-        // Get displacement values
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment values.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get orientation
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+        // Get offsets of displacement, displacement increment, and orientation.
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        const PetscInt ooff = offsetsOrientation[iVertex];
+        assert(noff == dispTVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+        assert(ooff == orientationVisitor.sectionOffset(v_fault));
 
         // Step 1: Prevent nonphysical trial solutions. The product of the
         // normal traction and normal slip must be nonnegative (forbid
@@ -635,21 +726,24 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 
         // Compute slip, slip rate, and Lagrange multiplier at time t+dt
         // in fault coordinate system.
-        slipTpdtVertex = 0.0;
-        slipRateVertex = 0.0;
-        tractionTpdtVertex = 0.0;
+        PylithScalar slipGlobal[dim];
+        PylithScalar slipRateGlobal[dim];
+        PylithScalar tractionGlobal[dim];
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            for(PetscInt e = 0; e < spaceDim; ++e) {
-                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtpoff+e] + dispTIncrArray[dipoff+e] - dispTArray[dtnoff+e] - dispTIncrArray[dinoff+e]);
-                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[dipoff+e] - dispTIncrArray[dinoff+e]) / dt;
-                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtloff+e] + dispTIncrArray[diloff+e]);
-            } // for
+            slipGlobal[d] = dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d];
+            slipRateGlobal[d] = (dispTIncrArray[poff+d] - dispTIncrArray[noff+d]) / dt;
+            tractionGlobal[d] = dispTArray[loff+d] + dispTIncrArray[loff+d];
+        } // for
+        _rotateToFault<dim>(slipTpdtVertex, &orientationArray[ooff], slipGlobal);
+        _rotateToFault<dim>(slipRateVertex, &orientationArray[ooff], slipRateGlobal);
+        _rotateToFault<dim>(tractionTpdtVertex, &orientationArray[ooff], tractionGlobal);
 #if !defined(DISABLE_SLIPRATE_TOLERANCE) // 2017-06-23  Is this really necessary?
+        for(PetscInt d = 0; d < spaceDim; ++d) {
             if (fabs(slipRateVertex[d]) < _zeroTolerance / dt) {
                 slipRateVertex[d] = 0.0;
             } // if
-#endif
         } // for
+#endif
         if (fabs(slipTpdtVertex[indexN]) < _zeroToleranceNormal) {
             slipTpdtVertex[indexN] = 0.0;
         } // if
@@ -690,23 +784,29 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         // change in Lagrange multiplier (dTractionTpdtVertex) in fault
         // coordinate system.
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            dTractionTpdtVertex[iDim] = 0.0;
+        } // for
+        if (useActiveSet && _activeSetIsLocked<dim>(iVertex, slipTpdtVertex, slipRateVertex, tractionTpdtVertex)) {
+            // Vertex remains locked, so no change in traction.
+        } else {
+            // Get friction properties and state variables.
+            _friction->retrievePropsStateVars(&propsStateVarsVertex[0], v_fault);
 
-        // Use fault constitutive model to compute traction associated with
-        // friction.
-        dTractionTpdtVertex = 0.0;
-        const PylithScalar jacobianShearVertex = 0.0;
-        const bool iterating = true; // Iterating to get friction
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
+            // Use fault constitutive model to compute traction associated with
+            // friction.
+            const PylithScalar jacobianShearVertex = 0.0;
+            const bool iterating = true; // Iterating to get friction
+            _constrainSolnSpaceVertex<dim>(dTractionTpdtVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, &propsStateVarsVertex[0], jacobianShearVertex, iterating);
+
+            if (useActiveSet) {
+                _activeSetClassify<dim>(iVertex, t, slipTpdtVertex, slipRateVertex, tractionTpdtVertex, dTractionTpdtVertex, &propsStateVarsVertex[0]);
+            } // if
+        } // if/else
 
         // Rotate increment in traction back to global coordinate system.
-        dLagrangeTpdtVertex = 0.0;
+        _rotateToGlobal<dim>(dLagrangeTpdtVertex, &orientationArray[ooff], dTractionTpdtVertex);
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            for (int jDim=0; jDim < spaceDim; ++jDim) {
-                dLagrangeTpdtVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * dTractionTpdtVertex[jDim];
-            } // for
-
             // :TODO: BRAD - add stuff here for updating slip
 
             // Add in potential contribution from adjusting Lagrange
@@ -732,132 +832,159 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 #endif
 
         // Set change in Lagrange multiplier
-        const PetscInt soff = dLagrangeVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
+        const PetscInt soff = offsetsFault[iVertex];
+        assert(soff == dLagrangeVisitor.sectionOffset(v_fault));
         for(PetscInt d = 0; d < spaceDim; ++d) {
             dLagrangeArray[soff+d] = dLagrangeTpdtVertex[d];
         } // for
+        for(PetscInt d = 0; d < spaceDim; ++d) {
+            if (dLagrangeTpdtVertex[d] != 0.0) {
+                ++numActiveLocal;
+                break;
+            } // if
+        } // for
 
     } // for
+    _friction->destroyPropsStateVarsVisitors();
     dispTIncrAdjVisitor.clear();
     dLagrangeVisitor.clear();
 
-    // Step 3: Calculate change in displacement field corresponding to
-    // change in Lagrange multipliers imposed by friction criterion.
-
-    // Solve sensitivity problem for negative side of the fault.
-    bool negativeSideFlag = true;
-    _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
-    _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
-    _sensitivityUpdateSoln(negativeSideFlag);
-
-    // Solve sensitivity problem for positive side of the fault.
-    negativeSideFlag = false;
-    _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
-    _sensitivityReformResidual(negativeSideFlag);
-    _sensitivitySolve();
-    _sensitivityUpdateSoln(negativeSideFlag);
-
-    // Step 4: Update Lagrange multipliers and displacement fields based
-    // on changes imposed by friction criterion in Step 2 (change in
-    // Lagrange multipliers) and Step 3 (slip associated with change in
-    // Lagrange multipliers).
-    //
-    // Use line search to find best update. This improves convergence
-    // because it accounts for feedback between the fault constitutive
-    // model and the deformation. We also search in log space because
-    // some fault constitutive models depend on the log of slip rate.
-
-    const PylithScalar residualTol = _zeroTolerance; // L2 misfit in tractions
-    const int maxIter = 16;
-    PylithScalar logAlphaL = log10(_zeroTolerance); // minimum step
-    PylithScalar logAlphaR = log10(1.0); // maximum step
-    PylithScalar logAlphaM = 0.5*(logAlphaL + logAlphaR);
-    PylithScalar logAlphaML = 0.5*(logAlphaL + logAlphaM);
-    PylithScalar logAlphaMR = 0.5*(logAlphaM + logAlphaR);
-    PylithScalar residualL = _constrainSolnSpaceNorm(pow(10.0, logAlphaL), t, fields);
-    PylithScalar residualML = _constrainSolnSpaceNorm(pow(10.0, logAlphaML), t, fields);
-    PylithScalar residualM = _constrainSolnSpaceNorm(pow(10.0, logAlphaM), t, fields);
-    PylithScalar residualMR = _constrainSolnSpaceNorm(pow(10.0, logAlphaMR), t, fields);
-    PylithScalar residualR = _constrainSolnSpaceNorm(pow(10.0, logAlphaR), t, fields);
-    for (int iter=0; iter < maxIter; ++iter) {
-        if (residualM < residualTol || residualR < residualTol)
-            // if residual is very small, we prefer the full step
-            break;
+    // If the friction criterion does not change the Lagrange
+    // multipliers at any vertex (for example, all vertices are
+    // locked), the sensitivity solve gives zero relative
+    // displacements, so skip Steps 3 and 4. Otherwise, the solve and
+    // the update cover all vertices, because a change in the Lagrange
+    // multipliers at one vertex changes the relative displacements at
+    // its neighbors.
+    int numActive = 0;
+    PetscErrorCode err = MPI_Allreduce(&numActiveLocal, &numActive, 1, MPI_INT, MPI_SUM, _faultMesh->comm());PYLITH_CHECK_ERROR(err);
+
+    PylithScalar alpha = 1.0;
+    if (numActive > 0) {
+        // Step 3: Calculate change in displacement field corresponding to
+        // change in Lagrange multipliers imposed by friction criterion.
+
+        assert(_logger);
+        const int sensitivityJacobianEvent = _logger->eventId("FaSe jacobian");
+        const int sensitivityResidualEvent = _logger->eventId("FaSe residual");
+        const int sensitivitySolveEvent = _logger->eventId("FaSe solve");
+
+        // Solve sensitivity problem for negative side of the fault and
+        // then for positive side of the fault.
+        const bool negativeSideFlags[2] = { true, false };
+        for (int iSide=0; iSide < 2; ++iSide) {
+            const bool negativeSideFlag = negativeSideFlags[iSide];
+            _logger->eventBegin(sensitivityJacobianEvent);
+            _sensitivityUpdateJacobian(negativeSideFlag, jacobian, *fields);
+            _logger->eventEnd(sensitivityJacobianEvent);
+
+            _logger->eventBegin(sensitivityResidualEvent);
+            _sensitivityReformResidual(negativeSideFlag);
+            _logger->eventEnd(sensitivityResidualEvent);
+
+            _logger->eventBegin(sensitivitySolveEvent);
+            _sensitivitySolve(negativeSideFlag);
+            _logger->eventEnd(sensitivitySolveEvent);
+
+            _sensitivityUpdateSoln(negativeSideFlag);
+        } // for
+
+        // Step 4: Update Lagrange multipliers and displacement fields based
+        // on changes imposed by friction criterion in Step 2 (change in
+        // Lagrange multipliers) and Step 3 (slip associated with change in
+        // Lagrange multipliers).
+        //
+        // Use line search to find best update. This improves convergence
+        // because it accounts for feedback between the fault constitutive
+        // model and the deformation. We also search in log space because
+        // some fault constitutive models depend on the log of slip rate.
+
+        const PylithScalar residualTol = _zeroTolerance; // L2 misfit in tractions
+        const int maxIter = 16;
+        PylithScalar logAlphaL = log10(_zeroTolerance); // minimum step
+        PylithScalar logAlphaR = log10(1.0); // maximum step
+        PylithScalar logAlphaM = 0.5*(logAlphaL + logAlphaR);
+        PylithScalar logAlphaML = 0.5*(logAlphaL + logAlphaM);
+        PylithScalar logAlphaMR = 0.5*(logAlphaM + logAlphaR);
+        PylithScalar residualL = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaL), t, fields);
+        PylithScalar residualML = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaML), t, fields);
+        PylithScalar residualM = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaM), t, fields);
+        PylithScalar residualMR = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaMR), t, fields);
+        PylithScalar residualR = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaR), t, fields);
+        for (int iter=0; iter < maxIter; ++iter) {
+            if (residualM < residualTol || residualR < residualTol)
+                // if residual is very small, we prefer the full step
+                break;
 
 #if 0 // DEBUGGING
-        const int rank = _faultMesh->commRank();
-        std::cout << "["<<rank<<"] alphaL: " << pow(10.0, logAlphaL)
-                  << ", residuaL: " << residualL
-                  << ", alphaM: " << pow(10.0, logAlphaM)
-                  << ", residualM: " << residualM
-                  << ", alphaR: " << pow(10.0, logAlphaR)
-                  << ", residualR: " << residualR
-                  << std::endl;
+            const int rank = _faultMesh->commRank();
+            std::cout << "["<<rank<<"] alphaL: " << pow(10.0, logAlphaL)
+                      << ", residuaL: " << residualL
+                      << ", alphaM: " << pow(10.0, logAlphaM)
+                      << ", residualM: " << residualM
+                      << ", alphaR: " << pow(10.0, logAlphaR)
+                      << ", residualR: " << residualR
+                      << std::endl;
 #endif
 
-        if (residualL < residualML && residualL < residualM && residualL < residualMR && residualL < residualR) {
-            logAlphaL = logAlphaL;
-            logAlphaR = logAlphaM;
-            residualL = residualL;
-            residualR = residualM;
-            residualM = residualML;
-        } else if (residualML <= residualL  && residualML < residualM && residualML < residualMR && residualML < residualR) {
-            logAlphaL = logAlphaL;
-            logAlphaR = logAlphaM;
-            residualL = residualL;
-            residualR = residualM;
-            residualM = residualML;
-        } else if (residualM <= residualL  && residualM <= residualML && residualM < residualMR && residualM < residualR) {
-            logAlphaL = logAlphaML;
-            logAlphaR = logAlphaMR;
-            residualL = residualML;
-            residualR = residualMR;
-            residualM = residualM;
-        } else if (residualMR <= residualL  && residualMR <= residualML && residualMR <= residualM && residualMR < residualR) {
-            logAlphaL = logAlphaM;
-            logAlphaR = logAlphaR;
-            residualL = residualM;
-            residualR = residualR;
-            residualM = residualMR;
-        } else if (residualR <= residualL  && residualR <= residualML && residualR <= residualM && residualR <= residualMR) {
-            logAlphaL = logAlphaM;
-            logAlphaR = logAlphaR;
-            residualL = residualM;
-            residualR = residualR;
-            residualM = residualMR;
-        } else {
-            assert(0);
-            throw std::logic_error("Unknown case in constrain solution space "
-                                   "line search.");
-        } // if/else
-        logAlphaM = (logAlphaL + logAlphaR) / 2.0;
-        logAlphaML = (logAlphaL + logAlphaM) / 2.0;
-        logAlphaMR = (logAlphaM + logAlphaR) / 2.0;
+            if (residualL < residualML && residualL < residualM && residualL < residualMR && residualL < residualR) {
+                logAlphaL = logAlphaL;
+                logAlphaR = logAlphaM;
+                residualL = residualL;
+                residualR = residualM;
+                residualM = residualML;
+            } else if (residualML <= residualL  && residualML < residualM && residualML < residualMR && residualML < residualR) {
+                logAlphaL = logAlphaL;
+                logAlphaR = logAlphaM;
+                residualL = residualL;
+                residualR = residualM;
+                residualM = residualML;
+            } else if (residualM <= residualL  && residualM <= residualML && residualM < residualMR && residualM < residualR) {
+                logAlphaL = logAlphaML;
+                logAlphaR = logAlphaMR;
+                residualL = residualML;
+                residualR = residualMR;
+                residualM = residualM;
+            } else if (residualMR <= residualL  && residualMR <= residualML && residualMR <= residualM && residualMR < residualR) {
+                logAlphaL = logAlphaM;
+                logAlphaR = logAlphaR;
+                residualL = residualM;
+                residualR = residualR;
+                residualM = residualMR;
+            } else if (residualR <= residualL  && residualR <= residualML && residualR <= residualM && residualR <= residualMR) {
+                logAlphaL = logAlphaM;
+                logAlphaR = logAlphaR;
+                residualL = residualM;
+                residualR = residualR;
+                residualM = residualMR;
+            } else {
+                assert(0);
+                throw std::logic_error("Unknown case in constrain solution space "
+                                       "line search.");
+            } // if/else
+            logAlphaM = (logAlphaL + logAlphaR) / 2.0;
+            logAlphaML = (logAlphaL + logAlphaM) / 2.0;
+            logAlphaMR = (logAlphaM + logAlphaR) / 2.0;
 
-        residualML = _constrainSolnSpaceNorm(pow(10.0, logAlphaML), t, fields);
-        residualMR = _constrainSolnSpaceNorm(pow(10.0, logAlphaMR), t, fields);
+            residualML = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaML), t, fields);
+            residualMR = _constrainSolnSpaceNorm<dim>(pow(10.0, logAlphaMR), t, fields);
 
-    } // for
-      // Account for possibility that end points have lowest residual
-    if (residualR <= residualM || residualR < residualTol) {
-        logAlphaM = logAlphaR;
-        residualM = residualR;
-    } else if (residualL < residualM) {
-        logAlphaM = logAlphaL;
-        residualM = residualL;
-    } // if/else
-    const PylithScalar alpha = pow(10.0, logAlphaM); // alphaM is our best guess
+        } // for
+          // Account for possibility that end points have lowest residual
+        if (residualR <= residualM || residualR < residualTol) {
+            logAlphaM = logAlphaR;
+            residualM = residualR;
+        } else if (residualL < residualM) {
+            logAlphaM = logAlphaL;
+            residualM = residualL;
+        } // if/else
+        alpha = pow(10.0, logAlphaM); // alphaM is our best guess
 #if 0 // DEBUGGING
-    std::cout << "ALPHA: " << alpha
-              << ", residual: " << residualM
-              << std::endl;
+        std::cout << "ALPHA: " << alpha
+                  << ", residual: " << residualM
+                  << std::endl;
 #endif
-
-    scalar_array slipTVertex(spaceDim);
-    scalar_array dSlipTpdtVertex(spaceDim);
-    scalar_array dispRelVertex(spaceDim);
+    } // if
 
     topology::VecVisitorMesh sensDispRelVisitor(_fields->get("sensitivity relative disp"));
     PetscScalar* sensDispRelArray = sensDispRelVisitor.localArray();
@@ -868,69 +995,54 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     dLagrangeVisitor.initialize(_fields->get("sensitivity dLagrange"));
     dLagrangeArray = dLagrangeVisitor.localArray();
 
-    PetscErrorCode err = 0;
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        if (_cohesiveVertices[iVertex].lagrange < 0) {
             continue;
         } // if
 
-        // Get change in Lagrange multiplier computed from friction criterion.
-        const PetscInt soff = dLagrangeVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
-
-        // Get change in relative displacement from sensitivity solve.
-        const PetscInt sroff = sensDispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == sensDispRelVisitor.sectionDof(v_fault));
-
-        // Get current relative displacement for updating.
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
-
-        // Get orientation.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
-        // Get displacement.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment (trial solution).
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
+        // Get offsets of change in Lagrange multiplier computed from
+        // friction criterion and change in relative displacement from
+        // sensitivity solve (vector fields over the fault share the
+        // layout of the relative displacement).
+        const PetscInt foff = offsetsFault[iVertex];
+        assert(foff == dLagrangeVisitor.sectionOffset(v_fault));
+        assert(foff == sensDispRelVisitor.sectionOffset(v_fault));
+        assert(foff == dispRelVisitor.sectionOffset(v_fault));
+
+        // Get offsets of orientation, displacement, and displacement
+        // increment (trial solution).
+        const PetscInt ooff = offsetsOrientation[iVertex];
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        assert(ooff == orientationVisitor.sectionOffset(v_fault));
+        assert(noff == dispTVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == dispTIncrAdjVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
 
         // Scale perturbation in relative displacements and change in
         // Lagrange multipliers by alpha using only shear components.
-        slipTVertex = 0.0;
-        slipTpdtVertex = 0.0;
-        dSlipTpdtVertex = 0.0;
-        tractionTpdtVertex = 0.0;
-        dTractionTpdtVertex = 0.0;
+        PylithScalar slipTpdtVertex[dim];
+        PylithScalar dSlipTpdtVertex[dim];
+        PylithScalar tractionTpdtVertex[dim];
+        PylithScalar dTractionTpdtVertex[dim];
+        PylithScalar slipGlobal[dim];
+        PylithScalar dSlipGlobal[dim];
+        PylithScalar tractionGlobal[dim];
+        PylithScalar dTractionGlobal[dim];
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            for (int jDim=0; jDim < spaceDim; ++jDim) {
-                slipTVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtpoff+jDim] - dispTArray[dtnoff+jDim]);
-                slipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtpoff+jDim] - dispTArray[dtnoff+jDim] + dispTIncrArray[dipoff+jDim] - dispTIncrArray[dinoff+jDim]);
-                dSlipTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * alpha*sensDispRelArray[sroff+jDim];
-                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + dispTIncrArray[diloff+jDim]);
-                dTractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * alpha*dLagrangeArray[soff+jDim];
-            } // for
+            slipGlobal[iDim] = dispTArray[poff+iDim] - dispTArray[noff+iDim] + dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim];
+            dSlipGlobal[iDim] = alpha*sensDispRelArray[foff+iDim];
+            tractionGlobal[iDim] = dispTArray[loff+iDim] + dispTIncrArray[loff+iDim];
+            dTractionGlobal[iDim] = alpha*dLagrangeArray[foff+iDim];
         } // for
+        _rotateToFault<dim>(slipTpdtVertex, &orientationArray[ooff], slipGlobal);
+        _rotateToFault<dim>(dSlipTpdtVertex, &orientationArray[ooff], dSlipGlobal);
+        _rotateToFault<dim>(tractionTpdtVertex, &orientationArray[ooff], tractionGlobal);
+        _rotateToFault<dim>(dTractionTpdtVertex, &orientationArray[ooff], dTractionGlobal);
 
         // FIRST, correct nonphysical trial solutions.
         // Order of steps 5a-5c is important!
@@ -978,19 +1090,18 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         } // if/else
 
         // Update current estimate of slip from t to t+dt.
-        slipTpdtVertex += dSlipTpdtVertex;
-
-        // Compute relative displacement from slip.
-        dispRelVertex = 0.0;
-        dDispRelVertex = 0.0;
-        dLagrangeTpdtVertex = 0.0;
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            for (int jDim=0; jDim < spaceDim; ++jDim) {
-                dispRelVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * slipTpdtVertex[jDim];
-                dDispRelVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * dSlipTpdtVertex[jDim];
-                dLagrangeTpdtVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * dTractionTpdtVertex[jDim];
-            } // for
+            slipTpdtVertex[iDim] += dSlipTpdtVertex[iDim];
+        } // for
 
+        // Compute change in relative displacement from change in slip.
+        PylithScalar dDispRelVertex[dim];
+        PylithScalar dLagrangeTpdtVertex[dim];
+        PylithScalar dDispTIncrVertexN[dim];
+        PylithScalar dDispTIncrVertexP[dim];
+        _rotateToGlobal<dim>(dDispRelVertex, &orientationArray[ooff], dSlipTpdtVertex);
+        _rotateToGlobal<dim>(dLagrangeTpdtVertex, &orientationArray[ooff], dTractionTpdtVertex);
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
             dDispTIncrVertexN[iDim] = -0.5*dDispRelVertex[iDim];
             dDispTIncrVertexP[iDim] = +0.5*dDispRelVertex[iDim];
         } // for
@@ -1014,30 +1125,18 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
 
         // Compute contribution to adjusting solution only if Lagrange
         // constraint is local (the adjustment is assembled across processors).
-        PetscInt goff;
-        err = PetscSectionGetOffset(dispTIncrGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff >= 0) {
-            // Get offsets in displacement increment adjustment.
-            const PetscInt dialoff = dispTIncrAdjVisitor.sectionOffset(e_lagrange);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(e_lagrange));
-
-            const PetscInt dianoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-            const PetscInt diapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
+        if (offsetsLGlobal[iVertex] >= 0) {
             // Update Lagrange multiplier increment.
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                dispTIncrAdjArray[dialoff+d] += dLagrangeTpdtVertex[d];
-                dispTIncrAdjArray[dianoff+d] += dDispTIncrVertexN[d];
-                dispTIncrAdjArray[diapoff+d] += dDispTIncrVertexP[d];
+                dispTIncrAdjArray[loff+d] += dLagrangeTpdtVertex[d];
+                dispTIncrAdjArray[noff+d] += dDispTIncrVertexN[d];
+                dispTIncrAdjArray[poff+d] += dDispTIncrVertexP[d];
             } // for
         } // if
     } // for
 
     PYLITH_METHOD_END;
-} // constrainSolnSpace
+} // _constrainSolnSpaceDim
 
 // ----------------------------------------------------------------------
 // Adjust solution from solver with lumped Jacobian to match Lagrange
@@ -1049,15 +1148,36 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 { // adjustSolnLumped
     PYLITH_METHOD_BEGIN;
 
-    /// Member prototype for _constrainSolnSpaceXD()
-    typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
-        (scalar_array*,
-        const PylithScalar,
-        const scalar_array&,
-        const scalar_array&,
-        const scalar_array&,
-        const PylithScalar,
-        const bool);
+    assert(_quadrature);
+
+    switch (_quadrature->spaceDim()) { // switch
+    case 1:
+        _adjustSolnLumpedDim<1>(fields, t, jacobian);
+        break;
+    case 2:
+        _adjustSolnLumpedDim<2>(fields, t, jacobian);
+        break;
+    case 3:
+        _adjustSolnLumpedDim<3>(fields, t, jacobian);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::adjustSolnLumped.");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // adjustSolnLumped
+
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian to match Lagrange
+// multiplier constraints for spatial dimension dim.
+template<int dim>
+void
+pylith::faults::FaultCohesiveDyn::_adjustSolnLumpedDim(topology::SolutionFields* const fields,
+                                                       const PylithScalar t,
+                                                       const topology::Field& jacobian)
+{ // _adjustSolnLumpedDim
+    PYLITH_METHOD_BEGIN;
 
     assert(fields);
     assert(_quadrature);
@@ -1087,25 +1207,16 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     _logger->eventBegin(setupEvent);
 
     // Get cell information and setup storage for cell data
-    const int spaceDim = _quadrature->spaceDim();
-
-    // Allocate arrays for vertex values
-    scalar_array tractionTpdtVertex(spaceDim);
-    scalar_array lagrangeTpdtVertex(spaceDim);
-    scalar_array dTractionTpdtVertex(spaceDim);
-    scalar_array dLagrangeTpdtVertex(spaceDim);
+    const int spaceDim = dim;
+    assert(_quadrature->spaceDim() == spaceDim);
 
     // Update time step in friction (can vary).
     _friction->timeStep(_dt);
 
     // Get section information
-    scalar_array slipVertex(spaceDim);
-    scalar_array dispRelVertex(spaceDim);
     topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
     PetscScalar* dispRelArray = dispRelVisitor.localArray();
 
-    scalar_array slipRateVertex(spaceDim);
-
     topology::VecVisitorMesh areaVisitor(_fields->get("area"));
     const PetscScalar* areaArray = areaVisitor.localArray();
 
@@ -1115,9 +1226,6 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     topology::VecVisitorMesh dispTVisitor(fields->get("disp(t)"));
     const PetscScalar* dispTArray = dispTVisitor.localArray();
 
-    scalar_array dispIncrVertexN(spaceDim);
-    scalar_array dispIncrVertexP(spaceDim);
-    scalar_array lagrangeTIncrVertex(spaceDim);
     topology::VecVisitorMesh dispTIncrVisitor(fields->get("dispIncr(t->t+dt)"));
     PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
 
@@ -1130,26 +1238,16 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     topology::VecVisitorMesh residualVisitor(fields->get("residual"));
     const PetscScalar* residualArray = residualVisitor.localArray();
 
-    PetscSection solnGlobalSection = fields->get("dispIncr(t->t+dt)").globalSection(); assert(solnGlobalSection);
-
-    constrainSolnSpace_fn_type constrainSolnSpaceFn;
-    switch (spaceDim) { // switch
-    case 1:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D;
-        break;
-    case 2:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D;
-        break;
-    case 3:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D;
-        break;
-    default:
-        assert(0);
-        throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::adjustSolnLumped.");
-    } // switch
+    // Offsets are shared by all fields over the domain (and by all
+    // vector fields over the fault).
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+    const int_array& offsetsOrientation = _cohesiveOffsets.orientation;
+    const int_array& offsetsArea = _cohesiveOffsets.area;
 
     _logger->eventEnd(setupEvent);
 
@@ -1157,16 +1255,40 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
+    // Vertices are independent (each has its own negative, positive,
+    // and Lagrange multiplier points), so work arrays are private to
+    // each thread and friction properties go into a per-thread buffer.
+    const int propsStateVarsSize = _friction->propsStateVarsSize();
+    assert(propsStateVarsSize > 0);
+    scalar_array propsStateVarsVertex(propsStateVarsSize);
+
+    // Vertices that remain locked are only checked against the
+    // friction strength from the last full evaluation.
+    const bool useActiveSet = spaceDim > 1 && _activeSetMargin < 1.0;
+    _activeSetReset(t);
+
     const int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
+#if defined(THREADED_VERTEX_LOOPS)
+#pragma omp parallel for schedule(static) firstprivate(propsStateVarsVertex)
+#endif
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        // Vertex values; slip, slip rate, and tractions are in the
+        // fault coordinate system. The slip rate is not used in the
+        // lumped solve, so it is zero.
+        PylithScalar slipVertex[dim];
+        PylithScalar slipRateVertex[dim];
+        PylithScalar tractionTpdtVertex[dim];
+        PylithScalar dTractionTpdtVertex[dim];
+        PylithScalar dLagrangeTpdtVertex[dim];
+        PylithScalar dispIncrVertexN[dim];
+        PylithScalar dispIncrVertexP[dim];
+        PylithScalar lagrangeTIncrVertex[dim];
 
         // Skip clamped vertices
-        if (e_lagrange < 0) {
+        if (_cohesiveVertices[iVertex].lagrange < 0) {
             continue;
         } // if
 
@@ -1174,45 +1296,25 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         _logger->eventBegin(restrictEvent);
 #endif
 
-        // Get residual at cohesive cell's vertices.
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
-
-        // Get jacobian at cohesive cell's vertices.
-        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_negative));
-
-        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_positive));
-
-        // Get disp(t) at Lagrange vertex.
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t) at cohesive cell's vertices.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get relative displacement at fault vertex.
-        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+        // Offsets of residual, jacobian, disp(t), and dispIncr(t) at
+        // cohesive cell's vertices.
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        assert(noff == jacobianVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == residualVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+
+        // Offsets of relative displacement and fault orientation at fault vertex.
+        const PetscInt droff = offsetsFault[iVertex];
+        const PetscInt ooff = offsetsOrientation[iVertex];
+        assert(droff == dispRelVisitor.sectionOffset(v_fault));
+        assert(ooff == orientationVisitor.sectionOffset(v_fault));
 
         // Get area at fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-        const PetscScalar areaVertex = areaArray[aoff];
+        const PetscScalar areaVertex = areaArray[offsetsArea[iVertex]];
         assert(areaVertex > 0.0);
 
-        // Get fault orientation at fault vertex.
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(restrictEvent);
         _logger->eventBegin(computeEvent);
@@ -1221,47 +1323,52 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         // Adjust solution as in prescribed rupture, updating the Lagrange
         // multipliers and the corresponding displacment increments.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            assert(jacobianArray[jpoff+iDim] > 0.0);
-            assert(jacobianArray[jnoff+iDim] > 0.0);
-            const PylithScalar S = (1.0/jacobianArray[jpoff+iDim] + 1.0/jacobianArray[jnoff+iDim]) * areaVertex*areaVertex;
+            assert(jacobianArray[poff+iDim] > 0.0);
+            assert(jacobianArray[noff+iDim] > 0.0);
+            const PylithScalar S = (1.0/jacobianArray[poff+iDim] + 1.0/jacobianArray[noff+iDim]) * areaVertex*areaVertex;
             assert(S > 0.0);
-            lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[rloff+iDim] + areaVertex * (dispTIncrArray[dipoff+iDim] - dispTIncrArray[dinoff+iDim]));
-            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[jnoff+iDim]*lagrangeTIncrVertex[iDim];
-            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[jpoff+iDim]*lagrangeTIncrVertex[iDim];
+            lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[loff+iDim] + areaVertex * (dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim]));
+            dispIncrVertexN[iDim] =  areaVertex / jacobianArray[noff+iDim]*lagrangeTIncrVertex[iDim];
+            dispIncrVertexP[iDim] = -areaVertex / jacobianArray[poff+iDim]*lagrangeTIncrVertex[iDim];
         } // for
 
         // Compute slip, slip rate, and Lagrange multiplier at time t+dt
         // in fault coordinate system.
-        slipVertex = 0.0;
-        slipRateVertex = 0.0;
-        tractionTpdtVertex = 0.0;
+        PylithScalar tractionGlobal[dim];
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            for (int jDim=0; jDim < spaceDim; ++jDim) {
-                slipVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
-                tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[dtloff+jDim] + lagrangeTIncrVertex[jDim]);
-            } // for
+            slipRateVertex[iDim] = 0.0;
+            tractionGlobal[iDim] = dispTArray[loff+iDim] + lagrangeTIncrVertex[iDim];
         } // for
+        _rotateToFault<dim>(slipVertex, &orientationArray[ooff], &dispRelArray[droff]);
+        _rotateToFault<dim>(tractionTpdtVertex, &orientationArray[ooff], tractionGlobal);
           // Jacobian is diagonal and isotropic, so it is invariant with
           // respect to rotation and contains one unique term.
-        const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[jnoff+0] + 1.0 / jacobianArray[jpoff+0]));
+        const PylithScalar jacobianShearVertex = -1.0 / (areaVertex * (1.0 / jacobianArray[noff+0] + 1.0 / jacobianArray[poff+0]));
 
-        // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
-
-        // Use fault constitutive model to compute traction associated with
-        // friction.
-        dTractionTpdtVertex = 0.0;
-
-        const bool iterating = false; // No iteration for friction in lumped soln
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex, iterating);
-
-        // Rotate traction back to global coordinate system.
-        dLagrangeTpdtVertex = 0.0;
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            for (int jDim=0; jDim < spaceDim; ++jDim) {
-                dLagrangeTpdtVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * dTractionTpdtVertex[jDim];
-            } // for
+            dTractionTpdtVertex[iDim] = 0.0;
         } // for
+        if (useActiveSet && _activeSetIsLocked<dim>(iVertex, slipVertex, slipRateVertex, tractionTpdtVertex)) {
+            // Vertex remains locked, so no change in traction.
+        } else {
+            // Get friction properties and state variables.
+            _friction->retrievePropsStateVars(&propsStateVarsVertex[0], v_fault);
+
+            // Use fault constitutive model to compute traction associated with
+            // friction. Friction is evaluated per vertex rather than with the
+            // batch API, because the number of evaluations at a vertex depends
+            // on its state (none for open or locked vertices, several in the
+            // Newton iterations for sliding vertices).
+            const bool iterating = false; // No iteration for friction in lumped soln
+            _constrainSolnSpaceVertex<dim>(dTractionTpdtVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, &propsStateVarsVertex[0], jacobianShearVertex, iterating);
+
+            if (useActiveSet) {
+                _activeSetClassify<dim>(iVertex, t, slipVertex, slipRateVertex, tractionTpdtVertex, dTractionTpdtVertex, &propsStateVarsVertex[0]);
+            } // if
+        } // if/else
+
+        // Rotate traction back to global coordinate system.
+        _rotateToGlobal<dim>(dLagrangeTpdtVertex, &orientationArray[ooff], dTractionTpdtVertex);
 
 #if 0 // debugging
         std::cout << "dispIncrP: ";
@@ -1299,11 +1406,11 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
         // Compute change in displacement.
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            assert(jacobianArray[jpoff+iDim] > 0.0);
-            assert(jacobianArray[jnoff+iDim] > 0.0);
+            assert(jacobianArray[poff+iDim] > 0.0);
+            assert(jacobianArray[noff+iDim] > 0.0);
 
-            dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[jnoff+iDim];
-            dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[jpoff+iDim];
+            dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[noff+iDim];
+            dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[poff+iDim];
 
             // Update increment in Lagrange multiplier.
             lagrangeTIncrVertex[iDim] += dLagrangeTpdtVertex[iDim];
@@ -1316,21 +1423,13 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
         // Compute contribution to adjusting solution only if Lagrange
         // constraint is local (the adjustment is assembled across processors).
-        PetscInt goff;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff >= 0) {
-            const PetscInt dianoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-            const PetscInt diapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-            assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
+        if (offsetsLGlobal[iVertex] >= 0) {
             // Adjust displacements to account for Lagrange multiplier values
             // (assumed to be zero in preliminary solve).
             // Update displacement field
             for(PetscInt d = 0; d < spaceDim; ++d) {
-                dispTIncrAdjArray[dianoff+d] += dispIncrVertexN[d];
-                dispTIncrAdjArray[diapoff+d] += dispIncrVertexP[d];
+                dispTIncrAdjArray[noff+d] += dispIncrVertexN[d];
+                dispTIncrAdjArray[poff+d] += dispIncrVertexP[d];
             } // for
         } // if
 
@@ -1341,13 +1440,14 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         // Set Lagrange multiplier value. Value from preliminary solve is
         // bogus due to artificial diagonal entry in Jacobian of 1.0.
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            dispTIncrArray[diloff+d] = lagrangeTIncrVertex[d];
+            dispTIncrArray[loff+d] = lagrangeTIncrVertex[d];
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(updateEvent);
 #endif
     } // for
+    _friction->destroyPropsStateVarsVisitors();
     PetscLogFlops(numVertices*spaceDim*(17 + // adjust solve
                                         9 + // updates
                                         spaceDim*9));
@@ -1362,7 +1462,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 #endif
 
     PYLITH_METHOD_END;
-} // adjustSolnLumped
+} // _adjustSolnLumpedDim
 
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
@@ -1384,20 +1484,59 @@ pylith::faults::FaultCohesiveDyn::vertexField(const char* name,
 
     if (0 == strcasecmp("slip", name)) {
         const topology::Field& dispRel = _fields->get("relative disp");
-        _allocateBufferVectorField();
-        topology::Field& buffer =  _fields->get("buffer (vector)");
-        buffer.copy(dispRel);
-        buffer.label("slip");
-        FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+        const topology::Field* dependencies[2] = { &dispRel, &orientation };
+        topology::Field& buffer = _derivedBufferVectorField("slip");
+        if (!_isDerivedFieldCurrent("slip", dependencies, 2)) {
+            buffer.copy(dispRel);
+            buffer.label("slip");
+            FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+            _derivedFieldComputed("slip", dependencies, 2);
+        } // if
         PYLITH_METHOD_RETURN(buffer);
 
     } else if (0 == strcasecmp("slip_rate", name)) {
         const topology::Field& velRel = _fields->get("relative velocity");
-        _allocateBufferVectorField();
-        topology::Field& buffer = _fields->get("buffer (vector)");
-        buffer.copy(velRel);
-        buffer.label("slip_rate");
-        FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+        const topology::Field* dependencies[2] = { &velRel, &orientation };
+        topology::Field& buffer = _derivedBufferVectorField("slip_rate");
+        if (!_isDerivedFieldCurrent("slip_rate", dependencies, 2)) {
+            buffer.copy(velRel);
+            buffer.label("slip_rate");
+            FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+            _derivedFieldComputed("slip_rate", dependencies, 2);
+        } // if
+        PYLITH_METHOD_RETURN(buffer);
+
+    } else if (_ruptureMetrics && 0 == strcasecmp("final_slip", name)) {
+        const topology::Field& dispRel = _fields->get("relative disp");
+        const topology::Field* dependencies[2] = { &dispRel, &orientation };
+        topology::Field& buffer = _derivedBufferVectorField("final_slip");
+        if (!_isDerivedFieldCurrent("final_slip", dependencies, 2)) {
+            buffer.copy(dispRel);
+            buffer.label("final_slip");
+            FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+            _derivedFieldComputed("final_slip", dependencies, 2);
+        } // if
+        PYLITH_METHOD_RETURN(buffer);
+
+    } else if (_ruptureMetrics && 0 == strcasecmp("rupture_time", name)) {
+        _allocateBufferScalarField();
+        topology::Field& buffer = _fields->get("buffer (scalar)");
+        _getRuptureMetric(&buffer, _ruptureTime, _normalizer->timeScale());
+        buffer.label("rupture_time");
+        PYLITH_METHOD_RETURN(buffer);
+
+    } else if (_ruptureMetrics && 0 == strcasecmp("peak_slip_rate", name)) {
+        _allocateBufferScalarField();
+        topology::Field& buffer = _fields->get("buffer (scalar)");
+        _getRuptureMetric(&buffer, _peakSlipRate, _normalizer->lengthScale() / _normalizer->timeScale());
+        buffer.label("peak_slip_rate");
+        PYLITH_METHOD_RETURN(buffer);
+
+    } else if (_ruptureMetrics && 0 == strcasecmp("peak_slip_rate_time", name)) {
+        _allocateBufferScalarField();
+        topology::Field& buffer = _fields->get("buffer (scalar)");
+        _getRuptureMetric(&buffer, _peakSlipRateTime, _normalizer->timeScale());
+        buffer.label("peak_slip_rate_time");
         PYLITH_METHOD_RETURN(buffer);
 
     } else if (cohesiveDim > 0 && 0 == strcasecmp("strike_dir", name)) {
@@ -1421,9 +1560,12 @@ pylith::faults::FaultCohesiveDyn::vertexField(const char* name,
     } else if (0 == strcasecmp("traction", name)) {
         assert(fields);
         const topology::Field& dispT = fields->get("disp(t)");
-        _allocateBufferVectorField();
-        topology::Field& buffer = _fields->get("buffer (vector)");
-        _calcTractions(&buffer, dispT);
+        const topology::Field* dependencies[2] = { &dispT, &orientation };
+        topology::Field& buffer = _derivedBufferVectorField("traction");
+        if (!_isDerivedFieldCurrent("traction", dependencies, 2)) {
+            _calcTractions(&buffer, dispT);
+            _derivedFieldComputed("traction", dependencies, 2);
+        } // if
         PYLITH_METHOD_RETURN(buffer);
 
     } else if (_friction->hasPropStateVar(name)) {
@@ -1475,10 +1617,10 @@ pylith::faults::FaultCohesiveDyn::_calcTractions(topology::Field* tractions,
     const int spaceDim = _quadrature->spaceDim();
 
     // Get fields.
-    topology::VecVisitorMesh dispTVisitor(dispT);
+    topology::VecVisitorMesh dispTVisitor(dispT, 0, true);
     const PetscScalar* dispTArray = dispTVisitor.localArray();
 
-    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
+    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"), 0, true);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     // Allocate buffer for tractions field (if necessary).
@@ -1531,6 +1673,36 @@ pylith::faults::FaultCohesiveDyn::_calcTractions(topology::Field* tractions,
     PYLITH_METHOD_END;
 } // _calcTractions
 
+// ----------------------------------------------------------------------
+// Copy rupture metric at cohesive vertices into scalar field.
+void
+pylith::faults::FaultCohesiveDyn::_getRuptureMetric(topology::Field* field,
+                                                    const scalar_array& values,
+                                                    const PylithScalar scale)
+{ // _getRuptureMetric
+    PYLITH_METHOD_BEGIN;
+
+    assert(field);
+    assert(scale > 0.0);
+
+    field->zeroAll();
+    field->scale(scale);
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+
+    // Values that have not been set (rupture has not reached vertex)
+    // remain PYLITH_MAXSCALAR after dimensionalizing.
+    const int numVertices = _cohesiveVertices.size();
+    assert(size_t(numVertices) == values.size());
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const PetscInt off = fieldVisitor.sectionOffset(_cohesiveVertices[iVertex].fault);
+        assert(1 == fieldVisitor.sectionDof(_cohesiveVertices[iVertex].fault));
+        fieldArray[off] = (values[iVertex] < PYLITH_MAXSCALAR) ? values[iVertex] : PYLITH_MAXSCALAR / scale;
+    } // for
+
+    PYLITH_METHOD_END;
+} // _getRuptureMetric
+
 // ----------------------------------------------------------------------
 // Update relative displacement and velocity (slip and slip rate)
 // associated with Lagrange vertex k corresponding to diffential
@@ -1560,50 +1732,35 @@ pylith::faults::FaultCohesiveDyn::_updateRelMotion(const topology::SolutionField
     topology::VecVisitorMesh velRelVisitor(_fields->get("relative velocity"));
     PetscScalar* velRelArray = velRelVisitor.localArray();
 
+    // Displacement, displacement increment, and velocity share the
+    // layout of the solution; relative displacement and velocity share
+    // the layout of vector fields over the fault.
+    _updateCohesiveOffsets(fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
+        const PetscInt foff = offsetsFault[iVertex];
 
         // Skip clamped vertices
-        if (v_fault < 0) {
+        if (foff < 0) {
             continue;
         } // if
 
-        // Get displacement offsets.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        // Get velocity offsets.
-        const PetscInt vnoff = velocityVisitor.sectionOffset(v_negative);
-        assert(spaceDim == velocityVisitor.sectionDof(v_negative));
-
-        const PetscInt vpoff = velocityVisitor.sectionOffset(v_positive);
-        assert(spaceDim == velocityVisitor.sectionDof(v_positive));
-
-        // Relative displacement/velocity offsets.
-        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
-
-        const PetscInt vroff = velRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == velRelVisitor.sectionDof(v_fault));
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        assert(noff == velocityVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(foff == velRelVisitor.sectionOffset(_cohesiveVertices[iVertex].fault));
 
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            const PylithScalar dispValue = dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d];
-            dispRelArray[droff+d] = fabs(dispValue) > _zeroTolerance ? dispValue : 0.0;
+            const PylithScalar dispValue = dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d];
+            dispRelArray[foff+d] = fabs(dispValue) > _zeroTolerance ? dispValue : 0.0;
 
-            const PylithScalar velValue = velocityArray[vpoff+d] - velocityArray[vnoff+d];
-            velRelArray[vroff+d] = fabs(velValue) > _zeroTolerance ? velValue : 0.0;
+            const PylithScalar velValue = velocityArray[poff+d] - velocityArray[noff+d];
+            velRelArray[foff+d] = fabs(velValue) > _zeroTolerance ? velValue : 0.0;
         } // for
 
     } // for
@@ -1661,34 +1818,73 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySetup(const topology::Jacobian& ja
         _jacobian = new topology::Jacobian(solution, jacobian.matrixType());
     } // if
     assert(_jacobian);
-    _jacobian->zero();
+    if (_reuseSensitivityFactorization) {
+        // Matrices are only reassembled when the domain Jacobian changes.
+        if (!_jacobianPositive) {
+            _jacobianPositive = new topology::Jacobian(solution, jacobian.matrixType());
+        } // if
+    } else {
+        _jacobian->zero();
+    } // if/else
 
     // Setup PETSc KSP linear solver.
     if (!_ksp) {
-        PetscErrorCode err = 0;
-        err = KSPCreate(_faultMesh->comm(), &_ksp); PYLITH_CHECK_ERROR(err);
-        err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE); PYLITH_CHECK_ERROR(err);
-        PylithScalar rtol = 0.0;
-        PylithScalar atol = 0.0;
-        PylithScalar dtol = 0.0;
-        int maxIters = 0;
-        err = KSPGetTolerances(_ksp, &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
-        rtol = 1.0e-3*_zeroTolerance;
-        atol = 1.0e-5*_zeroTolerance;
-        err = KSPSetTolerances(_ksp, rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
-
-        PC pc;
-        err = KSPGetPC(_ksp, &pc); PYLITH_CHECK_ERROR(err);
-        err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
-        err = KSPSetType(_ksp, KSPGMRES); PYLITH_CHECK_ERROR(err);
-
-        err = KSPAppendOptionsPrefix(_ksp, "friction_"); PYLITH_CHECK_ERROR(err);
-        err = KSPSetFromOptions(_ksp); PYLITH_CHECK_ERROR(err);
+        _sensitivityCreateKSP(&_ksp);
+    } // if
+    if (_reuseSensitivityFactorization && !_kspPositive) {
+        _sensitivityCreateKSP(&_kspPositive);
     } // if
 
     PYLITH_METHOD_END;
 } // _sensitivitySetup
 
+// ----------------------------------------------------------------------
+// Create linear solver for sensitivity problem.
+void
+pylith::faults::FaultCohesiveDyn::_sensitivityCreateKSP(PetscKSP* ksp)
+{ // _sensitivityCreateKSP
+    PYLITH_METHOD_BEGIN;
+
+    assert(ksp);
+    assert(_faultMesh);
+
+    PetscErrorCode err = 0;
+    err = KSPCreate(_faultMesh->comm(), ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPSetInitialGuessNonzero(*ksp, PETSC_FALSE); PYLITH_CHECK_ERROR(err);
+    PylithScalar rtol = 0.0;
+    PylithScalar atol = 0.0;
+    PylithScalar dtol = 0.0;
+    int maxIters = 0;
+    err = KSPGetTolerances(*ksp, &rtol, &atol, &dtol, &maxIters); PYLITH_CHECK_ERROR(err);
+    rtol = 1.0e-3*_zeroTolerance;
+    atol = 1.0e-5*_zeroTolerance;
+    err = KSPSetTolerances(*ksp, rtol, atol, dtol, maxIters); PYLITH_CHECK_ERROR(err);
+
+    PC pc;
+    err = KSPGetPC(*ksp, &pc); PYLITH_CHECK_ERROR(err);
+    if (_reuseSensitivityFactorization) {
+        // Factorization is retained until the domain Jacobian changes,
+        // so a more expensive setup pays off.
+        int commSize = 1;
+        err = MPI_Comm_size(_faultMesh->comm(), &commSize); PYLITH_CHECK_ERROR(err);
+        if (1 == commSize) {
+            err = PCSetType(pc, PCLU); PYLITH_CHECK_ERROR(err);
+            err = KSPSetType(*ksp, KSPPREONLY); PYLITH_CHECK_ERROR(err);
+        } else {
+            err = PCSetType(pc, PCBJACOBI); PYLITH_CHECK_ERROR(err);
+            err = KSPSetType(*ksp, KSPGMRES); PYLITH_CHECK_ERROR(err);
+        } // if/else
+    } else {
+        err = PCSetType(pc, PCJACOBI); PYLITH_CHECK_ERROR(err);
+        err = KSPSetType(*ksp, KSPGMRES); PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    err = KSPAppendOptionsPrefix(*ksp, "friction_"); PYLITH_CHECK_ERROR(err);
+    err = KSPSetFromOptions(*ksp); PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _sensitivityCreateKSP
+
 // ----------------------------------------------------------------------
 // Update the Jacobian values for the sensitivity solve.
 void
@@ -1728,6 +1924,22 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     scalar_array jacobianSubCell(submatrixSize);
     const PetscMat jacobianDomainMatrix = jacobian.matrix(); assert(jacobianDomainMatrix);
 
+    // With a separate matrix for each side, the sensitivity Jacobian
+    // only changes when the domain Jacobian changes. Skipping the
+    // reassembly leaves the matrix state unchanged, so the KSP also
+    // keeps the existing factorization.
+    const int iSide = (negativeSide) ? 0 : 1;
+    topology::Jacobian* jacobianFault = (negativeSide || !_reuseSensitivityFactorization) ? _jacobian : _jacobianPositive;
+    assert(jacobianFault);
+    PetscObjectState jacobianDomainState = 0;
+    err = PetscObjectStateGet((PetscObject)jacobianDomainMatrix, &jacobianDomainState); PYLITH_CHECK_ERROR(err);
+    if (_reuseSensitivityFactorization) {
+        if (_jacobianDomainMat[iSide] == jacobianDomainMatrix && _jacobianDomainState[iSide] == jacobianDomainState) {
+            PYLITH_METHOD_END;
+        } // if
+        jacobianFault->zero();
+    } // if
+
     // Get fault mesh
     PetscDM faultDMMesh = _faultMesh->dmMesh(); assert(faultDMMesh);
 
@@ -1735,8 +1947,7 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     PetscSection solutionFaultSection = _fields->get("sensitivity solution").localSection(); assert(solutionFaultSection);
     PetscVec solutionFaultVec = _fields->get("sensitivity solution").localVector(); assert(solutionFaultVec);
     PetscSection solutionFaultGlobalSection = _fields->get("sensitivity solution").globalSection(); assert(solutionFaultGlobalSection);
-    assert(_jacobian);
-    const PetscMat jacobianFaultMatrix = _jacobian->matrix(); assert(jacobianFaultMatrix);
+    const PetscMat jacobianFaultMatrix = jacobianFault->matrix(); assert(jacobianFaultMatrix);
 
     const int iCone = (negativeSide) ? 0 : 1;
 
@@ -1828,13 +2039,15 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateJacobian(const bool negative
     err = MatDestroySubMatrices(numCohesiveCells, &submatrices); PYLITH_CHECK_ERROR(err);
     delete[] cellsIS; cellsIS = 0;
 
-    _jacobian->assemble("final_assembly");
+    jacobianFault->assemble("final_assembly");
+    _jacobianDomainMat[iSide] = jacobianDomainMatrix;
+    _jacobianDomainState[iSide] = jacobianDomainState;
 
 #if 0 // DEBUGGING
       //std::cout << "DOMAIN JACOBIAN" << std::endl;
       //jacobian.view();
     std::cout << "SENSITIVITY JACOBIAN" << std::endl;
-    _jacobian->view();
+    jacobianFault->view();
 #endif
 
     PYLITH_METHOD_END;
@@ -1932,13 +2145,17 @@ pylith::faults::FaultCohesiveDyn::_sensitivityReformResidual(const bool negative
 // ----------------------------------------------------------------------
 // Solve sensitivity problem.
 void
-pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
+pylith::faults::FaultCohesiveDyn::_sensitivitySolve(const bool negativeSide)
 { // _sensitivitySolve
     PYLITH_METHOD_BEGIN;
 
     assert(_fields);
-    assert(_jacobian);
-    assert(_ksp);
+
+    const bool separateSides = _reuseSensitivityFactorization && !negativeSide;
+    topology::Jacobian* jacobianFault = (separateSides) ? _jacobianPositive : _jacobian;
+    PetscKSP ksp = (separateSides) ? _kspPositive : _ksp;
+    assert(jacobianFault);
+    assert(ksp);
 
     topology::Field& residual = _fields->get("sensitivity residual");
     topology::Field& solution = _fields->get("sensitivity solution");
@@ -1950,12 +2167,12 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
     residual.scatterLocalToGlobal();
 
     PetscErrorCode err = 0;
-    const PetscMat jacobianMat = _jacobian->matrix();
-    err = KSPSetOperators(_ksp, jacobianMat, jacobianMat); PYLITH_CHECK_ERROR(err);
+    const PetscMat jacobianMat = jacobianFault->matrix();
+    err = KSPSetOperators(ksp, jacobianMat, jacobianMat); PYLITH_CHECK_ERROR(err);
 
     const PetscVec residualVec = residual.globalVector();
     const PetscVec solutionVec = solution.globalVector();
-    err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
 
     // Update section view of field.
     solution.scatterGlobalToLocal();
@@ -2034,6 +2251,7 @@ pylith::faults::FaultCohesiveDyn::_sensitivityUpdateSoln(const bool negativeSide
 // this in a line search to find a good update (required because
 // fault constitutive model may have a complex nonlinear feedback
 // with deformation).
+template<int dim>
 PylithScalar
 pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alpha,
                                                           const PylithScalar t,
@@ -2041,50 +2259,15 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
 { // _constrainSolnSpaceNorm
     PYLITH_METHOD_BEGIN;
 
-    /// Member prototype for _constrainSolnSpaceXD()
-    typedef void (pylith::faults::FaultCohesiveDyn::*constrainSolnSpace_fn_type)
-        (scalar_array*,
-        const PylithScalar,
-        const scalar_array&,
-        const scalar_array&,
-        const scalar_array&,
-        const PylithScalar,
-        const bool);
-
     // Update time step in friction (can vary).
     _friction->timeStep(_dt);
     const PylithScalar dt = _dt;
 
-    const int spaceDim = _quadrature->spaceDim();
+    const int spaceDim = dim;
     const int indexN = spaceDim - 1;
     PetscErrorCode err;
 
-    constrainSolnSpace_fn_type constrainSolnSpaceFn;
-    switch (spaceDim) { // switch
-    case 1:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D;
-        break;
-    case 2:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D;
-        break;
-    case 3:
-        constrainSolnSpaceFn =
-            &pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D;
-        break;
-    default:
-        assert(0);
-        throw std::logic_error("Unknown spatial dimension in "
-                               "FaultCohesiveDyn::constrainSolnSpace().");
-    } // switch
-
     // Get fields
-    scalar_array slipTpdtVertex(spaceDim); // fault coordinates
-    scalar_array slipRateVertex(spaceDim); // fault coordinates
-    scalar_array tractionTpdtVertex(spaceDim); // fault coordinates
-    scalar_array tractionMisfitVertex(spaceDim); // fault coordinates
-
     topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
@@ -2100,77 +2283,79 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     topology::Field& dispTIncr = fields->get("dispIncr(t->t+dt)");
     topology::VecVisitorMesh dispTIncrVisitor(dispTIncr);
     const PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
-    PetscSection dispTIncrGlobalSection = dispTIncr.globalSection(); assert(dispTIncrGlobalSection);
+
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+    const int_array& offsetsOrientation = _cohesiveOffsets.orientation;
+
+    // Work arrays are private to each thread; misfit and opening are
+    // reduced over threads.
+    const int propsStateVarsSize = _friction->propsStateVarsSize();
+    assert(propsStateVarsSize > 0);
+    scalar_array propsStateVarsVertex(propsStateVarsSize);
 
     bool isOpening = false;
     PylithScalar norm2 = 0.0;
     int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
+#if defined(THREADED_VERTEX_LOOPS)
+#pragma omp parallel for schedule(static) firstprivate(propsStateVarsVertex) reduction(+:norm2) reduction(||:isOpening)
+#endif
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
 
-        // Skip clamped vertices
-        if (e_lagrange < 0) {
-            continue;
-        } // if
+        // Vertex values in fault coordinate system.
+        PylithScalar slipTpdtVertex[dim];
+        PylithScalar slipRateVertex[dim];
+        PylithScalar tractionTpdtVertex[dim];
+        PylithScalar tractionMisfitVertex[dim];
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff;
-        err = PetscSectionGetOffset(dispTIncrGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
+        // Skip clamped vertices and compute contribution only if
+        // Lagrange constraint is local.
+        if (offsetsLGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Get displacement values
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get displacement increment values.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Get orientation
-        const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
-        assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
-
-        // Get change in relative displacement from sensitivity solve.
-        const PetscInt sdroff = sensDispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == sensDispRelVisitor.sectionDof(v_fault));
-
-        const PetscInt sdloff = dLagrangeVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dLagrangeVisitor.sectionDof(v_fault));
+        // Get offsets of displacement, displacement increment, and orientation.
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        const PetscInt ooff = offsetsOrientation[iVertex];
+        assert(noff == dispTVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+        assert(ooff == orientationVisitor.sectionOffset(v_fault));
+
+        // Get change in relative displacement and Lagrange multiplier
+        // from sensitivity solve.
+        const PetscInt foff = offsetsFault[iVertex];
+        assert(foff == sensDispRelVisitor.sectionOffset(v_fault));
+        assert(foff == dLagrangeVisitor.sectionOffset(v_fault));
 
         // Compute slip, slip rate, and traction at time t+dt as part of
         // line search.
-        slipTpdtVertex = 0.0;
-        slipRateVertex = 0.0;
-        tractionTpdtVertex = 0.0;
+        PylithScalar slipGlobal[dim];
+        PylithScalar slipRateGlobal[dim];
+        PylithScalar tractionGlobal[dim];
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            for(PetscInt e = 0; e < spaceDim; ++e) {
-                slipTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtpoff+e] + dispTIncrArray[dipoff+e] - dispTArray[dtnoff+e] - dispTIncrArray[dinoff+e] + alpha*sensDispRelArray[sdroff+e]);
-                slipRateVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTIncrArray[dipoff+e] - dispTIncrArray[dinoff+e] + alpha*sensDispRelArray[sdroff+e]) / dt;
-                tractionTpdtVertex[d] += orientationArray[ooff+d*spaceDim+e] * (dispTArray[dtloff+e] + dispTIncrArray[diloff+e] + alpha*dLagrangeArray[sdloff+e]);
-            } // for
+            slipGlobal[d] = dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d] + alpha*sensDispRelArray[foff+d];
+            slipRateGlobal[d] = (dispTIncrArray[poff+d] - dispTIncrArray[noff+d] + alpha*sensDispRelArray[foff+d]) / dt;
+            tractionGlobal[d] = dispTArray[loff+d] + dispTIncrArray[loff+d] + alpha*dLagrangeArray[foff+d];
+        } // for
+        _rotateToFault<dim>(slipTpdtVertex, &orientationArray[ooff], slipGlobal);
+        _rotateToFault<dim>(slipRateVertex, &orientationArray[ooff], slipRateGlobal);
+        _rotateToFault<dim>(tractionTpdtVertex, &orientationArray[ooff], tractionGlobal);
 #if !defined(DISABLE_SLIPRATE_TOLERANCE) // 2017-06-23  Is this really necessary?
+        for(PetscInt d = 0; d < spaceDim; ++d) {
             if (fabs(slipRateVertex[d]) < _zeroTolerance / dt) {
                 slipRateVertex[d] = 0.0;
             } // if
-#endif
         } // for
+#endif
         if (fabs(slipTpdtVertex[indexN]) < _zeroToleranceNormal) {
             slipTpdtVertex[indexN] = 0.0;
         } // if
@@ -2217,16 +2402,18 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         // system.
 
         // Get friction properties and state variables.
-        _friction->retrievePropsStateVars(v_fault);
+        _friction->retrievePropsStateVars(&propsStateVarsVertex[0], v_fault);
 
         // Use fault constitutive model to compute traction associated with
         // friction.
-        tractionMisfitVertex = 0.0;
+        for(PetscInt d = 0; d < spaceDim; ++d) {
+            tractionMisfitVertex[d] = 0.0;
+        } // for
         const PylithScalar jacobianShearVertex = 0.0;
         const bool iterating = true; // Iterating to get friction
-        CALL_MEMBER_FN(*this, constrainSolnSpaceFn) (&tractionMisfitVertex, t,
-                                                     slipTpdtVertex, slipRateVertex, tractionTpdtVertex, jacobianShearVertex,
-                                                     iterating);
+        _constrainSolnSpaceVertex<dim>(tractionMisfitVertex, t,
+                                       slipTpdtVertex, slipRateVertex, tractionTpdtVertex, &propsStateVarsVertex[0],
+                                       jacobianShearVertex, iterating);
 
 #if 0 // DEBUGGING
         std::cout << "alpha: " << alpha
@@ -2245,7 +2432,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
         } // for
         std::cout << ", dDispRel:";
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            std::cout << " " << sensDispRelArray[sdroff+iDim];
+            std::cout << " " << sensDispRelArray[foff+iDim];
         } // for
         std::cout << std::endl;
 #endif
@@ -2254,6 +2441,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
             norm2 += tractionMisfitVertex[d]*tractionMisfitVertex[d];
         } // for
     } // for
+    _friction->destroyPropsStateVarsVisitors();
 
     if (isOpening && alpha < 1.0) {
         norm2 = PYLITH_MAXFLOAT;
@@ -2269,14 +2457,155 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
 } // _constrainSolnSpaceNorm
 
 
+// ----------------------------------------------------------------------
+// Reset active set if friction strength of locked vertices may have
+// decreased since it was computed.
+void
+pylith::faults::FaultCohesiveDyn::_activeSetReset(const PylithScalar t)
+{ // _activeSetReset
+    assert(_friction);
+
+    const size_t numVertices = _cohesiveVertices.size();
+    if (_activeSetStatus.size() != numVertices) {
+        _activeSetStatus.resize(numVertices);
+        _activeSetStatus = int(VERTEX_UNKNOWN);
+        _activeSetStrength.resize(numVertices);
+        _activeSetNormal.resize(numVertices);
+    } else if (t != _activeSetTime && !_friction->lockedStrengthNondecreasing()) {
+        _activeSetStatus = int(VERTEX_UNKNOWN);
+    } // if/else
+    _activeSetTime = t;
+} // _activeSetReset
+
+// ----------------------------------------------------------------------
+// Check whether vertex remains locked without evaluating the friction
+// model.
+template<int dim>
+bool
+pylith::faults::FaultCohesiveDyn::_activeSetIsLocked(const int iVertex,
+                                                     const PylithScalar* slip,
+                                                     const PylithScalar* slipRate,
+                                                     const PylithScalar* tractionTpdt) const
+{ // _activeSetIsLocked
+    assert(iVertex >= 0 && size_t(iVertex) < _activeSetStatus.size());
+
+    if (VERTEX_LOCKED != _activeSetStatus[iVertex]) {
+        return false;
+    } // if
+
+    const int indexN = dim - 1;
+    const PylithScalar tractionNormal = tractionTpdt[indexN];
+    if (fabs(slip[indexN]) >= _zeroToleranceNormal || tractionNormal >= -_zeroTolerance) {
+        return false;
+    } // if
+
+    PylithScalar tractionShearMag2 = 0.0;
+    for (int iDim=0; iDim < indexN; ++iDim) {
+        if (slipRate[iDim] != 0.0) {
+            return false;
+        } // if
+        tractionShearMag2 += tractionTpdt[iDim]*tractionTpdt[iDim];
+    } // for
+
+    // Friction strength decreases at most in proportion to the
+    // magnitude of the normal traction (nonnegative cohesion).
+    const PylithScalar normalRatio = std::min(PylithScalar(1.0), tractionNormal / _activeSetNormal[iVertex]);
+    const PylithScalar strength = (1.0 - _activeSetMargin) * normalRatio * _activeSetStrength[iVertex];
+
+    PetscLogFlops(4 + 2*indexN);
+
+    return strength > 0.0 && tractionShearMag2 <= strength*strength;
+} // _activeSetIsLocked
+
+// ----------------------------------------------------------------------
+// Classify vertex after evaluating the friction criterion and save
+// the friction strength of locked vertices.
+template<int dim>
+void
+pylith::faults::FaultCohesiveDyn::_activeSetClassify(const int iVertex,
+                                                     const PylithScalar t,
+                                                     const PylithScalar* slip,
+                                                     const PylithScalar* slipRate,
+                                                     const PylithScalar* tractionTpdt,
+                                                     const PylithScalar* dTractionTpdt,
+                                                     const PylithScalar* propsStateVars)
+{ // _activeSetClassify
+    assert(iVertex >= 0 && size_t(iVertex) < _activeSetStatus.size());
+    assert(_friction);
+
+    const int spaceDim = dim;
+    const int indexN = spaceDim - 1;
+    const PylithScalar tractionNormal = tractionTpdt[indexN];
+    if (fabs(slip[indexN]) >= _zeroToleranceNormal || tractionNormal >= -_zeroTolerance) {
+        _activeSetStatus[iVertex] = VERTEX_OPEN;
+        return;
+    } // if
+
+    PylithScalar slipMag2 = 0.0;
+    PylithScalar slipRateMag2 = 0.0;
+    for (int iDim=0; iDim < indexN; ++iDim) {
+        slipMag2 += slip[iDim]*slip[iDim];
+        slipRateMag2 += slipRate[iDim]*slipRate[iDim];
+    } // for
+    bool tractionChanged = false;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+        if (dTractionTpdt[iDim] != 0.0) {
+            tractionChanged = true;
+            break;
+        } // if
+    } // for
+    if (tractionChanged || slipRateMag2 > 0.0) {
+        _activeSetStatus[iVertex] = VERTEX_SLIDING;
+        return;
+    } // if
+
+    _activeSetStrength[iVertex] = _friction->calcFriction(t, sqrt(slipMag2), 0.0, tractionNormal, propsStateVars);
+    _activeSetNormal[iVertex] = tractionNormal;
+    _activeSetStatus[iVertex] = VERTEX_LOCKED;
+
+    PetscLogFlops(1 + 4*indexN);
+} // _activeSetClassify
+
+// ----------------------------------------------------------------------
+// Apply friction criterion at a vertex.
+template<int dim>
+void
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceVertex(PylithScalar* dTractionTpdt,
+                                                            const PylithScalar t,
+                                                            const PylithScalar* slip,
+                                                            const PylithScalar* slipRate,
+                                                            const PylithScalar* tractionTpdt,
+                                                            const PylithScalar* propsStateVars,
+                                                            const PylithScalar jacobianShear,
+                                                            const bool iterating)
+{ // _constrainSolnSpaceVertex
+    // Spatial dimension is known at compile time, so the switch is
+    // resolved by the compiler.
+    switch (dim) { // switch
+    case 1:
+        _constrainSolnSpace1D(dTractionTpdt, t, slip, slipRate, tractionTpdt, propsStateVars, jacobianShear, iterating);
+        break;
+    case 2:
+        _constrainSolnSpace2D(dTractionTpdt, t, slip, slipRate, tractionTpdt, propsStateVars, jacobianShear, iterating);
+        break;
+    case 3:
+        _constrainSolnSpace3D(dTractionTpdt, t, slip, slipRate, tractionTpdt, propsStateVars, jacobianShear, iterating);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::_constrainSolnSpaceVertex().");
+    } // switch
+} // _constrainSolnSpaceVertex
+
 // ----------------------------------------------------------------------
 // Constrain solution space in 1-D.
 void
-pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionTpdt,
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(PylithScalar* dTractionTpdt,
                                                         const PylithScalar t,
-                                                        const scalar_array& slip,
-                                                        const scalar_array& sliprate,
-                                                        const scalar_array& tractionTpdt,
+                                                        const PylithScalar* slip,
+                                                        const PylithScalar* sliprate,
+                                                        const PylithScalar* tractionTpdt,
+                                                        const PylithScalar* propsStateVars,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace1D
@@ -2288,7 +2617,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionT
         // if tension, then traction is zero.
 
         const PylithScalar dlp = -tractionTpdt[0];
-        (*dTractionTpdt)[0] = dlp;
+        dTractionTpdt[0] = dlp;
     } // else
 
     PetscLogFlops(2);
@@ -2297,11 +2626,12 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace1D(scalar_array* dTractionT
 // ----------------------------------------------------------------------
 // Constrain solution space in 2-D.
 void
-pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionTpdt,
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(PylithScalar* dTractionTpdt,
                                                         const PylithScalar t,
-                                                        const scalar_array& slip,
-                                                        const scalar_array& slipRate,
-                                                        const scalar_array& tractionTpdt,
+                                                        const PylithScalar* slip,
+                                                        const PylithScalar* slipRate,
+                                                        const PylithScalar* tractionTpdt,
+                                                        const PylithScalar* propsStateVars,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace2D
@@ -2315,7 +2645,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 
     if (fabs(slip[1]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal, propsStateVars);
 
         if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
@@ -2332,7 +2662,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                     PylithScalar tractionShearMagCur = tractionShearMag;
                     const PylithScalar slipMag0 = fabs(slip[0] - slipRate[0] * _dt);
                     for (int iter=0; iter < maxiter; ++iter) {
-                        const PylithScalar frictionDeriv = _friction->calcFrictionDeriv(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        const PylithScalar frictionDeriv = _friction->calcFrictionDeriv(t, slipMagCur, slipRateMagCur, tractionNormal, propsStateVars);
                         slipMag = slipMagCur;
                         if (slipMag > 0.0) {
                             // Use Newton (in log slip space) to get better update in slip & traction.
@@ -2345,7 +2675,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                         } // if
                         tractionShearMagCur += (slipMagCur - slipMag) * jacobianShear;
                         slipRateMagCur = (slipMagCur - slipMag0) / _dt;
-                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal, propsStateVars);
                         if (fabs(tractionShearMagCur - frictionStress) < _zeroTolerance) {
                             break;
                         } // if
@@ -2356,7 +2686,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
                 // Update traction increment based on value required to stick
                 // versus friction
                 const PylithScalar dlp = -(tractionShearMag - frictionStress) * tractionTpdt[0] / tractionShearMag;
-                (*dTractionTpdt)[0] = dlp;
+                dTractionTpdt[0] = dlp;
             } else {
                 // No shear stress and no friction.
             } // if/else
@@ -2369,8 +2699,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
         } // if/else
     } else {
         // if in tension, then traction is zero.
-        (*dTractionTpdt)[0] = -tractionTpdt[0];
-        (*dTractionTpdt)[1] = -tractionTpdt[1];
+        dTractionTpdt[0] = -tractionTpdt[0];
+        dTractionTpdt[1] = -tractionTpdt[1];
     } // else
 
     PetscLogFlops(8);
@@ -2379,11 +2709,12 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace2D(scalar_array* dTractionT
 // ----------------------------------------------------------------------
 // Constrain solution space in 3-D.
 void
-pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionTpdt,
+pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(PylithScalar* dTractionTpdt,
                                                         const PylithScalar t,
-                                                        const scalar_array& slip,
-                                                        const scalar_array& slipRate,
-                                                        const scalar_array& tractionTpdt,
+                                                        const PylithScalar* slip,
+                                                        const PylithScalar* slipRate,
+                                                        const PylithScalar* tractionTpdt,
+                                                        const PylithScalar* propsStateVars,
                                                         const PylithScalar jacobianShear,
                                                         const bool iterating)
 { // _constrainSolnSpace3D
@@ -2397,7 +2728,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
 
     if (fabs(slip[2]) < _zeroToleranceNormal && tractionNormal < -_zeroTolerance) {
         // if in compression and no opening
-        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal);
+        PylithScalar frictionStress = _friction->calcFriction(t, slipMag, slipRateMag, tractionNormal, propsStateVars);
 
         if (tractionShearMag > frictionStress || (iterating && slipRateMag > 0.0)) {
             // traction is limited by friction, so have sliding OR
@@ -2414,7 +2745,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                     PylithScalar tractionShearMagCur = tractionShearMag;
                     const PylithScalar slipMag0 = sqrt(pow(slip[0]-slipRate[0]*_dt, 2) + pow(slip[1]-slipRate[1]*_dt, 2));
                     for (int iter=0; iter < maxiter; ++iter) {
-                        const PylithScalar frictionDeriv = _friction->calcFrictionDeriv(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        const PylithScalar frictionDeriv = _friction->calcFrictionDeriv(t, slipMagCur, slipRateMagCur, tractionNormal, propsStateVars);
                         slipMag = slipMagCur;
                         if (slipMag > 0.0) {
                             // Use Newton (in log slip space) to get better update in slip & traction.
@@ -2427,7 +2758,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                         } // if
                         tractionShearMagCur += (slipMagCur - slipMag) * jacobianShear;
                         slipRateMagCur = (slipMagCur - slipMag0) / _dt;
-                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal);
+                        frictionStress = _friction->calcFriction(t, slipMagCur, slipRateMagCur, tractionNormal, propsStateVars);
                         if (fabs(tractionShearMagCur - frictionStress) < _zeroTolerance) {
                             break;
                         } // if
@@ -2440,8 +2771,8 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
                 const PylithScalar dlp = -(tractionShearMag - frictionStress) * tractionTpdt[0] / tractionShearMag;
                 const PylithScalar dlq = -(tractionShearMag - frictionStress) * tractionTpdt[1] / tractionShearMag;
 
-                (*dTractionTpdt)[0] = dlp;
-                (*dTractionTpdt)[1] = dlq;
+                dTractionTpdt[0] = dlp;
+                dTractionTpdt[1] = dlq;
             } else {
                 // No shear stress and no friction.
             } // if/else
@@ -2455,9 +2786,9 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpace3D(scalar_array* dTractionT
         } // if/else
     } else {
         // if in tension, then traction is zero.
-        (*dTractionTpdt)[0] = -tractionTpdt[0];
-        (*dTractionTpdt)[1] = -tractionTpdt[1];
-        (*dTractionTpdt)[2] = -tractionTpdt[2];
+        dTractionTpdt[0] = -tractionTpdt[0];
+        dTractionTpdt[1] = -tractionTpdt[1];
+        dTractionTpdt[2] = -tractionTpdt[2];
     } // else
 
     PetscLogFlops(22);
@@ -89,6 +89,57 @@ public :
    */
   void openFreeSurf(const bool value);
 
+  /** Set flag for reusing the factorization (preconditioner setup) of
+   * the sensitivity problem.
+   *
+   * If true, the negative and positive sides of the fault use separate
+   * sparse matrices and solvers that persist for the whole run. The
+   * matrices are only reassembled, and the preconditioner numerically
+   * refactored (reusing the symbolic factorization), when the
+   * Jacobian of the domain changes. The default solver is a direct LU
+   * factorization in serial and GMRES with block Jacobi/ILU in
+   * parallel; both can be changed via the 'friction_' PETSc options.
+   *
+   * @param value True to reuse factorization, false otherwise.
+   */
+  void reuseSensitivityFactorization(const bool value);
+
+  /** Set margin below the friction strength for treating locked
+   * vertices as inactive.
+   *
+   * Vertices that are locked are only rechecked against the friction
+   * strength from the last full evaluation, reduced by this fraction,
+   * until they fail the check. A value of 1.0 (default) disables the
+   * active set.
+   *
+   * The active set only skips evaluating the friction model. The
+   * sensitivity solve and the update of the slip always include all
+   * vertices, because the elastic coupling changes the slip at
+   * inactive vertices too; they are skipped only when the Lagrange
+   * multipliers do not change at any vertex.
+   *
+   * @param value Margin as a fraction of the friction strength [0,1].
+   */
+  void activeSetMargin(const PylithScalar value);
+
+  /** Set flag for accumulating rupture metrics (rupture time, peak
+   * slip rate, and time of peak slip rate) at each fault vertex.
+   *
+   * The metrics are updated at the end of each time step and are
+   * available as vertex fields 'rupture_time', 'peak_slip_rate',
+   * 'peak_slip_rate_time', and 'final_slip'. Vertices that have not
+   * ruptured have a rupture time of PYLITH_MAXSCALAR.
+   *
+   * @param value True to accumulate rupture metrics, false otherwise.
+   */
+  void ruptureMetrics(const bool value);
+
+  /** Set threshold for slip rate defining the rupture time.
+   *
+   * @param value Nondimensional slip rate (>= 0).
+   */
+  void ruptureSlipRateThreshold(const PylithScalar value);
+
   /** Initialize fault. Determine orientation and setup boundary
    * condition parameters.
    *
@@ -154,6 +205,17 @@ public :
   const topology::Field& vertexField(const char* name,
 				     const topology::SolutionFields* fields =0);
 
+  // PRIVATE ENUMS //////////////////////////////////////////////////////
+private :
+
+  /// Status of cohesive vertices with respect to the friction criterion.
+  enum VertexStatusEnum {
+    VERTEX_UNKNOWN=0, ///< Friction criterion must be evaluated.
+    VERTEX_LOCKED=1, ///< In compression with shear traction below friction.
+    VERTEX_SLIDING=2, ///< In compression with shear traction limited by friction.
+    VERTEX_OPEN=3, ///< Fault is open or in tension.
+  }; // VertexStatusEnum
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -165,6 +227,16 @@ private :
   void _calcTractions(topology::Field* tractions,
           const topology::Field& solution);
 
+  /** Copy rupture metric at cohesive vertices into scalar field.
+   *
+   * @param field Scalar field over fault.
+   * @param values Values of metric at cohesive vertices.
+   * @param scale Scale for dimensionalizing metric.
+   */
+  void _getRuptureMetric(topology::Field* field,
+                         const scalar_array& values,
+                         const PylithScalar scale);
+
   /** Update relative displacement and velocity associated with
    * Lagrange vertex k corresponding to diffential velocity between
    * conventional vertices i and j.
@@ -200,8 +272,19 @@ private :
    */
   void _sensitivityReformResidual(const bool negativeSide);
 
-  /// Solve sensitivity problem.
-  void _sensitivitySolve(void);
+  /** Solve sensitivity problem.
+   *
+   * @param negativeSide True if solving sensitivity problem for
+   * negative side of the fault, false if solving sensitivity problem
+   * for positive side of the fault.
+   */
+  void _sensitivitySolve(const bool negativeSide);
+
+  /** Create linear solver for sensitivity problem.
+   *
+   * @param ksp PETSc linear solver.
+   */
+  void _sensitivityCreateKSP(PetscKSP* ksp);
 
   /** Update the solution (displacement increment) values based on
    * the sensitivity solve.
@@ -224,10 +307,58 @@ private :
    *
    * @returns L2 norm of residual.
    */
+  template<int dim>
   PylithScalar _constrainSolnSpaceNorm(const PylithScalar alpha,
 				       const PylithScalar t,
 				       topology::SolutionFields* const fields);
 
+  /** Constrain solution space based on friction with the spatial
+   * dimension known at compile time.
+   *
+   * @param fields Solution fields.
+   * @param t Current time.
+   * @param jacobian Sparse matrix for system Jacobian.
+   */
+  template<int dim>
+  void _constrainSolnSpaceDim(topology::SolutionFields* const fields,
+			      const PylithScalar t,
+			      const topology::Jacobian& jacobian);
+
+  /** Adjust solution from solver with lumped Jacobian to match
+   * Lagrange multiplier constraints with the spatial dimension known
+   * at compile time.
+   *
+   * @param fields Solution fields.
+   * @param t Current time.
+   * @param jacobian Jacobian of the system.
+   */
+  template<int dim>
+  void _adjustSolnLumpedDim(topology::SolutionFields* fields,
+			    const PylithScalar t,
+			    const topology::Field& jacobian);
+
+  /** Apply friction criterion at a vertex using _constrainSolnSpace1D(),
+   * _constrainSolnSpace2D(), or _constrainSolnSpace3D().
+   *
+   * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
+   * @param t Current time.
+   * @param slip Slip assoc. w/Lagrange multiplier vertex.
+   * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
+   * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param propsStateVars Friction properties and state variables at vertex.
+   * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
+   * @param iterating True if iterating on solution.
+   */
+  template<int dim>
+  void _constrainSolnSpaceVertex(PylithScalar* dLagrangeTpdt,
+				 const PylithScalar t,
+				 const PylithScalar* slip,
+				 const PylithScalar* slipRate,
+				 const PylithScalar* tractionTpdt,
+				 const PylithScalar* propsStateVars,
+				 const PylithScalar jacobianShear,
+				 const bool iterating);
+
   /** Constrain solution space in 1-D.
    *
    * @param dLagrangeTpdt Adjustment to Lagrange multiplier.
@@ -235,14 +366,16 @@ private :
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param propsStateVars Friction properties and state variables at vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
-  void _constrainSolnSpace1D(scalar_array* dLagrangeTpdt,
+  void _constrainSolnSpace1D(PylithScalar* dLagrangeTpdt,
 			     const PylithScalar t,
-			     const scalar_array& slip,
-			     const scalar_array& slipRate,
-			     const scalar_array& tractionTpdt,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* tractionTpdt,
+			     const PylithScalar* propsStateVars,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
@@ -253,14 +386,16 @@ private :
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param propsStateVars Friction properties and state variables at vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
-  void _constrainSolnSpace2D(scalar_array* dLagrangeTpdt,
+  void _constrainSolnSpace2D(PylithScalar* dLagrangeTpdt,
 			     const PylithScalar t,
-			     const scalar_array& slip,
-			     const scalar_array& slipRate,
-			     const scalar_array& tractionTpdt,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* tractionTpdt,
+			     const PylithScalar* propsStateVars,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
@@ -271,17 +406,63 @@ private :
    * @param slip Slip assoc. w/Lagrange multiplier vertex.
    * @param slipRate Slip rate assoc. w/Lagrange multiplier vertex.
    * @param tractionTpdt Fault traction assoc. w/Lagrange multiplier vertex.
+   * @param propsStateVars Friction properties and state variables at vertex.
    * @param jacobianShear Derivative of shear traction with respect to slip (elasticity).
    * @param iterating True if iterating on solution.
    */
-  void _constrainSolnSpace3D(scalar_array* dLagrangeTpdt,
+  void _constrainSolnSpace3D(PylithScalar* dLagrangeTpdt,
 			     const PylithScalar t,
-			     const scalar_array& slip,
-			     const scalar_array& slipRate,
-			     const scalar_array& tractionTpdt,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* tractionTpdt,
+			     const PylithScalar* propsStateVars,
 			     const PylithScalar jacobianShear,
 			     const bool iterating =true);
 
+  /** Reset active set if the friction strength of locked vertices
+   * may have decreased since it was computed.
+   *
+   * @param t Current time.
+   */
+  void _activeSetReset(const PylithScalar t);
+
+  /** Check whether vertex remains locked without evaluating the
+   * friction model.
+   *
+   * @param iVertex Index of cohesive vertex.
+   * @param slip Slip in fault coordinate system.
+   * @param slipRate Slip rate in fault coordinate system.
+   * @param tractionTpdt Fault traction in fault coordinate system.
+   *
+   * @returns True if vertex is locked, false if the friction
+   * criterion must be evaluated.
+   */
+  template<int dim>
+  bool _activeSetIsLocked(const int iVertex,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* tractionTpdt) const;
+
+  /** Classify vertex after evaluating the friction criterion and
+   * save the friction strength of locked vertices.
+   *
+   * @param iVertex Index of cohesive vertex.
+   * @param t Current time.
+   * @param slip Slip in fault coordinate system.
+   * @param slipRate Slip rate in fault coordinate system.
+   * @param tractionTpdt Fault traction in fault coordinate system.
+   * @param dTractionTpdt Change in fault traction from friction criterion.
+   * @param propsStateVars Friction properties and state variables at vertex.
+   */
+  template<int dim>
+  void _activeSetClassify(const int iVertex,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* tractionTpdt,
+			  const PylithScalar* dTractionTpdt,
+			  const PylithScalar* propsStateVars);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -297,16 +478,50 @@ private :
   /// To identify constitutive model
   friction::FrictionModel* _friction;
 
-  /// Sparse matrix for sensitivity solve.
+  /// Sparse matrix for sensitivity solve (negative side of fault
+  /// when reusing factorization).
   topology::Jacobian* _jacobian;
 
+  /// Sparse matrix for sensitivity solve for positive side of fault
+  /// (only used when reusing factorization).
+  topology::Jacobian* _jacobianPositive;
+
   PetscKSP _ksp; ///< PETSc KSP linear solver for sensitivity problem.
+  PetscKSP _kspPositive; ///< PETSc KSP linear solver for positive side (reuse only).
+
+  /// Domain Jacobian and its state when the sensitivity matrices for
+  /// the negative [0] and positive [1] sides were last assembled.
+  PetscMat _jacobianDomainMat[2];
+  PetscObjectState _jacobianDomainState[2];
+
+  /// Flag for reusing factorization of sensitivity problem.
+  bool _reuseSensitivityFactorization;
 
   /// Flag to control whether to continue to impose initial tractions
   /// on the fault surface when it opens. If it is a frictional
   /// contact, then it should be a free surface.
   bool _openFreeSurf;
 
+  /// Margin below friction strength for treating locked vertices as inactive.
+  PylithScalar _activeSetMargin;
+
+  /// Time at which friction strengths of locked vertices were computed.
+  PylithScalar _activeSetTime;
+
+  int_array _activeSetStatus; ///< Status (VertexStatusEnum) of cohesive vertices.
+  scalar_array _activeSetStrength; ///< Friction strength of locked vertices.
+  scalar_array _activeSetNormal; ///< Normal traction at which strength was computed.
+
+  /// Flag for accumulating rupture metrics.
+  bool _ruptureMetrics;
+
+  /// Slip rate threshold (nondimensional) defining rupture time.
+  PylithScalar _ruptureSlipRateThreshold;
+
+  scalar_array _ruptureTime; ///< Time slip rate first exceeded threshold.
+  scalar_array _peakSlipRate; ///< Peak slip rate (magnitude).
+  scalar_array _peakSlipRateTime; ///< Time of peak slip rate.
+
 // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -29,6 +29,7 @@
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
@@ -172,6 +173,24 @@ pylith::faults::FaultCohesiveImpulses::integrateResidual(const topology::Field&
   const int setupEvent = _logger->eventId("FaIR setup");
   _logger->eventBegin(setupEvent);
 
+  updateRelativeDisp(t);
+
+  _logger->eventEnd(setupEvent);
+
+  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Set relative displacement field to impulse associated with time t.
+void
+pylith::faults::FaultCohesiveImpulses::updateRelativeDisp(const PylithScalar t)
+{ // updateRelativeDisp
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
   topology::Field& dispRel = _fields->get("relative disp");
   dispRel.zeroAll();
   // Set impulse corresponding to current time.
@@ -182,12 +201,191 @@ pylith::faults::FaultCohesiveImpulses::integrateResidual(const topology::Field&
   const topology::Field& orientation = _fields->get("orientation");
   FaultCohesiveLagrange::faultToGlobal(&dispRel, orientation);
 
-  _logger->eventEnd(setupEvent);
+  PYLITH_METHOD_END;
+} // updateRelativeDisp
 
-  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
+// ----------------------------------------------------------------------
+// Get information about impulses.
+void
+pylith::faults::FaultCohesiveImpulses::impulseInfo(PylithScalar* coordinates,
+						   const int numCoordinates,
+						   int* vertices,
+						   const int numVertices,
+						   PylithScalar* amplitudes,
+						   const int numAmplitudes,
+						   int* components,
+						   const int numComponents)
+{ // impulseInfo
+  PYLITH_METHOD_BEGIN;
+
+  assert(coordinates);
+  assert(vertices);
+  assert(amplitudes);
+  assert(components);
+  assert(_fields);
+  assert(_normalizer);
+
+  const spatialdata::geocoords::CoordSys* cs = _faultMesh->coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  const int numImpulsesAll = numImpulses();
+  if (numCoordinates != numImpulsesAll*spaceDim || numVertices != numImpulsesAll ||
+      numAmplitudes != numImpulsesAll || numComponents != numImpulsesAll) {
+    std::ostringstream msg;
+    msg << "Size of arrays for information about impulses (" << numCoordinates << ", " << numVertices << ", "
+	<< numAmplitudes << ", " << numComponents << ") does not match number of impulses (" << numImpulsesAll << ") for fault '"
+	<< label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  for (int i=0; i < numCoordinates; ++i) {
+    coordinates[i] = 0.0;
+  } // for
+  for (int i=0; i < numImpulsesAll; ++i) {
+    vertices[i] = 0;
+    amplitudes[i] = 0.0;
+    components[i] = 0;
+  } // for
+
+  PetscErrorCode err = 0;
+
+  if (_dbImpulseAmp) {
+    topology::VecVisitorMesh amplitudeVisitor(_fields->get("impulse amplitude"));
+    const PetscScalar* amplitudeArray = amplitudeVisitor.localArray();
+
+    PetscDM faultDMMesh = _faultMesh->dmMesh();assert(faultDMMesh);
+    topology::CoordsVisitor coordsVisitor(faultDMMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+
+    // Use same numbering of vertices as the fault output.
+    topology::Stratum verticesStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    PetscIS globalVertexNumbers = NULL;
+    const PetscInt* gvertex = NULL;
+    err = DMPlexGetVertexNumbering(faultDMMesh, &globalVertexNumbers);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(globalVertexNumbers, &gvertex);PYLITH_CHECK_ERROR(err);
+
+    const srcs_type::const_iterator impulsePointsEnd = _impulsePoints.end();
+    for (srcs_type::const_iterator piter=_impulsePoints.begin(); piter != impulsePointsEnd; ++piter) {
+      const int impulse = piter->first;
+      const int v_fault = _cohesiveVertices[piter->second.indexCohesive].fault;
+      assert(0 <= impulse && impulse < numImpulsesAll);
+
+      const PetscInt coff = coordsVisitor.sectionOffset(v_fault);
+      assert(spaceDim == coordsVisitor.sectionDof(v_fault));
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	coordinates[impulse*spaceDim+iDim] = coordsArray[coff+iDim];
+      } // for
+
+      const PetscInt gv = gvertex[v_fault-vStart];
+      vertices[impulse] = (gv < 0) ? -(gv+1) : gv;
+
+      const PetscInt aoff = amplitudeVisitor.sectionOffset(v_fault);
+      assert(1 == amplitudeVisitor.sectionDof(v_fault));
+      amplitudes[impulse] = amplitudeArray[aoff];
+      components[impulse] = piter->second.indexDOF;
+    } // for
+    err = ISRestoreIndices(globalVertexNumbers, &gvertex);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  MPI_Comm comm = _faultMesh->comm();
+  err = MPI_Allreduce(MPI_IN_PLACE, coordinates, numCoordinates, MPIU_SCALAR, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(MPI_IN_PLACE, vertices, numVertices, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(MPI_IN_PLACE, amplitudes, numAmplitudes, MPIU_SCALAR, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(MPI_IN_PLACE, components, numComponents, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+  const PylithScalar lengthScale = _normalizer->lengthScale();
+  _normalizer->dimensionalize(coordinates, numCoordinates, lengthScale);
+  _normalizer->dimensionalize(amplitudes, numAmplitudes, lengthScale);
 
   PYLITH_METHOD_END;
-} // integrateResidual
+} // impulseInfo
+
+// ----------------------------------------------------------------------
+// Get response to each impulse at an observation point from the
+// solution of the adjoint problem.
+void
+pylith::faults::FaultCohesiveImpulses::impulseResponses(PylithScalar* values,
+							const int numValues,
+							const topology::Field& solution)
+{ // impulseResponses
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+  assert(_fields);
+  assert(_normalizer);
+
+  const int numImpulsesAll = numImpulses();
+  if (numValues != numImpulsesAll) {
+    std::ostringstream msg;
+    msg << "Size of array for impulse responses (" << numValues << ") does not match number of impulses ("
+	<< numImpulsesAll << ") for fault '" << label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  for (int i=0; i < numValues; ++i) {
+    values[i] = 0.0;
+  } // for
+
+  if (_dbImpulseAmp) {
+    const spatialdata::geocoords::CoordSys* cs = _faultMesh->coordsys();assert(cs);
+    const int spaceDim = cs->spaceDim();
+
+    topology::VecVisitorMesh amplitudeVisitor(_fields->get("impulse amplitude"));
+    const PetscScalar* amplitudeArray = amplitudeVisitor.localArray();
+
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
+    const PetscScalar* orientationArray = orientationVisitor.localArray();
+
+    topology::VecVisitorMesh solutionVisitor(solution);
+    const PetscScalar* solutionArray = solutionVisitor.localArray();
+
+    const srcs_type::const_iterator impulsePointsEnd = _impulsePoints.end();
+    for (srcs_type::const_iterator piter=_impulsePoints.begin(); piter != impulsePointsEnd; ++piter) {
+      const int impulse = piter->first;
+      const int iVertex = piter->second.indexCohesive;
+      const int indexDOF = piter->second.indexDOF;
+      const int v_fault = _cohesiveVertices[iVertex].fault;
+      const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+
+      // Skip clamped vertices
+      if (e_lagrange < 0) {
+	continue;
+      } // if
+      assert(0 <= impulse && impulse < numValues);
+      assert(indexDOF >= 0 && indexDOF < spaceDim);
+
+      const PetscInt aoff = amplitudeVisitor.sectionOffset(v_fault);
+      assert(1 == amplitudeVisitor.sectionDof(v_fault));
+
+      const PetscInt areaoff = areaVisitor.sectionOffset(v_fault);
+      assert(1 == areaVisitor.sectionDof(v_fault));
+
+      const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
+      assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
+
+      const PetscInt loff = solutionVisitor.sectionOffset(e_lagrange);
+      assert(spaceDim == solutionVisitor.sectionDof(e_lagrange));
+
+      // Component of Lagrange multiplier in fault coordinate system.
+      PylithScalar lagrangeFault = 0.0;
+      for (int iDim=0; iDim < spaceDim; ++iDim) {
+	lagrangeFault += orientationArray[ooff+indexDOF*spaceDim+iDim] * solutionArray[loff+iDim];
+      } // for
+      values[impulse] = areaArray[areaoff] * amplitudeArray[aoff] * lagrangeFault;
+    } // for
+  } // if
+
+  PetscErrorCode err = MPI_Allreduce(MPI_IN_PLACE, values, numValues, MPIU_SCALAR, MPI_SUM, _faultMesh->comm());PYLITH_CHECK_ERROR(err);
+
+  // Responses are displacements.
+  _normalizer->dimensionalize(values, numValues, _normalizer->lengthScale());
+
+  PYLITH_METHOD_END;
+} // impulseResponses
 
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
@@ -208,12 +406,15 @@ pylith::faults::FaultCohesiveImpulses::vertexField(const char* name,
 
   if (0 == strcasecmp("slip", name)) {
     const topology::Field& dispRel = _fields->get("relative disp");
-    _allocateBufferVectorField();
-    topology::Field& buffer = _fields->get("buffer (vector)");
-    buffer.copy(dispRel);
-    buffer.label("slip");
-    FaultCohesiveLagrange::globalToFault(&buffer, orientation);
-    buffer.complete();
+    const topology::Field* dependencies[2] = { &dispRel, &orientation };
+    topology::Field& buffer = _derivedBufferVectorField("slip");
+    if (!_isDerivedFieldCurrent("slip", dependencies, 2)) {
+      buffer.copy(dispRel);
+      buffer.label("slip");
+      FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+      buffer.complete();
+      _derivedFieldComputed("slip", dependencies, 2);
+    } // if
     PYLITH_METHOD_RETURN(buffer);
 
   } else if (cohesiveDim > 0 && 0 == strcasecmp("strike_dir", name)) {
@@ -250,9 +451,12 @@ pylith::faults::FaultCohesiveImpulses::vertexField(const char* name,
   } else if (0 == strcasecmp("traction_change", name)) {
     assert(fields);
     const topology::Field& dispT = fields->get("disp(t)");
-    _allocateBufferVectorField();
-    topology::Field& buffer = _fields->get("buffer (vector)");
-    _calcTractionsChange(&buffer, dispT);
+    const topology::Field* dependencies[2] = { &dispT, &orientation };
+    topology::Field& buffer = _derivedBufferVectorField("traction_change");
+    if (!_isDerivedFieldCurrent("traction_change", dependencies, 2)) {
+      _calcTractionsChange(&buffer, dispT);
+      _derivedFieldComputed("traction_change", dependencies, 2);
+    } // if
     PYLITH_METHOD_RETURN(buffer);
 
   } else {
@@ -99,6 +99,57 @@ public :
   void initialize(const topology::Mesh& mesh,
 		  const PylithScalar upDir[3]);
 
+  /** Set relative displacement field to the impulse associated with
+   * time t.
+   *
+   * @param t Current time (index of impulse).
+   */
+  void updateRelativeDisp(const PylithScalar t);
+
+  /** Get information about impulses.
+   *
+   * The information is gathered on all processes, so the method must
+   * be called by all processes. Coordinates and amplitudes are
+   * dimensioned.
+   *
+   * @param coordinates Array of coordinates of fault vertices [numImpulses*spaceDim].
+   * @param numCoordinates Size of array of coordinates.
+   * @param vertices Array of fault vertices [numImpulses], numbered
+   *   as in the fault output (global vertex numbering of fault mesh).
+   * @param numVertices Size of array of vertices.
+   * @param amplitudes Array of amplitudes [numImpulses].
+   * @param numAmplitudes Size of array of amplitudes.
+   * @param components Array of indices of impulse components [numImpulses].
+   * @param numComponents Size of array of components.
+   */
+  void impulseInfo(PylithScalar* coordinates,
+		   const int numCoordinates,
+		   int* vertices,
+		   const int numVertices,
+		   PylithScalar* amplitudes,
+		   const int numAmplitudes,
+		   int* components,
+		   const int numComponents);
+
+  /** Get response to each impulse at an observation point from the
+   * solution of the adjoint problem.
+   *
+   * By reciprocity, the response at an observation point to an
+   * impulse is the work done by the impulse on the solution for a
+   * unit point force at the observation point: the product of the
+   * area, the impulse amplitude, and the Lagrange multiplier
+   * (in the fault coordinate system) for the impulse component. The
+   * responses are summed over all processes, so the method must be
+   * called by all processes.
+   *
+   * @param values Array of responses [numImpulses].
+   * @param numValues Size of array.
+   * @param solution Solution of adjoint problem.
+   */
+  void impulseResponses(PylithScalar* values,
+			const int numValues,
+			const topology::Field& solution);
+
   /** Integrate contributions to residual term (r) for operator that
    * do not require assembly across cells, vertices, or processors.
    *
@@ -84,6 +84,7 @@ pylith::faults::FaultCohesiveKin::eqsrcs(const char* const * names,
 
   // :TODO: Use shared pointers for earthquake sources
   _eqSrcs.clear();
+  _eqSrcsCompleted.clear();
   for (int i = 0; i < numSources; ++i) {
     if (0 == sources[i])
       throw std::runtime_error("Null earthquake source.");
@@ -113,6 +114,7 @@ pylith::faults::FaultCohesiveKin::initialize(const topology::Mesh& mesh,
     assert(src);
     src->initialize(*_faultMesh, *_normalizer);
   } // for
+  _eqSrcsCompleted.clear();
 
   PYLITH_METHOD_END;
 } // initialize
@@ -134,29 +136,56 @@ pylith::faults::FaultCohesiveKin::integrateResidual(const topology::Field& resid
   const int setupEvent = _logger->eventId("FaIR setup");
   _logger->eventBegin(setupEvent);
 
+  _calcRelativeDisp(t);
+
+  _logger->eventEnd(setupEvent);
+
+  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Compute relative displacement field (slip in global coordinate
+// system) at time t from the earthquake sources.
+void
+pylith::faults::FaultCohesiveKin::_calcRelativeDisp(const PylithScalar t)
+{ // _calcRelativeDisp
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
   topology::Field& dispRel = _fields->get("relative disp");
   dispRel.zeroAll();
-  // Compute slip field at current time step
+  // Compute slip field at current time step. Sources that have not
+  // started slipping are skipped. Once a source has completed
+  // slipping, its final slip is added to the completed slip field
+  // and the source is not evaluated again (time only increases).
   const srcs_type::const_iterator srcsEnd = _eqSrcs.end();
   for (srcs_type::iterator s_iter = _eqSrcs.begin(); s_iter != srcsEnd; ++s_iter) {
     EqKinSrc* src = s_iter->second;
     assert(src);
-    if (t >= src->originTime())
+    if (_eqSrcsCompleted.count(s_iter->first) > 0 || t < src->originTime() || t < src->startTime()) {
+      continue;
+    } // if
+    if (t > src->completionTime()) {
+      src->slip(&_completedSlipField(), t);
+      _eqSrcsCompleted.insert(s_iter->first);
+    } else {
       src->slip(&dispRel, t);
+    } // if/else
   } // for
+  if (!_eqSrcsCompleted.empty()) {
+    dispRel += _completedSlipField();
+  } // if
 
   // Transform slip from local (fault) coordinate system to relative
   // displacement field in global coordinate system
   const topology::Field& orientation = _fields->get("orientation");
   FaultCohesiveLagrange::faultToGlobal(&dispRel, orientation);
 
-  _logger->eventEnd(setupEvent);
-
-  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
-
-
   PYLITH_METHOD_END;
-} // integrateResidual
+} // _calcRelativeDisp
 
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
@@ -180,11 +209,14 @@ pylith::faults::FaultCohesiveKin::vertexField(const char* name,
 
   if (0 == strcasecmp("slip", name)) {
     const topology::Field& dispRel = _fields->get("relative disp");
-    _allocateBufferVectorField();
-    topology::Field& buffer = _fields->get("buffer (vector)");
-    buffer.copy(dispRel);
-    buffer.label("slip");
-    FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+    const topology::Field* dependencies[2] = { &dispRel, &orientation };
+    topology::Field& buffer = _derivedBufferVectorField("slip");
+    if (!_isDerivedFieldCurrent("slip", dependencies, 2)) {
+      buffer.copy(dispRel);
+      buffer.label("slip");
+      FaultCohesiveLagrange::globalToFault(&buffer, orientation);
+      _derivedFieldComputed("slip", dependencies, 2);
+    } // if
     PYLITH_METHOD_RETURN(buffer);
 
   } else if (cohesiveDim > 0 && 0 == strcasecmp("strike_dir", name)) {
@@ -242,9 +274,12 @@ pylith::faults::FaultCohesiveKin::vertexField(const char* name,
   } else if (0 == strcasecmp("traction_change", name)) {
     assert(fields);
     const topology::Field& dispT = fields->get("disp(t)");
-    _allocateBufferVectorField();
-    topology::Field& buffer = _fields->get("buffer (vector)");
-    _calcTractionsChange(&buffer, dispT);
+    const topology::Field* dependencies[2] = { &dispT, &orientation };
+    topology::Field& buffer = _derivedBufferVectorField("traction_change");
+    if (!_isDerivedFieldCurrent("traction_change", dependencies, 2)) {
+      _calcTractionsChange(&buffer, dispT);
+      _derivedFieldComputed("traction_change", dependencies, 2);
+    } // if
     PYLITH_METHOD_RETURN(buffer);
 
   } else {
@@ -264,4 +299,25 @@ pylith::faults::FaultCohesiveKin::vertexField(const char* name,
   PYLITH_METHOD_RETURN(buffer);
 } // vertexField
 
+// ----------------------------------------------------------------------
+// Get field holding the sum of the final slip of earthquake sources
+// that have completed slipping.
+pylith::topology::Field&
+pylith::faults::FaultCohesiveKin::_completedSlipField(void)
+{ // _completedSlipField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+  if (!_fields->hasField("completed slip")) {
+    // Use same shape/chart as relative displacement field.
+    _fields->add("completed slip", "completed_slip");
+    topology::Field& slip = _fields->get("completed slip");
+    const topology::Field& dispRel = _fields->get("relative disp");
+    slip.cloneSection(dispRel);
+    slip.zeroAll();
+  } // if
+
+  PYLITH_METHOD_RETURN(_fields->get("completed slip"));
+} // _completedSlipField
+
 // End of file 
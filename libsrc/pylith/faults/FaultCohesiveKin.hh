@@ -30,6 +30,7 @@
 
 #include <string> // HASA std::string
 #include <map> // HASA std::map
+#include <set> // HASA std::set
 
 // FaultCohesiveKin -----------------------------------------------------
 /**
@@ -39,6 +40,7 @@
 class pylith::faults::FaultCohesiveKin : public FaultCohesiveLagrange
 { // class FaultCohesiveKin
   friend class TestFaultCohesiveKin; // unit testing
+  friend class FaultCohesiveKinBatch; // batched residual
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
@@ -100,11 +102,31 @@ private :
 
   typedef std::map<std::string, EqKinSrc*> srcs_type;
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Get field holding the sum of the final slip of earthquake
+   * sources that have completed slipping, allocating it if necessary.
+   *
+   * @returns Slip of completed sources (fault coordinate system).
+   */
+  topology::Field& _completedSlipField(void);
+
+  /** Compute relative displacement field (slip in global coordinate
+   * system) at time t from the earthquake sources.
+   *
+   * @param t Current time.
+   */
+  void _calcRelativeDisp(const PylithScalar t);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
   srcs_type _eqSrcs; ///< Array of kinematic earthquake sources.
 
+  /// Names of sources whose final slip is in the completed slip field.
+  std::set<std::string> _eqSrcsCompleted;
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
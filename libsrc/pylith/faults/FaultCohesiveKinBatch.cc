@@ -0,0 +1,453 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FaultCohesiveKinBatch.hh" // implementation of object methods
+
+#include "FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Fields.hh" // USES Fields
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::faults::FaultCohesiveKinBatch::FaultCohesiveKinBatch(void) :
+  _solnSection(0),
+  _solnState(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::faults::FaultCohesiveKinBatch::~FaultCohesiveKinBatch(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::faults::FaultCohesiveKinBatch::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  feassemble::Integrator::deallocate();
+
+  _faults.clear(); // Faults are not owned by the batch.
+  _solnSection = 0;
+  _solnState = 0;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Add fault to batch.
+void
+pylith::faults::FaultCohesiveKinBatch::addFault(FaultCohesiveKin* fault)
+{ // addFault
+  PYLITH_METHOD_BEGIN;
+
+  assert(fault);
+  assert(fault->_quadrature);
+
+  if (_faults.size() > 0) {
+    assert(_faults[0]->_quadrature);
+    if (fault->_quadrature->spaceDim() != _faults[0]->_quadrature->spaceDim()) {
+      std::ostringstream msg;
+      msg << "Spatial dimension (" << fault->_quadrature->spaceDim()
+	  << ") of fault '" << fault->label()
+	  << "' does not match the spatial dimension ("
+	  << _faults[0]->_quadrature->spaceDim()
+	  << ") of the other faults in the batch.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+  _faults.push_back(fault);
+
+  // Force update of concatenated arrays.
+  _solnSection = 0;
+  _solnState = 0;
+
+  PYLITH_METHOD_END;
+} // addFault
+
+// ----------------------------------------------------------------------
+// Get number of faults in batch.
+int
+pylith::faults::FaultCohesiveKinBatch::numFaults(void) const
+{ // numFaults
+  return _faults.size();
+} // numFaults
+
+// ----------------------------------------------------------------------
+// Set time step for advancing from time t to time t+dt.
+void
+pylith::faults::FaultCohesiveKinBatch::timeStep(const PylithScalar dt)
+{ // timeStep
+  _dt = dt;
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->timeStep(dt);
+  } // for
+} // timeStep
+
+// ----------------------------------------------------------------------
+// Check whether Jacobian needs to be recomputed.
+bool
+pylith::faults::FaultCohesiveKinBatch::needNewJacobian(void) const
+{ // needNewJacobian
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    if (_faults[i]->needNewJacobian()) {
+      return true;
+    } // if
+  } // for
+  return false;
+} // needNewJacobian
+
+// ----------------------------------------------------------------------
+// Check whether Jacobian is symmetric.
+bool
+pylith::faults::FaultCohesiveKinBatch::isJacobianSymmetric(void) const
+{ // isJacobianSymmetric
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    if (!_faults[i]->isJacobianSymmetric()) {
+      return false;
+    } // if
+  } // for
+  return true;
+} // isJacobianSymmetric
+
+// ----------------------------------------------------------------------
+// Integrate contribution of cohesive cells to residual term that do
+// not require assembly across cells, vertices, or processors.
+void
+pylith::faults::FaultCohesiveKinBatch::integrateResidual(const topology::Field& residual,
+							 const PylithScalar t,
+							 topology::SolutionFields* const fields)
+{ // integrateResidual
+  PYLITH_METHOD_BEGIN;
+
+  assert(fields);
+
+  const size_t numFaults = _faults.size();
+  if (0 == numFaults) {
+    PYLITH_METHOD_END;
+  } // if
+
+  if (!_logger) {
+    _initializeLogger();
+  } // if
+  assert(_logger);
+
+  // Same contributions as FaultCohesiveLagrange::integrateResidual(),
+  // computed with a single loop over the cohesive vertices of all of
+  // the faults. The relative displacement is still computed fault by
+  // fault, because it is a field over each fault mesh.
+
+  const int setupEvent = _logger->eventId("FaBR setup");
+  const int computeEvent = _logger->eventId("FaBR compute");
+
+  _logger->eventBegin(setupEvent);
+
+  assert(_faults[0]->_quadrature);
+  const int spaceDim = _faults[0]->_quadrature->spaceDim();
+
+  // Compute slip for each fault and gather relative displacement into
+  // the concatenated array.
+  _updateOffsets(*fields);
+  for (size_t iFault=0; iFault < numFaults; ++iFault) {
+    FaultCohesiveKin* fault = _faults[iFault];
+    fault->_calcRelativeDisp(t);
+
+    assert(fault->_fields);
+    topology::VecVisitorMesh dispRelVisitor(fault->_fields->get("relative disp"), 0, true);
+    const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+    const int vertexEnd = _faultStart[iFault+1];
+    for (int iVertex=_faultStart[iFault]; iVertex < vertexEnd; ++iVertex) {
+      const PetscInt droff = _offsetsFault[iVertex];
+      for (int d=0; d < spaceDim; ++d) {
+	_dispRel[iVertex*spaceDim+d] = dispRelArray[droff+d];
+      } // for
+    } // for
+  } // for
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  PetscScalar* residualArray = residualVisitor.localArray();
+
+  topology::Field& dispT = fields->get("disp(t)");
+  topology::VecVisitorMesh dispTVisitor(dispT, 0, true);
+  const PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  topology::Field& dispTIncr = fields->get("dispIncr(t->t+dt)");
+  topology::VecVisitorMesh dispTIncrVisitor(dispTIncr, 0, true);
+  const PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
+  // Loop over cohesive vertices of all faults. Only vertices that are
+  // not clamped and have local Lagrange constraints are in the arrays.
+  const int numVertices = _offsetsL.size();
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const PetscInt noff = _offsetsN[iVertex];
+    const PetscInt poff = _offsetsP[iVertex];
+    const PetscInt loff = _offsetsL[iVertex];
+    const PylithScalar areaValue = _area[iVertex];
+    const PylithScalar* dispRelVertex = &_dispRel[iVertex*spaceDim];
+
+    for (int d=0; d < spaceDim; ++d) {
+      const PylithScalar residualN = areaValue * (dispTArray[loff+d] + dispTIncrArray[loff+d]);
+      residualArray[noff+d] += +residualN;
+      residualArray[poff+d] += -residualN;
+      residualArray[loff+d] += -areaValue * (dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d] - dispRelVertex[d]);
+    } // for
+  } // for
+  PetscLogFlops(numVertices*spaceDim*10);
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Compute Jacobian matrix (A) associated with operator.
+void
+pylith::faults::FaultCohesiveKinBatch::integrateJacobian(topology::Jacobian* jacobian,
+							 const PylithScalar t,
+							 topology::SolutionFields* const fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->integrateJacobian(jacobian, t, fields);
+  } // for
+  _needNewJacobian = false;
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Compute Jacobian matrix (A) associated with operator.
+void
+pylith::faults::FaultCohesiveKinBatch::integrateJacobian(topology::Field* jacobian,
+							 const PylithScalar t,
+							 topology::SolutionFields* const fields)
+{ // integrateJacobian
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->integrateJacobian(jacobian, t, fields);
+  } // for
+  _needNewJacobian = false;
+
+  PYLITH_METHOD_END;
+} // integrateJacobian
+
+// ----------------------------------------------------------------------
+// Integrate contributions to Jacobian matrix (A) associated with
+// operator.
+void
+pylith::faults::FaultCohesiveKinBatch::calcPreconditioner(PetscMat* const precondMatrix,
+							  topology::Jacobian* const jacobian,
+							  topology::SolutionFields* const fields)
+{ // calcPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->calcPreconditioner(precondMatrix, jacobian, fields);
+  } // for
+
+  PYLITH_METHOD_END;
+} // calcPreconditioner
+
+// ----------------------------------------------------------------------
+// Set whether state variables are current.
+void
+pylith::faults::FaultCohesiveKinBatch::trialStateVarsCurrent(const bool flag)
+{ // trialStateVarsCurrent
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->trialStateVarsCurrent(flag);
+  } // for
+} // trialStateVarsCurrent
+
+// ----------------------------------------------------------------------
+// Constrain solution space.
+void
+pylith::faults::FaultCohesiveKinBatch::constrainSolnSpace(topology::SolutionFields* const fields,
+							  const PylithScalar t,
+							  const topology::Jacobian& jacobian)
+{ // constrainSolnSpace
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->constrainSolnSpace(fields, t, jacobian);
+  } // for
+
+  PYLITH_METHOD_END;
+} // constrainSolnSpace
+
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian to match Lagrange
+// multiplier constraints.
+void
+pylith::faults::FaultCohesiveKinBatch::adjustSolnLumped(topology::SolutionFields* fields,
+							const PylithScalar t,
+							const topology::Field& jacobian)
+{ // adjustSolnLumped
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->adjustSolnLumped(fields, t, jacobian);
+  } // for
+
+  PYLITH_METHOD_END;
+} // adjustSolnLumped
+
+// ----------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::faults::FaultCohesiveKinBatch::verifyConfiguration(const topology::Mesh& mesh) const
+{ // verifyConfiguration
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  for (size_t i=0; i < numFaults; ++i) {
+    _faults[i]->verifyConfiguration(mesh);
+  } // for
+
+  PYLITH_METHOD_END;
+} // verifyConfiguration
+
+// ----------------------------------------------------------------------
+// Initialize logger.
+void
+pylith::faults::FaultCohesiveKinBatch::_initializeLogger(void)
+{ // initializeLogger
+  PYLITH_METHOD_BEGIN;
+
+  delete _logger;
+  _logger = new utils::EventLogger;
+  assert(_logger);
+  _logger->className("FaultCohesiveKinBatch");
+  _logger->initialize();
+
+  _logger->registerEvent("FaBR setup");
+  _logger->registerEvent("FaBR compute");
+
+  PYLITH_METHOD_END;
+} // initializeLogger
+
+// ----------------------------------------------------------------------
+// Update concatenated offsets and area of the cohesive vertices of
+// the faults.
+void
+pylith::faults::FaultCohesiveKinBatch::_updateOffsets(const topology::SolutionFields& fields)
+{ // _updateOffsets
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numFaults = _faults.size();
+  assert(numFaults > 0);
+
+  PetscSection solnSection = fields.solution().localSection();assert(solnSection);
+  PetscObjectState solnState = 0;
+  PetscErrorCode err = PetscObjectStateGet((PetscObject)solnSection, &solnState);PYLITH_CHECK_ERROR(err);
+  if (solnSection == _solnSection && solnState == _solnState && numFaults+1 == _faultStart.size()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(_faults[0]->_quadrature);
+  const int spaceDim = _faults[0]->_quadrature->spaceDim();
+
+  // Count vertices that are not clamped and have local Lagrange
+  // constraints.
+  _faultStart.resize(numFaults+1);
+  _faultStart[0] = 0;
+  for (size_t iFault=0; iFault < numFaults; ++iFault) {
+    FaultCohesiveKin* fault = _faults[iFault];
+    fault->_updateCohesiveOffsets(fields);
+    const int_array& offsetsLGlobal = fault->_cohesiveOffsets.lagrangeGlobal;
+    const size_t numFaultVertices = offsetsLGlobal.size();
+    int count = 0;
+    for (size_t iVertex=0; iVertex < numFaultVertices; ++iVertex) {
+      if (offsetsLGlobal[iVertex] >= 0) {
+	++count;
+      } // if
+    } // for
+    _faultStart[iFault+1] = _faultStart[iFault] + count;
+  } // for
+
+  const int numVertices = _faultStart[numFaults];
+  _offsetsN.resize(numVertices);
+  _offsetsP.resize(numVertices);
+  _offsetsL.resize(numVertices);
+  _offsetsFault.resize(numVertices);
+  _area.resize(numVertices);
+  _dispRel.resize(numVertices*spaceDim);
+
+  for (size_t iFault=0; iFault < numFaults; ++iFault) {
+    FaultCohesiveKin* fault = _faults[iFault];
+    const FaultCohesiveLagrange::CohesiveOffsets& offsets = fault->_cohesiveOffsets;
+
+    assert(fault->_fields);
+    topology::VecVisitorMesh areaVisitor(fault->_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    const size_t numFaultVertices = offsets.lagrangeGlobal.size();
+    int index = _faultStart[iFault];
+    for (size_t iVertex=0; iVertex < numFaultVertices; ++iVertex) {
+      if (offsets.lagrangeGlobal[iVertex] < 0) {
+	continue;
+      } // if
+      _offsetsN[index] = offsets.negative[iVertex];
+      _offsetsP[index] = offsets.positive[iVertex];
+      _offsetsL[index] = offsets.lagrange[iVertex];
+      _offsetsFault[index] = offsets.fault[iVertex];
+      _area[index] = areaArray[offsets.area[iVertex]];
+      ++index;
+    } // for
+    assert(_faultStart[iFault+1] == index);
+  } // for
+
+  _solnSection = solnSection;
+  _solnState = solnState;
+
+  PYLITH_METHOD_END;
+} // _updateOffsets
+
+
+// End of file
@@ -0,0 +1,242 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/faults/FaultCohesiveKinBatch.hh
+ *
+ * @brief C++ integrator that evaluates the residual of several fault
+ * surfaces with kinematic (prescribed) slip with a single loop over
+ * their cohesive vertices.
+ */
+
+#if !defined(pylith_faults_faultcohesivekinbatch_hh)
+#define pylith_faults_faultcohesivekinbatch_hh
+
+// Include directives ---------------------------------------------------
+#include "faultsfwd.hh" // forward declarations
+
+#include "pylith/feassemble/Integrator.hh" // ISA Integrator
+
+#include <vector> // HASA std::vector
+
+// FaultCohesiveKinBatch ------------------------------------------------
+/**
+ * @brief C++ integrator that evaluates the residual of several fault
+ * surfaces with kinematic (prescribed) slip with a single loop over
+ * their cohesive vertices.
+ *
+ * The cohesive vertices of all of the faults are concatenated into
+ * one set of arrays (offsets into the solution fields over the
+ * domain, fault area, and relative displacement), so the residual is
+ * computed with a single loop over the vertices using a single set of
+ * visitors for the fields over the domain.
+ *
+ * Only this final loop is batched. The relative displacement and
+ * orientation are fields over each fault mesh, so each fault still
+ * computes its relative displacement with _calcRelativeDisp() (slip
+ * from its earthquake sources, rotated to the global coordinate
+ * system with its own visitors), and the batch gathers it into the
+ * concatenated array with one visitor per fault. The fault meshes,
+ * fields, and output are unchanged.
+ *
+ * The Jacobian, preconditioner, and constraints on the solution are
+ * not batched; these operations are delegated to the individual
+ * faults.
+ *
+ * The batch does not own the faults.
+ */
+class pylith::faults::FaultCohesiveKinBatch : public feassemble::Integrator
+{ // class FaultCohesiveKinBatch
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  FaultCohesiveKinBatch(void);
+
+  /// Destructor.
+  ~FaultCohesiveKinBatch(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Add fault to batch. The fault must already be initialized.
+   *
+   * @param fault Fault with kinematic slip.
+   */
+  void addFault(FaultCohesiveKin* fault);
+
+  /** Get number of faults in batch.
+   *
+   * @returns Number of faults.
+   */
+  int numFaults(void) const;
+
+  /** Set time step for advancing from time t to time t+dt.
+   *
+   * @param dt Time step
+   */
+  void timeStep(const PylithScalar dt);
+
+  /** Check whether Jacobian needs to be recomputed.
+   *
+   * @returns True if Jacobian needs to be recomputed for any fault,
+   * false otherwise.
+   */
+  bool needNewJacobian(void) const;
+
+  /** Check whether Jacobian is symmetric.
+   *
+   * @returns True if Jacobian is symmetric for all faults, false
+   * otherwise.
+   */
+  bool isJacobianSymmetric(void) const;
+
+  /** Integrate contributions to residual term (r) for operator that
+   * do not require assembly across cells, vertices, or processors.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateResidual(const topology::Field& residual,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Integrate contributions to Jacobian matrix (A) associated with
+   * operator.
+   *
+   * @param jacobian Sparse matrix
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobian(topology::Jacobian* jacobian,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Integrate contributions to Jacobian matrix (A) associated with
+   * operator.
+   *
+   * @param jacobian Diagonal Jacobian matrix as a field.
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateJacobian(topology::Field* jacobian,
+			 const PylithScalar t,
+			 topology::SolutionFields* const fields);
+
+  /** Integrate contributions to Jacobian matrix (A) associated with
+   * operator.
+   *
+   * @param precondMatrix Custom preconditioning matrix.
+   * @param jacobian Sparse matrix for Jacobian of system.
+   * @param fields Solution fields
+   */
+  void calcPreconditioner(PetscMat* const precondMatrix,
+			  topology::Jacobian* const jacobian,
+			  topology::SolutionFields* const fields);
+
+  /** Set whether state variables computed in the most recent residual
+   * evaluation correspond to the converged solution.
+   *
+   * @param flag True if trial state variables are current, false otherwise.
+   */
+  void trialStateVarsCurrent(const bool flag);
+
+  /** Constrain solution space based on friction.
+   *
+   * @param fields Solution fields.
+   * @param t Current time.
+   * @param jacobian Sparse matrix for system Jacobian.
+   */
+  void constrainSolnSpace(topology::SolutionFields* const fields,
+			  const PylithScalar t,
+			  const topology::Jacobian& jacobian);
+
+  /** Adjust solution from solver with lumped Jacobian to match Lagrange
+   *  multiplier constraints.
+   *
+   * @param fields Solution fields.
+   * @param t Current time.
+   * @param jacobian Jacobian of the system.
+   */
+  void adjustSolnLumped(topology::SolutionFields* fields,
+			const PylithScalar t,
+			const topology::Field& jacobian);
+
+  /** Verify configuration is acceptable.
+   *
+   * @param mesh Finite-element mesh
+   */
+  void verifyConfiguration(const topology::Mesh& mesh) const;
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /// Initialize logger.
+  void _initializeLogger(void);
+
+  /** Update concatenated offsets and area of the cohesive vertices of
+   * the faults. The arrays are only recomputed if the layout of the
+   * solution field changed since they were last computed.
+   *
+   * @param fields Solution fields.
+   */
+  void _updateOffsets(const topology::SolutionFields& fields);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  std::vector<FaultCohesiveKin*> _faults; ///< Faults in batch.
+
+  /// Index of first vertex of each fault in concatenated arrays
+  /// (numFaults+1 entries).
+  int_array _faultStart;
+
+  /// Offset of vertex on negative side in domain fields.
+  int_array _offsetsN;
+
+  /// Offset of vertex on positive side in domain fields.
+  int_array _offsetsP;
+
+  /// Offset of Lagrange multiplier point in domain fields.
+  int_array _offsetsL;
+
+  /// Offset of fault vertex in relative displacement field of fault.
+  int_array _offsetsFault;
+
+  scalar_array _area; ///< Area associated with each vertex.
+  scalar_array _dispRel; ///< Relative displacement at each vertex.
+
+  PetscSection _solnSection; ///< Layout of domain fields used for offsets.
+  PetscObjectState _solnState; ///< State of layout when offsets were computed.
+
+  // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private :
+
+  /// Not implemented
+  FaultCohesiveKinBatch(const FaultCohesiveKinBatch&);
+
+  /// Not implemented
+  const FaultCohesiveKinBatch& operator=(const FaultCohesiveKinBatch&);
+
+}; // class FaultCohesiveKinBatch
+
+#endif // pylith_faults_faultcohesivekinbatch_hh
+
+
+// End of file
@@ -54,12 +54,23 @@
 
 //#define DETAILED_EVENT_LOGGING
 
+#include "pylith/utils/threaddefs.h" // USES THREADED_VERTEX_LOOPS
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
     _cohesiveIS(0)
 { // constructor
     _useLagrangeConstraints = true;
+    _cohesiveOffsets.solnSection = NULL;
+    _cohesiveOffsets.solnState = 0;
+    _precondCache.indicesNP = NULL;
+    _precondCache.jacobianNP = NULL;
+    _precondCache.diagonalNP = NULL;
+    _precondCache.precondMatrix = NULL;
+    _precondCache.jacobianMatrix = NULL;
+    _precondCache.solnSection = NULL;
+    _precondCache.solnState = 0;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -78,6 +89,9 @@ pylith::faults::FaultCohesiveLagrange::deallocate(void)
 
     FaultCohesive::deallocate();
     delete _cohesiveIS; _cohesiveIS = 0;
+    _cohesiveOffsets.solnSection = NULL;
+    _destroyPreconditionerCache();
+    _derivedFields.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -210,6 +224,37 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
 { // integrateResidual
     PYLITH_METHOD_BEGIN;
 
+    assert(_quadrature);
+
+    switch (_quadrature->spaceDim()) { // switch
+    case 1:
+        _integrateResidualDim<1>(residual, t, fields);
+        break;
+    case 2:
+        _integrateResidualDim<2>(residual, t, fields);
+        break;
+    case 3:
+        _integrateResidualDim<3>(residual, t, fields);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in FaultCohesiveLagrange::integrateResidual().");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Integrate contribution of cohesive cells to residual term for
+// spatial dimension dim.
+template<int dim>
+void
+pylith::faults::FaultCohesiveLagrange::_integrateResidualDim(const topology::Field& residual,
+                                                             const PylithScalar t,
+                                                             topology::SolutionFields* const fields)
+{ // _integrateResidualDim
+    PYLITH_METHOD_BEGIN;
+
     assert(fields);
     assert(_fields);
     assert(_logger);
@@ -234,11 +279,11 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     _logger->eventBegin(setupEvent);
 
     // Get cell geometry information that doesn't depend on cell
-    const int spaceDim = _quadrature->spaceDim();
+    const int spaceDim = dim;
+    assert(_quadrature->spaceDim() == spaceDim);
 
     // Get sections associated with cohesive cells
     PetscSection residualSection = residual.localSection(); assert(residualSection);
-    PetscSection residualGlobalSection = residual.globalSection(); assert(residualGlobalSection);
 
     topology::VecVisitorMesh residualVisitor(residual);
     PetscScalar* residualArray = residualVisitor.localArray();
@@ -262,6 +307,16 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     // Get fault information
     PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
 
+    // Offsets are shared by all fields over the domain (and by all
+    // vector fields over the fault).
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsFault = _cohesiveOffsets.fault;
+    const int_array& offsetsArea = _cohesiveOffsets.area;
+
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
@@ -270,63 +325,25 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     // Loop over fault vertices
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
+        // Skip clamped edges and compute contribution only if Lagrange
+        // constraint is local.
+        if (offsetsLGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff  = 0;
-        PetscErrorCode err = PetscSectionGetOffset(residualGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0)
-            continue;
-
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventBegin(restrictEvent);
 #endif
 
-        // Get relative dislplacement at fault vertex.
-        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
-        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
-
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-        const PylithScalar areaValue = areaArray[aoff];
-
-        // Get disp(t) at conventional vertices and Lagrange vertex.
-        const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTVisitor.sectionDof(v_positive));
-
-        const PetscInt dtloff = dispTVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTVisitor.sectionDof(e_lagrange));
-
-        // Get dispIncr(t->t+dt) at conventional vertices and Lagrange vertex.
-        const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
-
-        // Assemble contributions into field
-        const PetscInt rnoff = residualVisitor.sectionOffset(v_negative);
-        assert(spaceDim == residualVisitor.sectionDof(v_negative));
-
-        const PetscInt rpoff = residualVisitor.sectionOffset(v_positive);
-        assert(spaceDim == residualVisitor.sectionDof(v_positive));
-
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        const PetscInt droff = offsetsFault[iVertex];
+        const PylithScalar areaValue = areaArray[offsetsArea[iVertex]];
+        assert(noff == residualVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == dispTIncrVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+        assert(droff == dispRelVisitor.sectionOffset(_cohesiveVertices[iVertex].fault));
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(restrictEvent);
@@ -334,10 +351,10 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
 #endif
 
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            const PylithScalar residualN = areaValue * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
-            residualArray[rnoff+d] += +residualN;
-            residualArray[rpoff+d] += -residualN;
-            residualArray[rloff+d] += -areaValue * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d] - dispRelArray[droff+d]);
+            const PylithScalar residualN = areaValue * (dispTArray[loff+d] + dispTIncrArray[loff+d]);
+            residualArray[noff+d] += +residualN;
+            residualArray[poff+d] += -residualN;
+            residualArray[loff+d] += -areaValue * (dispTArray[poff+d] + dispTIncrArray[poff+d] - dispTArray[noff+d] - dispTIncrArray[noff+d] - dispRelArray[droff+d]);
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -351,7 +368,7 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
 #endif
 
     PYLITH_METHOD_END;
-} // integrateResidual
+} // _integrateResidualDim
 
 // ----------------------------------------------------------------------
 // Compute Jacobian matrix (A) associated with operator.
@@ -389,24 +406,32 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
     const PetscScalar* areaArray = areaVisitor.localArray();
 
     PetscSection solnSection = fields->solution().localSection(); assert(solnSection);
-    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
 
     // Get fault information
     PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
 
-    // Allocate vectors for vertex values
-    scalar_array jacobianVertex(spaceDim*spaceDim);
-    int_array indicesL(spaceDim);
-    int_array indicesN(spaceDim);
-    int_array indicesP(spaceDim);
-    int_array indicesRel(spaceDim);
-    for (int i=0; i < spaceDim; ++i) {
-        indicesRel[i] = i;
-    } // for
+    // Allocate vectors for vertex values. The block for each
+    // cohesive vertex couples the negative (N), positive (P), and
+    // Lagrange (L) vertices, so all entries are inserted with a single
+    // call. Only the L,N; N,L; L,P; and P,L blocks are nonzero; the
+    // entries on the L,L diagonal block must be present but are zero.
+    const int blockSize = 3*spaceDim;
+    const int iN = 0;
+    const int iP = spaceDim;
+    const int iL = 2*spaceDim;
+    scalar_array jacobianVertex(blockSize*blockSize);
+    int_array indicesVertex(blockSize);
+    jacobianVertex = 0.0;
 
     // Get sparse matrix
     const PetscMat jacobianMatrix = jacobian->matrix(); assert(jacobianMatrix);
 
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsNGlobal = _cohesiveOffsets.negativeGlobal;
+    const int_array& offsetsPGlobal = _cohesiveOffsets.positiveGlobal;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsArea = _cohesiveOffsets.area;
+
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
@@ -415,86 +440,54 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
+        // Skip clamped edges and compute contribution only if Lagrange
+        // constraint is local.
+        const PetscInt gloff = offsetsLGlobal[iVertex];
+        if (gloff < 0) {
             continue;
         } // if
-
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0)
-            continue;
-
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        gnoff = gnoff < 0 ? -(gnoff+1) : gnoff;
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
+        const PetscInt gnoff = offsetsNGlobal[iVertex];
+        const PetscInt gpoff = offsetsPGlobal[iVertex];
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventBegin(restrictEvent);
 #endif
 
         // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
+        const PetscInt aoff = offsetsArea[iVertex];
+        assert(aoff == areaVisitor.sectionOffset(_cohesiveVertices[iVertex].fault));
+        const PylithScalar areaVertex = areaArray[aoff];
 
         // Set global order indices
-        indicesL = indicesRel + gloff;
-        indicesN = indicesRel + gnoff;
-        indicesP = indicesRel + gpoff;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            indicesVertex[iN+iDim] = gnoff + iDim;
+            indicesVertex[iP+iDim] = gpoff + iDim;
+            indicesVertex[iL+iDim] = gloff + iDim;
+        } // for
+#if !defined(NDEBUG)
         PetscInt cdof;
-        err = PetscSectionGetConstraintDof(solnSection, v_negative, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
-        err = PetscSectionGetConstraintDof(solnSection, v_positive, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
+        err = PetscSectionGetConstraintDof(solnSection, _cohesiveVertices[iVertex].negative, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
+        err = PetscSectionGetConstraintDof(solnSection, _cohesiveVertices[iVertex].positive, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
+#endif
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(restrictEvent);
         _logger->eventBegin(updateEvent);
 #endif
 
-        // Set diagonal entries of Jacobian at positive vertex to area
-        // associated with vertex.
-        for (int iDim=0; iDim < spaceDim; ++iDim)
-            jacobianVertex[iDim*spaceDim+iDim] = areaArray[aoff];
-
-        // Values at positive vertex, entry L,P in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesP.size(), &indicesP[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at positive vertex, entry P,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesP.size(), &indicesP[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry L,N in Jacobian
-        jacobianVertex *= -1.0;
-        err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesN.size(), &indicesN[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
-
-        // Values at negative vertex, entry N,L in Jacobian
-        err = MatSetValues(jacobianMatrix,
-                           indicesN.size(), &indicesN[0],
-                           indicesL.size(), &indicesL[0],
-                           &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
+        // Entries at positive vertex (L,P and P,L) are the area
+        // associated with the vertex; entries at the negative vertex
+        // (L,N and N,L) are the negative of the area.
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            jacobianVertex[(iL+iDim)*blockSize+iP+iDim] = areaVertex;
+            jacobianVertex[(iP+iDim)*blockSize+iL+iDim] = areaVertex;
+            jacobianVertex[(iL+iDim)*blockSize+iN+iDim] = -areaVertex;
+            jacobianVertex[(iN+iDim)*blockSize+iL+iDim] = -areaVertex;
+        } // for
 
-        // Values at Lagrange vertex, entry L,L in Jacobian
-        // We must have entries on the diagonal.
-        jacobianVertex = 0.0;
         err = MatSetValues(jacobianMatrix,
-                           indicesL.size(), &indicesL[0],
-                           indicesL.size(), &indicesL[0],
+                           indicesVertex.size(), &indicesVertex[0],
+                           indicesVertex.size(), &indicesVertex[0],
                            &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -544,36 +537,32 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
 
     const int spaceDim  = _quadrature->spaceDim();
 
-    PetscSection jacobianGlobalSection = jacobian->globalSection(); assert(jacobianGlobalSection);
-
     topology::VecVisitorMesh jacobianVisitor(*jacobian);
     PetscScalar* jacobianArray = jacobianVisitor.localArray();
 
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-
-        if (e_lagrange < 0) { // Skip clamped edges
+        // Skip clamped edges and compute contribution only if Lagrange
+        // constraint is local.
+        if (offsetsLGlobal[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff = 0;
-        err = PetscSectionGetOffset(jacobianGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0)
-            continue;
-
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventBegin(updateEvent);
 #endif
-        const PetscInt off = jacobianVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == jacobianVisitor.sectionDof(e_lagrange));
+        const PetscInt off = offsetsL[iVertex];
+        assert(off == jacobianVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+        assert(spaceDim == jacobianVisitor.sectionDof(_cohesiveVertices[iVertex].lagrange));
 
         for(PetscInt d = 0; d < spaceDim; ++d) {
             jacobianArray[off+d] = 1.0;
@@ -629,7 +618,6 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     const int setupEvent = _logger->eventId("FaPr setup");
     const int computeEvent = _logger->eventId("FaPr compute");
 #if defined(DETAILED_EVENT_LOGGING)
-    const int restrictEvent = _logger->eventId("FaPr restrict");
     const int updateEvent = _logger->eventId("FaPr update");
 #endif
 
@@ -638,127 +626,103 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     // Get cell information and setup storage for cell data
     const int spaceDim = _quadrature->spaceDim();
 
-    // Allocate vectors for vertex values
-    scalar_array jacobianVertexP(spaceDim*spaceDim);
-    scalar_array jacobianVertexN(spaceDim*spaceDim);
-    scalar_array jacobianInvVertexP(spaceDim);
-    scalar_array jacobianInvVertexN(spaceDim);
-    scalar_array precondVertexL(spaceDim);
-    int_array indicesN(spaceDim);
-    int_array indicesP(spaceDim);
-    int_array indicesRel(spaceDim);
-    for (int i=0; i < spaceDim; ++i) {
-        indicesRel[i] = i;
-    } // for
-
     // Get fields
     topology::Field& area = _fields->get("area");
     topology::VecVisitorMesh areaVisitor(area);
     const PetscScalar* areaArray = areaVisitor.localArray();
 
-    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsArea = _cohesiveOffsets.area;
 
-    PetscDM lagrangeDM = fields->solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
-    PetscSection lagrangeGlobalSection = NULL;
-    PetscErrorCode err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
+    // Index sets, offsets, and the submatrix are reused across
+    // reformations of the Jacobian as long as the layout is unchanged.
+    _updatePreconditionerCache(*jacobian, *fields);
+    PreconditionerCache& cache = _precondCache;
+    const int_array& offsetsN = cache.negative;
+    const int_array& offsetsP = cache.positive;
+    const int_array& offsetsPrecond = cache.lagrange;
+
+    // Values already in the preconditioner matrix only need to be
+    // inserted again if they changed.
+    const bool insertAll = cache.precondMatrix != *precondMatrix;
+    cache.precondMatrix = *precondMatrix;
+
+    const int numVertices = _cohesiveVertices.size();
+    scalar_array precondValues(numVertices*spaceDim);
+
+    PetscErrorCode err = 0;
+    const PetscScalar* diagonalArray = NULL;
+    err = VecGetArrayRead(cache.diagonalNP, &diagonalArray); PYLITH_CHECK_ERROR(err);
 
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscMat jacobianNP = NULL;
-    std::map<int, int> indicesMatToSubmat;
-    _getJacobianSubmatrixNP(&jacobianNP, &indicesMatToSubmat, *jacobian, *fields);
-
-    const int numVertices = _cohesiveVertices.size();
+    // Vertices are independent and only touch local arrays.
+#if defined(THREADED_VERTEX_LOOPS)
+#pragma omp parallel for schedule(static)
+#endif
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
-            continue;
-        } // if
-
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0) {
+        // Skip clamped edges and compute contribution only if Lagrange
+        // constraint is local.
+        if (offsetsPrecond[iVertex] < 0) {
             continue;
         } // if
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
         // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        indicesN = indicesRel + indicesMatToSubmat[gnoff];
-        err = MatGetValues(jacobianNP,
-                           indicesN.size(), &indicesN[0], indicesN.size(), &indicesN[0],
-                           &jacobianVertexN[0]); PYLITH_CHECK_ERROR(err);
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        indicesP = indicesRel + indicesMatToSubmat[gpoff];
-        err = MatGetValues(jacobianNP,
-                           indicesP.size(), &indicesP[0], indicesP.size(), &indicesP[0],
-                           &jacobianVertexP[0]); PYLITH_CHECK_ERROR(err);
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
-#endif
-
-        // Compute inverse of Jacobian diagonals
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            jacobianInvVertexN[iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
-            jacobianInvVertexP[iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
-        } // for
+        const PetscInt aoff = offsetsArea[iVertex];
+        const PylithScalar areaVertex = areaArray[aoff];
 
         // Compute -[L] [Adiag]^(-1) [L]^T
         //   L_{ii} = L^T{ii} = areaVertex
-        //   Adiag^{-1}_{ii} = jacobianInvVertexN[i] + jacobianInvVertexP[i]
-        precondVertexL = 0.0;
+        //   Adiag^{-1}_{ii} = 1.0/Kn_{ii} + 1.0/Kp_{ii}
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            precondVertexL[iDim] -= areaArray[aoff] * areaArray[aoff] *
-                                    (jacobianInvVertexN[iDim] + jacobianInvVertexP[iDim]);
+            precondValues[iVertex*spaceDim+iDim] = -areaVertex * areaVertex *
+                (1.0/diagonalArray[noff+iDim] + 1.0/diagonalArray[poff+iDim]);
         } // for
-
+    } // for
+    err = VecRestoreArrayRead(cache.diagonalNP, &diagonalArray); PYLITH_CHECK_ERROR(err);
+    PetscLogFlops(numVertices*spaceDim*6);
 
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
-        _logger->eventBegin(updateEvent);
+    _logger->eventBegin(updateEvent);
 #endif
 
-        // Set diagonal entries in preconditioned matrix.
-        PetscInt poff = 0;
-        err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff); PYLITH_CHECK_ERROR(err);
+    // Set diagonal entries in preconditioner matrix.
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const PetscInt pcoff = offsetsPrecond[iVertex];
+        if (pcoff < 0) {
+            continue;
+        } // if
+
+        bool changed = insertAll;
+        for (int iDim=0; iDim < spaceDim && !changed; ++iDim) {
+            changed = precondValues[iVertex*spaceDim+iDim] != cache.values[iVertex*spaceDim+iDim];
+        } // for
+        if (!changed) {
+            continue;
+        } // if
 
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+            const PylithScalar value = precondValues[iVertex*spaceDim+iDim];
+            err = MatSetValue(*precondMatrix, pcoff+iDim, pcoff+iDim, value, INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+            cache.values[iVertex*spaceDim+iDim] = value;
         } // for
 
 #if 0 // DEBUGGING
-        std::cout << "1/P_vertex " << e_lagrange << ", poff: " << poff << std::endl;
+        std::cout << "1/P_vertex " << _cohesiveVertices[iVertex].lagrange << ", pcoff: " << pcoff << std::endl;
         for(int iDim = 0; iDim < spaceDim; ++iDim) {
-            std::cout << "  " << precondVertexL[iDim] << std::endl;
+            std::cout << "  " << precondValues[iVertex*spaceDim+iDim] << std::endl;
         } // for
 #endif
-
+    } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
+    _logger->eventEnd(updateEvent);
 #endif
-    } // for
-    err = MatDestroy(&jacobianNP); PYLITH_CHECK_ERROR(err);
-    PetscLogFlops(numVertices*spaceDim*6);
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -777,6 +741,37 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
 { // adjustSolnLumped
     PYLITH_METHOD_BEGIN;
 
+    assert(_quadrature);
+
+    switch (_quadrature->spaceDim()) { // switch
+    case 1:
+        _adjustSolnLumpedDim<1>(fields, t, jacobian);
+        break;
+    case 2:
+        _adjustSolnLumpedDim<2>(fields, t, jacobian);
+        break;
+    case 3:
+        _adjustSolnLumpedDim<3>(fields, t, jacobian);
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown spatial dimension in FaultCohesiveLagrange::adjustSolnLumped().");
+    } // switch
+
+    PYLITH_METHOD_END;
+} // adjustSolnLumped
+
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian to match Lagrange
+// multiplier constraints for spatial dimension dim.
+template<int dim>
+void
+pylith::faults::FaultCohesiveLagrange::_adjustSolnLumpedDim(topology::SolutionFields* const fields,
+                                                            const PylithScalar t,
+                                                            const topology::Field& jacobian)
+{ // _adjustSolnLumpedDim
+    PYLITH_METHOD_BEGIN;
+
     assert(fields);
     assert(_quadrature);
 
@@ -801,15 +796,12 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
 
     const int setupEvent = _logger->eventId("FaAS setup");
     const int computeEvent = _logger->eventId("FaAS compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaAS geometry");
-    const int restrictEvent = _logger->eventId("FaAS restrict");
-#endif
 
     _logger->eventBegin(setupEvent);
 
     // Get cell information and setup storage for cell data
-    const int spaceDim = _quadrature->spaceDim();
+    const int spaceDim = dim;
+    assert(_quadrature->spaceDim() == spaceDim);
 
     // Get fields
     topology::Field& area = _fields->get("area");
@@ -831,7 +823,13 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
     topology::VecVisitorMesh dispTIncrAdjVisitor(dispTIncrAdj);
     PetscScalar* dispTIncrAdjArray = dispTIncrAdjVisitor.localArray();
 
-    PetscSection jacobianGlobalSection = jacobian.globalSection(); assert(jacobianGlobalSection);
+    // Offsets are shared by all fields over the domain.
+    _updateCohesiveOffsets(*fields);
+    const int_array& offsetsN = _cohesiveOffsets.negative;
+    const int_array& offsetsP = _cohesiveOffsets.positive;
+    const int_array& offsetsL = _cohesiveOffsets.lagrange;
+    const int_array& offsetsLGlobal = _cohesiveOffsets.lagrangeGlobal;
+    const int_array& offsetsArea = _cohesiveOffsets.area;
 
     _logger->eventEnd(setupEvent);
 
@@ -839,86 +837,47 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges
+        if (_cohesiveVertices[iVertex].lagrange < 0) { // Skip clamped edges
             continue;
         } // if
 
+        const PetscInt noff = offsetsN[iVertex];
+        const PetscInt poff = offsetsP[iVertex];
+        const PetscInt loff = offsetsL[iVertex];
+        assert(noff == jacobianVisitor.sectionOffset(_cohesiveVertices[iVertex].negative));
+        assert(poff == dispTIncrAdjVisitor.sectionOffset(_cohesiveVertices[iVertex].positive));
+        assert(loff == residualVisitor.sectionOffset(_cohesiveVertices[iVertex].lagrange));
+
         // Set Lagrange multiplier value. Value from preliminary solve is
         // bogus due to artificial diagonal entry.
-        const PetscInt dtloff = dispTIncrVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            dispTIncrArray[dtloff+d] = 0.0;
+            dispTIncrArray[loff+d] = 0.0;
         } // for
 
         // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff;
-        err = PetscSectionGetOffset(jacobianGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
+        if (offsetsLGlobal[iVertex] < 0) {
             continue;
         } // if
 
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
-
-        // Residual at Lagrange vertex.
-        const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
-
-        // Get jacobian at cohesive cell's vertices.
-        const PetscInt jnoff = jacobianVisitor.sectionOffset(v_negative);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_negative));
-
-        const PetscInt jpoff = jacobianVisitor.sectionOffset(v_positive);
-        assert(spaceDim == jacobianVisitor.sectionDof(v_positive));
-
-        // Area at fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault)); assert(areaArray[aoff] > 0.0);
-
-        // Get dispIncr(t) at cohesive cell vertices.
-        const PetscInt dtnoff = dispTIncrVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
-
-        const PetscInt dtpoff = dispTIncrVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
-
-        // Get dispIncrAdj at cohesive cell vertices.
-        const PetscInt danoff = dispTIncrAdjVisitor.sectionOffset(v_negative);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_negative));
-
-        const PetscInt dapoff = dispTIncrAdjVisitor.sectionOffset(v_positive);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(v_positive));
-
-        const PetscInt daloff = dispTIncrAdjVisitor.sectionOffset(e_lagrange);
-        assert(spaceDim == dispTIncrAdjVisitor.sectionDof(e_lagrange));
-
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
         _logger->eventBegin(computeEvent);
 #endif
 
-        const PetscScalar areaVertex = areaArray[aoff];
+        const PetscScalar areaVertex = areaArray[offsetsArea[iVertex]];
+        assert(areaVertex > 0.0);
         for(PetscInt d = 0; d < spaceDim; ++d) {
-            const PylithScalar S = (1.0/jacobianArray[jpoff+d] + 1.0/jacobianArray[jnoff+d]) * areaVertex * areaVertex;
+            const PylithScalar S = (1.0/jacobianArray[poff+d] + 1.0/jacobianArray[noff+d]) * areaVertex * areaVertex;
             // Set Lagrange multiplier value (value from preliminary solve is bogus due to artificial diagonal entry)
-            dispTIncrAdjArray[daloff+d] = 1.0/S * (-residualArray[rloff+d] + areaArray[aoff] * (dispTIncrArray[dtpoff+d] - dispTIncrArray[dtnoff+d]));
+            dispTIncrAdjArray[loff+d] = 1.0/S * (-residualArray[loff+d] + areaVertex * (dispTIncrArray[poff+d] - dispTIncrArray[noff+d]));
 
             // Adjust displacements to account for Lagrange multiplier values (assumed to be zero in preliminary solve).
-            assert(jacobianArray[jnoff+d] > 0.0);
-            dispTIncrAdjArray[danoff+d] +=  +areaVertex / jacobianArray[jnoff+d] * dispTIncrAdjArray[dtloff+d];
+            assert(jacobianArray[noff+d] > 0.0);
+            dispTIncrAdjArray[noff+d] +=  +areaVertex / jacobianArray[noff+d] * dispTIncrAdjArray[loff+d];
 
-            assert(jacobianArray[jpoff+d] > 0.0);
-            dispTIncrAdjArray[dapoff+d] += -areaVertex / jacobianArray[jpoff+d] * dispTIncrAdjArray[dtloff+d];
+            assert(jacobianArray[poff+d] > 0.0);
+            dispTIncrAdjArray[poff+d] += -areaVertex / jacobianArray[poff+d] * dispTIncrAdjArray[loff+d];
         } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
@@ -932,7 +891,7 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
 #endif
 
     PYLITH_METHOD_END;
-} // adjustSolnLumped
+} // _adjustSolnLumpedDim
 
 // ----------------------------------------------------------------------
 // Verify configuration is acceptable.
@@ -1202,9 +1161,93 @@ void pylith::faults::FaultCohesiveLagrange::_initializeCohesiveInfo(const topolo
     } // for
     assert(size_t(index) == _cohesiveVertices.size());
 
+    // Force offsets to be recomputed for new cohesive vertices.
+    _cohesiveOffsets.solnSection = NULL;
+
     PYLITH_METHOD_END;
 } // _initializeCohesiveInfo
 
+// ----------------------------------------------------------------------
+// Update offsets of cohesive vertices into local arrays of fields.
+void
+pylith::faults::FaultCohesiveLagrange::_updateCohesiveOffsets(const topology::SolutionFields& fields)
+{ // _updateCohesiveOffsets
+    PYLITH_METHOD_BEGIN;
+
+    assert(_fields);
+
+    const topology::Field& solution = fields.solution();
+    PetscSection solnSection = solution.localSection(); assert(solnSection);
+    PetscSection solnGlobalSection = solution.globalSection(); assert(solnGlobalSection);
+
+    PetscErrorCode err = 0;
+    PetscObjectState solnState = 0;
+    err = PetscObjectStateGet((PetscObject)solnSection, &solnState); PYLITH_CHECK_ERROR(err);
+    const size_t numVertices = _cohesiveVertices.size();
+    if (solnSection == _cohesiveOffsets.solnSection && solnState == _cohesiveOffsets.solnState &&
+        numVertices == _cohesiveOffsets.lagrange.size()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
+    topology::VecVisitorMesh orientationVisitor(_fields->get("orientation"));
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+
+    CohesiveOffsets& offsets = _cohesiveOffsets;
+    offsets.negative.resize(numVertices);
+    offsets.positive.resize(numVertices);
+    offsets.lagrange.resize(numVertices);
+    offsets.negativeGlobal.resize(numVertices);
+    offsets.positiveGlobal.resize(numVertices);
+    offsets.lagrangeGlobal.resize(numVertices);
+    offsets.fault.resize(numVertices);
+    offsets.orientation.resize(numVertices);
+    offsets.area.resize(numVertices);
+    for (size_t iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+        const int v_negative = _cohesiveVertices[iVertex].negative;
+        const int v_positive = _cohesiveVertices[iVertex].positive;
+
+        if (e_lagrange < 0) { // Clamped vertex.
+            offsets.negative[iVertex] = -1;
+            offsets.positive[iVertex] = -1;
+            offsets.lagrange[iVertex] = -1;
+            offsets.negativeGlobal[iVertex] = -1;
+            offsets.positiveGlobal[iVertex] = -1;
+            offsets.lagrangeGlobal[iVertex] = -1;
+            offsets.fault[iVertex] = -1;
+            offsets.orientation[iVertex] = -1;
+            offsets.area[iVertex] = -1;
+            continue;
+        } // if
+
+        PetscInt off = 0;
+        err = PetscSectionGetOffset(solnSection, v_negative, &off); PYLITH_CHECK_ERROR(err);
+        offsets.negative[iVertex] = off;
+        err = PetscSectionGetOffset(solnSection, v_positive, &off); PYLITH_CHECK_ERROR(err);
+        offsets.positive[iVertex] = off;
+        err = PetscSectionGetOffset(solnSection, e_lagrange, &off); PYLITH_CHECK_ERROR(err);
+        offsets.lagrange[iVertex] = off;
+
+        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &off); PYLITH_CHECK_ERROR(err);
+        offsets.negativeGlobal[iVertex] = off < 0 ? -(off+1) : off;
+        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &off); PYLITH_CHECK_ERROR(err);
+        offsets.positiveGlobal[iVertex] = off < 0 ? -(off+1) : off;
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &off); PYLITH_CHECK_ERROR(err);
+        offsets.lagrangeGlobal[iVertex] = off;
+
+        offsets.fault[iVertex] = dispRelVisitor.sectionOffset(v_fault);
+        offsets.orientation[iVertex] = orientationVisitor.sectionOffset(v_fault);
+        offsets.area[iVertex] = areaVisitor.sectionOffset(v_fault);
+    } // for
+
+    offsets.solnSection = solnSection;
+    offsets.solnState = solnState;
+
+    PYLITH_METHOD_END;
+} // _updateCohesiveOffsets
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -1265,7 +1308,7 @@ pylith::faults::FaultCohesiveLagrange::faultToGlobal(topology::Field* field,
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
 
-    topology::VecVisitorMesh orientationVisitor(faultOrientation);
+    topology::VecVisitorMesh orientationVisitor(faultOrientation, 0, true);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     PetscDM dmMesh = field->mesh().dmMesh(); assert(dmMesh);
@@ -1320,7 +1363,7 @@ pylith::faults::FaultCohesiveLagrange::globalToFault(topology::Field* field,
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
 
-    topology::VecVisitorMesh orientationVisitor(faultOrientation);
+    topology::VecVisitorMesh orientationVisitor(faultOrientation, 0, true);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     PetscDM dmMesh = field->mesh().dmMesh(); assert(dmMesh);
@@ -1773,11 +1816,11 @@ pylith::faults::FaultCohesiveLagrange::_calcTractionsChange(topology::Field* tra
     const int spaceDim = _quadrature->spaceDim();
 
     // Get fields
-    topology::VecVisitorMesh dispTVisitor(dispT);
+    topology::VecVisitorMesh dispTVisitor(dispT, 0, true);
     const PetscScalar* dispTArray = dispTVisitor.localArray();
 
     topology::Field& orientation = _fields->get("orientation");
-    topology::VecVisitorMesh orientationVisitor(orientation);
+    topology::VecVisitorMesh orientationVisitor(orientation, 0, true);
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     // Allocate buffer for tractions field (if necessary).
@@ -1875,79 +1918,187 @@ pylith::faults::FaultCohesiveLagrange::_allocateBufferScalarField(void)
 } // _allocateBufferScalarField
 
 // ----------------------------------------------------------------------
-//  Get submatrix of Jacobian matrix associated with the negative and
-//  positive sides of the fault.
+// Get persistent buffer for derived vector field.
+pylith::topology::Field&
+pylith::faults::FaultCohesiveLagrange::_derivedBufferVectorField(const char* name)
+{ // _derivedBufferVectorField
+    PYLITH_METHOD_BEGIN;
+
+    assert(name);
+    assert(_fields);
+
+    const std::string& bufferName = std::string("buffer (") + name + ")";
+    if (!_fields->hasField(bufferName.c_str())) {
+        // Use same shape/chart as relative displacement field.
+        assert(_faultMesh);
+        _fields->add(bufferName.c_str(), name);
+        topology::Field& buffer = _fields->get(bufferName.c_str());
+        const topology::Field& dispRel = _fields->get("relative disp");
+        buffer.cloneSection(dispRel);
+        buffer.zeroAll();
+        assert(buffer.vectorFieldType() == topology::FieldBase::VECTOR);
+        _derivedFields.erase(name);
+    } // if
+
+    topology::Field& buffer = _fields->get(bufferName.c_str());
+    PYLITH_METHOD_RETURN(buffer);
+} // _derivedBufferVectorField
+
+// ----------------------------------------------------------------------
+// Check whether values in buffer of derived field are current.
+bool
+pylith::faults::FaultCohesiveLagrange::_isDerivedFieldCurrent(const char* name,
+                                                              const topology::Field* const* dependencies,
+                                                              const int numDependencies) const
+{ // _isDerivedFieldCurrent
+    PYLITH_METHOD_BEGIN;
+
+    assert(name);
+    assert(dependencies);
+
+    const std::map<std::string, DerivedFieldState>::const_iterator iter = _derivedFields.find(name);
+    if (iter == _derivedFields.end() || size_t(numDependencies) != iter->second.vectors.size()) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err = 0;
+    for (int i = 0; i < numDependencies; ++i) {
+        assert(dependencies[i]);
+        const PetscVec vector = dependencies[i]->localVector();
+        PetscObjectState state = 0;
+        err = PetscObjectStateGet((PetscObject)vector, &state); PYLITH_CHECK_ERROR(err);
+        if (vector != iter->second.vectors[i] || state != iter->second.states[i]) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(true);
+} // _isDerivedFieldCurrent
+
+// ----------------------------------------------------------------------
+// Record states of fields used to compute derived field.
 void
-pylith::faults::FaultCohesiveLagrange::_getJacobianSubmatrixNP(PetscMat* jacobianSub,
-                                                               std::map<int,int>* indicesMatToSubmat,
-                                                               const topology::Jacobian& jacobian,
-                                                               const topology::SolutionFields& fields)
-{ // _getJacobianSubmatrixNP
+pylith::faults::FaultCohesiveLagrange::_derivedFieldComputed(const char* name,
+                                                             const topology::Field* const* dependencies,
+                                                             const int numDependencies)
+{ // _derivedFieldComputed
     PYLITH_METHOD_BEGIN;
 
-    assert(jacobianSub);
-    assert(indicesMatToSubmat);
+    assert(name);
+    assert(dependencies);
 
-    // Get global order
-    PetscSection solutionGlobalSection = fields.solution().globalSection(); assert(solutionGlobalSection);
+    DerivedFieldState& derived = _derivedFields[name];
+    derived.vectors.resize(numDependencies);
+    derived.states.resize(numDependencies);
 
-    PetscErrorCode err;
+    PetscErrorCode err = 0;
+    for (int i = 0; i < numDependencies; ++i) {
+        assert(dependencies[i]);
+        derived.vectors[i] = dependencies[i]->localVector();
+        err = PetscObjectStateGet((PetscObject)derived.vectors[i], &derived.states[i]); PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _derivedFieldComputed
+
+// ----------------------------------------------------------------------
+// Update cached data for the custom preconditioner and extract the
+// diagonal of the Jacobian for the degrees of freedom on the negative
+// and positive sides of the fault.
+void
+pylith::faults::FaultCohesiveLagrange::_updatePreconditionerCache(const topology::Jacobian& jacobian,
+                                                                  const topology::SolutionFields& fields)
+{ // _updatePreconditionerCache
+    PYLITH_METHOD_BEGIN;
+
+    PreconditionerCache& cache = _precondCache;
 
     // Get Jacobian matrix
-    const PetscMat jacobianMatrix = jacobian.matrix();
-    assert(jacobianMatrix);
+    const PetscMat jacobianMatrix = jacobian.matrix(); assert(jacobianMatrix);
+
+    PetscSection solnSection = fields.solution().localSection(); assert(solnSection);
+    PetscErrorCode err = 0;
+    PetscObjectState solnState = 0;
+    err = PetscObjectStateGet((PetscObject)solnSection, &solnState); PYLITH_CHECK_ERROR(err);
+    const size_t numVertices = _cohesiveVertices.size();
+
+    if (solnSection == cache.solnSection && solnState == cache.solnState &&
+        jacobianMatrix == cache.jacobianMatrix && numVertices == cache.lagrange.size()) {
+        // Update values of submatrix in place.
+        PetscMat* subMat = &cache.jacobianNP;
+        err = MatCreateSubMatrices(jacobianMatrix, 1, &cache.indicesNP, &cache.indicesNP, MAT_REUSE_MATRIX, &subMat); PYLITH_CHECK_ERROR(err);
+        err = MatGetDiagonal(cache.jacobianNP, cache.diagonalNP); PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_END;
+    } // if
+
+    _destroyPreconditionerCache();
+
+    // Get global order
+    PetscSection solutionGlobalSection = fields.solution().globalSection(); assert(solutionGlobalSection);
+
+    PetscDM lagrangeDM = fields.solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
+    PetscSection lagrangeGlobalSection = NULL;
+    err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
 
     const spatialdata::geocoords::CoordSys* cs = fields.mesh().coordsys(); assert(cs);
     const int spaceDim = cs->spaceDim();
 
-    const int numVertices = _cohesiveVertices.size();
+    cache.negative.resize(numVertices);
+    cache.positive.resize(numVertices);
+    cache.lagrange.resize(numVertices);
+    cache.values.resize(numVertices*spaceDim);
+    cache.negative = -1;
+    cache.positive = -1;
+    cache.lagrange = -1;
+    cache.values = 0.0;
+
+    // Global offsets of negative and positive vertices, used to map
+    // global indices to indices in the submatrix.
+    int_array globalN(numVertices);
+    int_array globalP(numVertices);
     int numIndicesNP = 0;
-    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    for (size_t iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         if (e_lagrange < 0) { // Ignore clamped edges.
             continue;
         } // if
 
         // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
+        PetscInt gloff = 0;
+        err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
+        if (gloff < 0) {
             continue;
         } // if
 
+        PetscInt gnoff = 0;
+        err = PetscSectionGetOffset(solutionGlobalSection, _cohesiveVertices[iVertex].negative, &gnoff); PYLITH_CHECK_ERROR(err);
+        globalN[iVertex] = gnoff < 0 ? -(gnoff+1) : gnoff;
+
+        PetscInt gpoff = 0;
+        err = PetscSectionGetOffset(solutionGlobalSection, _cohesiveVertices[iVertex].positive, &gpoff); PYLITH_CHECK_ERROR(err);
+        globalP[iVertex] = gpoff < 0 ? -(gpoff+1) : gpoff;
+
+        PetscInt pcoff = 0;
+        err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &pcoff); PYLITH_CHECK_ERROR(err);
+        cache.lagrange[iVertex] = pcoff;
+
         numIndicesNP += 2;
     } // for
-    int_array indicesNP(numIndicesNP*spaceDim);
 
-    for (int iVertex=0, indexNP=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Ignore clamped edges.
+    int_array indicesNP(numIndicesNP*spaceDim);
+    for (size_t iVertex=0, indexNP=0; iVertex < numVertices; ++iVertex) {
+        if (cache.lagrange[iVertex] < 0) {
             continue;
         } // if
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0)
-            continue;
-
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        gnoff = gnoff < 0 ? -(gnoff+1) : gnoff;
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
-
         // Set global order indices
-        for(int iDim=0; iDim < spaceDim; ++iDim)
-            indicesNP[indexNP*spaceDim+iDim] = gnoff + iDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            indicesNP[indexNP*spaceDim+iDim] = globalN[iVertex] + iDim;
+        } // for
         ++indexNP;
-        for(int iDim=0; iDim < spaceDim; ++iDim)
-            indicesNP[indexNP*spaceDim+iDim] = gpoff + iDim;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            indicesNP[indexNP*spaceDim+iDim] = globalP[iVertex] + iDim;
+        } // for
         ++indexNP;
     } // for
 
@@ -1955,23 +2106,54 @@ pylith::faults::FaultCohesiveLagrange::_getJacobianSubmatrixNP(PetscMat* jacobia
     std::sort(&indicesNP[0], &indicesNP[indicesNP.size()]);
 
     PetscMat* subMat = NULL;
-    IS indicesIS[1];
-    err = ISCreateGeneral(PETSC_COMM_SELF, indicesNP.size(), &indicesNP[0], PETSC_USE_POINTER, &indicesIS[0]);PYLITH_CHECK_ERROR(err);
-    err = MatCreateSubMatrices(jacobianMatrix, 1, indicesIS, indicesIS, MAT_INITIAL_MATRIX, &subMat);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&indicesIS[0]); PYLITH_CHECK_ERROR(err);
-
-    *jacobianSub = subMat[0];
+    err = ISCreateGeneral(PETSC_COMM_SELF, indicesNP.size(), &indicesNP[0], PETSC_COPY_VALUES, &cache.indicesNP); PYLITH_CHECK_ERROR(err);
+    err = MatCreateSubMatrices(jacobianMatrix, 1, &cache.indicesNP, &cache.indicesNP, MAT_INITIAL_MATRIX, &subMat); PYLITH_CHECK_ERROR(err);
+    cache.jacobianNP = subMat[0];
     err = PetscFree(subMat); PYLITH_CHECK_ERROR(err);
+    err = MatCreateVecs(cache.jacobianNP, &cache.diagonalNP, NULL); PYLITH_CHECK_ERROR(err);
+    err = MatGetDiagonal(cache.jacobianNP, cache.diagonalNP); PYLITH_CHECK_ERROR(err);
 
-    // Create map from global indices to local indices (using only the
-    // first index as to match the global order.
-    indicesMatToSubmat->clear();
+    // Map global indices to indices in the submatrix (using only the
+    // first index of each vertex to match the global order).
+    std::map<int, int> indicesMatToSubmat;
     const int indicesNPSize = indicesNP.size();
-    for (int i=0; i < indicesNPSize; i+=spaceDim)
-        (*indicesMatToSubmat)[indicesNP[i]] = i;
+    for (int i=0; i < indicesNPSize; i+=spaceDim) {
+        indicesMatToSubmat[indicesNP[i]] = i;
+    } // for
+    for (size_t iVertex=0; iVertex < numVertices; ++iVertex) {
+        if (cache.lagrange[iVertex] < 0) {
+            continue;
+        } // if
+        cache.negative[iVertex] = indicesMatToSubmat[globalN[iVertex]];
+        cache.positive[iVertex] = indicesMatToSubmat[globalP[iVertex]];
+    } // for
+
+    cache.jacobianMatrix = jacobianMatrix;
+    cache.solnSection = solnSection;
+    cache.solnState = solnState;
 
     PYLITH_METHOD_END;
-} // _getJacobianSubmatrixNP
+} // _updatePreconditionerCache
+
+// ----------------------------------------------------------------------
+// Destroy cached data for the custom preconditioner.
+void
+pylith::faults::FaultCohesiveLagrange::_destroyPreconditionerCache(void)
+{ // _destroyPreconditionerCache
+    PYLITH_METHOD_BEGIN;
+
+    PreconditionerCache& cache = _precondCache;
+    PetscErrorCode err = 0;
+    err = ISDestroy(&cache.indicesNP); PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&cache.jacobianNP); PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&cache.diagonalNP); PYLITH_CHECK_ERROR(err);
+    cache.precondMatrix = NULL;
+    cache.jacobianMatrix = NULL;
+    cache.solnSection = NULL;
+    cache.solnState = 0;
+
+    PYLITH_METHOD_END;
+} // _destroyPreconditionerCache
 
 
 // ----------------------------------------------------------------------
@@ -1983,6 +2165,10 @@ pylith::faults::FaultCohesiveLagrange::cellField(const char* name,
     PYLITH_METHOD_BEGIN;
 
     if (0 == strcasecmp("partition", name)) {
+        // Partition does not change, so we only compute it once.
+        if (_fields->hasField("partition")) {
+            PYLITH_METHOD_RETURN(_fields->get("partition"));
+        } // if
 
         PetscDM faultDMMesh = _faultMesh->dmMesh(); assert(faultDMMesh);
         topology::Stratum cellsStratum(faultDMMesh, topology::Stratum::HEIGHT, 1);
@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "FaultCohesive.hh" // ISA FaultCohesive
 
+#include <vector> // HASA std::vector
+
 // FaultCohesiveLagrange -----------------------------------------------------
 /**
  * @brief C++ abstract base class for implementing falt slip using
@@ -85,6 +87,7 @@
 class pylith::faults::FaultCohesiveLagrange : public FaultCohesive
 { // class FaultCohesiveLagrange
   friend class TestFaultCohesiveLagrange; // unit testing
+  friend class FaultCohesiveKinBatch; // batched residual
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
@@ -250,6 +253,57 @@ protected :
     int fault; ///< Point (vertex) in fault mesh.
   };
 
+  /** Offsets of the points of each cohesive vertex into the local
+   *  arrays of fields, stored as a structure of arrays indexed by
+   *  cohesive vertex (same order as _cohesiveVertices).
+   *
+   *  Offsets into fields over the domain are taken from the solution
+   *  field; the other solution fields (disp(t), dispIncr(t->t+dt),
+   *  residual, etc) share its layout. Offsets into vector fields over
+   *  the fault are taken from the relative displacement field. Clamped
+   *  vertices have offsets of -1.
+   */
+  struct CohesiveOffsets {
+    int_array negative; ///< Offset of vertex on negative side in domain fields.
+    int_array positive; ///< Offset of vertex on positive side in domain fields.
+    int_array lagrange; ///< Offset of Lagrange multiplier point in domain fields.
+    int_array negativeGlobal; ///< Global offset of vertex on negative side.
+    int_array positiveGlobal; ///< Global offset of vertex on positive side.
+    int_array lagrangeGlobal; ///< Global offset of Lagrange point (< 0 if not local).
+    int_array fault; ///< Offset of fault vertex in vector fields over fault.
+    int_array orientation; ///< Offset of fault vertex in orientation field.
+    int_array area; ///< Offset of fault vertex in area field.
+    PetscSection solnSection; ///< Layout of domain fields used for offsets.
+    PetscObjectState solnState; ///< State of layout when offsets were computed.
+  };
+
+  /** Cached data for the custom preconditioner of the Lagrange
+   *  multipliers. Offsets are -1 for clamped vertices and vertices
+   *  whose Lagrange constraint is not local.
+   */
+  struct PreconditionerCache {
+    PetscIS indicesNP; ///< Global indices of DOF on negative and positive sides.
+    PetscMat jacobianNP; ///< Submatrix of Jacobian for indicesNP.
+    PetscVec diagonalNP; ///< Diagonal of submatrix.
+    int_array negative; ///< Offset of vertex on negative side in submatrix.
+    int_array positive; ///< Offset of vertex on positive side in submatrix.
+    int_array lagrange; ///< Global offset of Lagrange point in preconditioner.
+    scalar_array values; ///< Preconditioner values inserted at each vertex.
+    PetscMat precondMatrix; ///< Preconditioner matrix holding values.
+    PetscMat jacobianMatrix; ///< Jacobian matrix used for submatrix.
+    PetscSection solnSection; ///< Layout of solution field used for cache.
+    PetscObjectState solnState; ///< State of layout when cache was built.
+  };
+
+  /** States of the local vectors of the fields used to compute a
+   *  derived field for output, recorded when the values in the
+   *  buffer for the derived field were last computed.
+   */
+  struct DerivedFieldState {
+    std::vector<PetscVec> vectors; ///< Local vectors of fields used to compute derived field.
+    std::vector<PetscObjectState> states; ///< States of vectors when derived field was computed.
+  };
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -259,6 +313,14 @@ protected :
    */
   void _initializeCohesiveInfo(const topology::Mesh& mesh);
 
+  /** Update offsets of cohesive vertices into local arrays of
+   * fields. The offsets are only recomputed if the layout of the
+   * solution field changed since they were last computed.
+   *
+   * @param fields Solution fields.
+   */
+  void _updateCohesiveOffsets(const topology::SolutionFields& fields);
+
   /** Compute change in tractions on fault surface using solution.
    *
    * @param tractions Field for tractions.
@@ -273,27 +335,120 @@ protected :
   /// Allocate buffer for scalar field.
   void _allocateBufferScalarField(void);
 
-  /** Get submatrix of Jacobian matrix associated with the negative
-   *  and positive sides of the fault.
+  /** Get persistent buffer for vector field over the fault derived
+   *  from other fields (slip, tractions, etc). Each derived field has
+   *  its own buffer with the layout of the relative displacement
+   *  field, so the values remain available for later requests.
+   *
+   * @param name Name of derived field.
+   * @returns Buffer for derived field.
+   */
+  topology::Field& _derivedBufferVectorField(const char* name);
+
+  /** Check whether values in buffer of derived field are current,
+   *  i.e., none of the fields used to compute it have changed since
+   *  the values were computed.
+   *
+   * The check uses the state of the PETSc Vec of each field, which
+   * also increases when the values are accessed for writing, so the
+   * fields used to compute derived fields must be accessed with
+   * read-only visitors.
+   *
+   * @param name Name of derived field.
+   * @param dependencies Fields used to compute derived field.
+   * @param numDependencies Number of fields used to compute derived field.
+   * @returns True if values are current, false otherwise.
+   */
+  bool _isDerivedFieldCurrent(const char* name,
+			      const topology::Field* const* dependencies,
+			      const int numDependencies) const;
+
+  /** Record states of fields used to compute derived field after
+   *  updating the values in its buffer.
+   *
+   * @param name Name of derived field.
+   * @param dependencies Fields used to compute derived field.
+   * @param numDependencies Number of fields used to compute derived field.
+   */
+  void _derivedFieldComputed(const char* name,
+			     const topology::Field* const* dependencies,
+			     const int numDependencies);
+
+  /** Update cached data for the custom preconditioner and extract
+   *  the diagonal of the Jacobian for the degrees of freedom on the
+   *  negative and positive sides of the fault.
    *
-   *  The submatrix and the mapping from global indices to submatrix
-   *  indices are returned through the arguments.
+   *  The index set, the submatrix of the Jacobian, and the offsets of
+   *  the cohesive vertices into the submatrix and the preconditioner
+   *  are only recomputed if the layout of the solution field or the
+   *  Jacobian matrix changed. Otherwise the values of the submatrix
+   *  are updated in place.
    *
-   * @param submatrix PETSc matrix for submatrix.
-   * @param mapGlobalToLocal Mapping from global to local indices.
    * @param jacobian Sparse matrix for Jacobian of system.
    * @param fields Solution fields
    */
-  void _getJacobianSubmatrixNP(PetscMat* submatrix,
-			       std::map<int,int>* mapGlobalToLocal,
-			       const topology::Jacobian& jacobian,
-			       const topology::SolutionFields& fields);
+  void _updatePreconditionerCache(const topology::Jacobian& jacobian,
+				  const topology::SolutionFields& fields);
+
+  /// Destroy cached data for the custom preconditioner.
+  void _destroyPreconditionerCache(void);
+
+  /** Rotate vector at a vertex from the global coordinate system to
+   * the fault coordinate system.
+   *
+   * @param valuesFault Vector in fault coordinate system (result).
+   * @param orientation Orientation at vertex (fault directions are rows).
+   * @param valuesGlobal Vector in global coordinate system.
+   */
+  template<int dim>
+  static
+  void _rotateToFault(PylithScalar* valuesFault,
+		      const PylithScalar* orientation,
+		      const PylithScalar* valuesGlobal);
+
+  /** Rotate vector at a vertex from the fault coordinate system to
+   * the global coordinate system.
+   *
+   * @param valuesGlobal Vector in global coordinate system (result).
+   * @param orientation Orientation at vertex (fault directions are rows).
+   * @param valuesFault Vector in fault coordinate system.
+   */
+  template<int dim>
+  static
+  void _rotateToGlobal(PylithScalar* valuesGlobal,
+		       const PylithScalar* orientation,
+		       const PylithScalar* valuesFault);
 
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
   /// Initialize logger.
   void _initializeLogger(void);
+
+  /** Integrate contribution of cohesive cells to residual term with
+   * the spatial dimension known at compile time.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  template<int dim>
+  void _integrateResidualDim(const topology::Field& residual,
+			     const PylithScalar t,
+			     topology::SolutionFields* const fields);
+
+  /** Adjust solution from solver with lumped Jacobian to match
+   * Lagrange multiplier constraints with the spatial dimension known
+   * at compile time.
+   *
+   * @param fields Solution fields
+   * @param t Current time
+   * @param jacobian Jacobian of the system.
+   */
+  template<int dim>
+  void _adjustSolnLumpedDim(topology::SolutionFields* fields,
+			    const PylithScalar t,
+			    const topology::Field& jacobian);
   
   /** Calculate orientation at fault vertices.
    *
@@ -312,6 +467,15 @@ protected :
   /// Array of cohesive vertex information.
   std::vector<CohesiveInfo> _cohesiveVertices;
 
+  /// Offsets of cohesive vertices into local arrays of fields.
+  CohesiveOffsets _cohesiveOffsets;
+
+  /// Cached data for custom preconditioner.
+  PreconditionerCache _precondCache;
+
+  /// States of fields used to compute derived fields for output.
+  std::map<std::string, DerivedFieldState> _derivedFields;
+
   /// Map label of cohesive cell to label of cells in fault mesh.
   std::map<PetscInt, PetscInt> _cohesiveToFault;
 
@@ -328,6 +492,8 @@ private :
 
 }; // class FaultCohesiveLagrange
 
+#include "FaultCohesiveLagrange.icc" // inline methods
+
 #endif // pylith_faults_faultcohesivelagrange_hh
 
 
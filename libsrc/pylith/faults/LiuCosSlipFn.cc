@@ -168,6 +168,7 @@ pylith::faults::LiuCosSlipFn::initialize(const topology::Mesh& faultMesh,
   PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
   _slipVertex.resize(spaceDim);
+  _resetActiveTimes();
   for(PetscInt v = vStart; v < vEnd; ++v) {
     if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
       continue;
@@ -229,6 +230,9 @@ pylith::faults::LiuCosSlipFn::initialize(const topology::Mesh& faultMesh,
     } // for
     slipTimeArray[stoff] = _slipTimeVertex;
     riseTimeArray[stoff] = _riseTimeVertex;
+
+    // Slip reaches the final slip at 1.525 times the rise time.
+    _updateActiveTimes(_slipTimeVertex, _slipTimeVertex + 1.525*_riseTimeVertex);
   } // for
 
   // Close databases
@@ -24,10 +24,14 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Field.hh" // USES Field
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::SlipTimeFn::SlipTimeFn(void) :
-  _parameters(0)
+  _parameters(0),
+  _startTime(-pylith::PYLITH_MAXSCALAR),
+  _completionTime(pylith::PYLITH_MAXSCALAR)
 { // constructor
 } // constructor
 
@@ -58,5 +62,46 @@ pylith::faults::SlipTimeFn::parameterFields(void) const
   return _parameters;
 } // parameterFields
 
+// ----------------------------------------------------------------------
+// Get earliest time when slip begins at any local point.
+PylithScalar
+pylith::faults::SlipTimeFn::startTime(void) const
+{ // startTime
+  return _startTime;
+} // startTime
+
+// ----------------------------------------------------------------------
+// Get time after which slip at all local points is equal to the
+// final slip.
+PylithScalar
+pylith::faults::SlipTimeFn::completionTime(void) const
+{ // completionTime
+  return _completionTime;
+} // completionTime
+
+// ----------------------------------------------------------------------
+// Reset start and completion times before looping over points.
+void
+pylith::faults::SlipTimeFn::_resetActiveTimes(void)
+{ // _resetActiveTimes
+  // Without any local points, slip never begins and is always complete.
+  _startTime = pylith::PYLITH_MAXSCALAR;
+  _completionTime = -pylith::PYLITH_MAXSCALAR;
+} // _resetActiveTimes
+
+// ----------------------------------------------------------------------
+// Update start and completion times with values at a point.
+void
+pylith::faults::SlipTimeFn::_updateActiveTimes(const PylithScalar slipTime,
+						const PylithScalar completionTime)
+{ // _updateActiveTimes
+  if (slipTime < _startTime) {
+    _startTime = slipTime;
+  } // if
+  if (completionTime > _completionTime) {
+    _completionTime = completionTime;
+  } // if
+} // _updateActiveTimes
+
 
 // End of file 
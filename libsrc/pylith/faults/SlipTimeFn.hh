@@ -95,10 +95,40 @@ public :
    */
   const topology::Fields* parameterFields(void) const;
 
+  /** Get earliest time when slip begins at any local point.
+   *
+   * @returns Time when slip begins (nondimensional).
+   */
+  PylithScalar startTime(void) const;
+
+  /** Get time after which slip at all local points is equal to the
+   * final slip. Slip time functions that cannot bound the time
+   * return PYLITH_MAXSCALAR.
+   *
+   * @returns Time when slip is complete (nondimensional).
+   */
+  PylithScalar completionTime(void) const;
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /// Reset start and completion times before looping over points.
+  void _resetActiveTimes(void);
+
+  /** Update start and completion times with values at a point.
+   *
+   * @param slipTime Time when slip begins at point.
+   * @param completionTime Time after which slip at point is equal to final slip.
+   */
+  void _updateActiveTimes(const PylithScalar slipTime,
+			  const PylithScalar completionTime);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
   topology::Fields* _parameters; ///< Parameters for slip time function.
+  PylithScalar _startTime; ///< Earliest time when slip begins.
+  PylithScalar _completionTime; ///< Time after which slip is final.
 
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
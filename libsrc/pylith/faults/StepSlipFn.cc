@@ -151,6 +151,7 @@ pylith::faults::StepSlipFn::initialize(const topology::Mesh& faultMesh,
   PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
   _slipVertex.resize(spaceDim);
+  _resetActiveTimes();
   for(PetscInt v = vStart; v < vEnd; ++v) {
     if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
       continue;
@@ -198,6 +199,9 @@ pylith::faults::StepSlipFn::initialize(const topology::Mesh& faultMesh,
       finalSlipArray[fsoff+d] = _slipVertex[d];
     } // for
     slipTimeArray[stoff] = _slipTimeVertex;
+
+    // Slip jumps to the final slip at the slip time.
+    _updateActiveTimes(_slipTimeVertex, _slipTimeVertex);
   } // for
 
   // Close databases
@@ -27,12 +27,16 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::sort()
+#include <vector> // USES std::vector
+#include <utility> // USES std::pair
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -157,6 +161,7 @@ pylith::faults::TimeHistorySlipFn::initialize(const topology::Mesh& faultMesh,
   PetscErrorCode err = DMGetLabel(faultDMMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
 
   _slipVertex.resize(spaceDim);
+  _resetActiveTimes();
   for(PetscInt v = vStart; v < vEnd; ++v) {
     if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
       continue;
@@ -204,12 +209,17 @@ pylith::faults::TimeHistorySlipFn::initialize(const topology::Mesh& faultMesh,
       slipAmplitudeArray[saoff+d] = _slipVertex[d];
     } // for
     slipTimeArray[stoff] = _slipTimeVertex;
+
+    // Slip follows an arbitrary time history.
+    _updateActiveTimes(_slipTimeVertex, pylith::PYLITH_MAXSCALAR);
   } // for
 
   // Close databases.
   _dbAmplitude->close();
   _dbSlipTime->close();
 
+  _setupSlipTimeGroups(slipTime);
+
   // Open time history database.
   _dbTimeHistory->open();
   _timeScale = timeScale;
@@ -229,54 +239,54 @@ pylith::faults::TimeHistorySlipFn::slip(topology::Field* slip,
   assert(_parameters);
   assert(_dbTimeHistory);
 
-  // Get vertices in fault mesh
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
   // Get sections
   const topology::Field& slipAmplitude = _parameters->get("slip amplitude");
   topology::VecVisitorMesh slipAmplitudeVisitor(slipAmplitude);
   const PetscScalar* slipAmplitudeArray = slipAmplitudeVisitor.localArray();
 
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
 
+  // Query the time history once per group of vertices with the same
+  // slip time. Groups are sorted by slip time, so we are done at the
+  // first group that has not started slipping.
   const int spaceDim = _slipVertex.size();
+  const int numGroups = _groupSlipTime.size();
   PylithScalar amplitude = 0.0;
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt saoff = slipAmplitudeVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
-    const PetscInt soff = slipVisitor.sectionOffset(v);
+  int numVerticesSlipping = 0;
+  for(int iGroup = 0; iGroup < numGroups; ++iGroup) {
+    PylithScalar relTime = t - _groupSlipTime[iGroup];
+    if (relTime < 0.0) {
+      break;
+    } // if
 
-    assert(spaceDim == slipAmplitudeVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
-    assert(spaceDim == slipVisitor.sectionDof(v));
-
-    PylithScalar relTime = t - slipTimeArray[stoff];
-    if (relTime >= 0.0) {
-      relTime *= _timeScale;
-      const int err = _dbTimeHistory->query(&amplitude, relTime);
-      if (err) {
-        std::ostringstream msg;
-        msg << "Error querying for time '" << relTime
-            << "' in time history database '"
-            << _dbTimeHistory->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
+    relTime *= _timeScale;
+    const int err = _dbTimeHistory->query(&amplitude, relTime);
+    if (err) {
+      std::ostringstream msg;
+      msg << "Error querying for time '" << relTime
+	  << "' in time history database '"
+	  << _dbTimeHistory->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    const int iStart = _groupStart[iGroup];
+    const int iEnd = _groupStart[iGroup+1];
+    for(int i = iStart; i < iEnd; ++i) {
+      const PetscInt v = _groupVertices[i];
+      const PetscInt saoff = slipAmplitudeVisitor.sectionOffset(v);
+      const PetscInt soff = slipVisitor.sectionOffset(v);
+      assert(spaceDim == slipAmplitudeVisitor.sectionDof(v));
+      assert(spaceDim == slipVisitor.sectionDof(v));
 
       for(PetscInt d = 0; d < spaceDim; ++d) {
-        slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
+	slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
       } // for
-    } // else
+    } // for
+    numVerticesSlipping += iEnd - iStart;
   } // for
 
-  PetscLogFlops((vEnd-vStart) * 3);
+  PetscLogFlops(numVerticesSlipping * spaceDim * 2);
 
   PYLITH_METHOD_END;
 } // slip
@@ -301,5 +311,61 @@ pylith::faults::TimeHistorySlipFn::slipTime(void)
   PYLITH_METHOD_RETURN(_parameters->get("slip time"));
 } // slipTime
 
+// ----------------------------------------------------------------------
+// Group vertices with identical slip times.
+void
+pylith::faults::TimeHistorySlipFn::_setupSlipTimeGroups(const topology::Field& slipTime)
+{ // _setupSlipTimeGroups
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = slipTime.mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscDMLabel clamped = NULL;
+  PetscErrorCode err = DMGetLabel(dmMesh, "clamped", &clamped);PYLITH_CHECK_ERROR(err);
+
+  topology::VecVisitorMesh slipTimeVisitor(slipTime);
+  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
+
+  // Clamped vertices have zero slip amplitude, so they are omitted.
+  typedef std::pair<PylithScalar, PetscInt> TimeVertex;
+  std::vector<TimeVertex> timeVertices;
+  timeVertices.reserve(vEnd-vStart);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    if (FaultCohesiveLagrange::isClampedVertex(clamped, v)) {
+      continue;
+    } // if
+    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
+    assert(1 == slipTimeVisitor.sectionDof(v));
+    timeVertices.push_back(TimeVertex(slipTimeArray[stoff], v));
+  } // for
+  std::sort(timeVertices.begin(), timeVertices.end());
+
+  const int numVertices = timeVertices.size();
+  int numGroups = 0;
+  for(int i = 0; i < numVertices; ++i) {
+    if (0 == i || timeVertices[i].first != timeVertices[i-1].first) {
+      ++numGroups;
+    } // if
+  } // for
+
+  _groupSlipTime.resize(numGroups);
+  _groupStart.resize(numGroups+1);
+  _groupVertices.resize(numVertices);
+  for(int i = 0, iGroup = -1; i < numVertices; ++i) {
+    if (0 == i || timeVertices[i].first != timeVertices[i-1].first) {
+      ++iGroup;
+      _groupSlipTime[iGroup] = timeVertices[i].first;
+      _groupStart[iGroup] = i;
+    } // if
+    _groupVertices[i] = timeVertices[i].second;
+  } // for
+  _groupStart[numGroups] = numVertices;
+
+  PYLITH_METHOD_END;
+} // _setupSlipTimeGroups
+
 
 // End of file 
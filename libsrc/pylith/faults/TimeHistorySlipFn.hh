@@ -107,6 +107,20 @@ public :
    */
   const topology::Field& slipTime(void);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Group vertices with identical slip times.
+   *
+   * All vertices share the same time history, so the amplitude only
+   * depends on the slip time. Groups are sorted by increasing slip
+   * time, which allows slip() to query the time history once per group
+   * and to stop at the first group that has not started slipping.
+   *
+   * @param slipTime Field with slip time at each vertex.
+   */
+  void _setupSlipTimeGroups(const topology::Field& slipTime);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -120,6 +134,10 @@ private :
   PylithScalar _timeScale; ///< Time scale.
   scalar_array _slipVertex; ///< Final slip at a vertex.
 
+  scalar_array _groupSlipTime; ///< Slip time of each group (increasing).
+  int_array _groupStart; ///< Index of first vertex in each group (numGroups+1).
+  int_array _groupVertices; ///< Fault vertices ordered by group.
+
   /// Spatial database for amplitude of slip time history.
   spatialdata::spatialdb::SpatialDB* _dbAmplitude;
 
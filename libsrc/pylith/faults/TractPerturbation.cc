@@ -34,6 +34,7 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <map> // USES std::map
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
@@ -43,6 +44,7 @@
 // Default constructor.
 pylith::faults::TractPerturbation::TractPerturbation(void) :
   _parameters(0),
+  _isCalculated(false),
   _timeScale(1.0)
 { // constructor
 } // constructor
@@ -249,6 +251,8 @@ pylith::faults::TractPerturbation::initialize(const topology::Mesh& faultMesh,
       _dbTimeHistory->open();
   } // if
 
+  _setupCalculate();
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -261,106 +265,83 @@ pylith::faults::TractPerturbation::calculate(const PylithScalar t)
 
   assert(_parameters);
 
-  // Get vertices.
-  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
-
   const spatialdata::geocoords::CoordSys* cs = _parameters->mesh().coordsys();assert(cs);
   const int spaceDim = cs->spaceDim();
 
-  topology::Field& valueField = _parameters->get("value");
-  topology::VecVisitorMesh valueVisitor(valueField);
-  PetscScalar* valueArray = valueVisitor.localArray();
-  
-  topology::Field* initialField = (_dbInitial) ? &_parameters->get("initial") : 0;
-  topology::VecVisitorMesh* initialVisitor = (initialField) ? new topology::VecVisitorMesh(*initialField) : 0;
-  PetscScalar* initialArray = (initialVisitor) ? initialVisitor->localArray() : NULL;
+  // The value is unchanged if it was computed previously, no rate of
+  // change has started, and the amplitudes of the changes in value
+  // are the same as in the previous calculation.
+  bool isStatic = _isCalculated;
 
-  topology::Field* rateField = (_dbRate) ? &_parameters->get("rate") : 0;
-  topology::VecVisitorMesh* rateVisitor = (rateField) ? new topology::VecVisitorMesh(*rateField) : 0;
-  PetscScalar* rateArray = (rateVisitor) ? rateVisitor->localArray() : NULL;
+  // Contribution from rate of change of value
+  const int numRate = _rateStartTime.size();
+  for (int i=0; i < numRate && isStatic; ++i) {
+    if (t > _rateStartTime[i]) {
+      isStatic = false;
+    } // if
+  } // for
 
-  topology::Field* rateTimeField = (_dbRate) ? &_parameters->get("rate time") : 0;
-  topology::VecVisitorMesh* rateTimeVisitor = (rateTimeField) ? new topology::VecVisitorMesh(*rateTimeField) : 0;
-  PetscScalar* rateTimeArray = (rateTimeVisitor) ? rateTimeVisitor->localArray() : NULL;
+  // Contribution from change of value. Evaluate time history once for
+  // each distinct start time.
+  const int numChangeTimes = _changeStartTime.size();
+  for (int i=0; i < numChangeTimes; ++i) {
+    const PylithScalar tRel = t - _changeStartTime[i];
+    PylithScalar amplitude = 0.0;
+    if (tRel >= 0) { // change in value over time
+      amplitude = 1.0;
+      if (_dbTimeHistory) {
+	PylithScalar tDim = tRel*_timeScale;
+	const int err = _dbTimeHistory->query(&amplitude, tDim);
+	if (err) {
+	  std::ostringstream msg;
+	  msg << "Error querying for time '" << tDim 
+	      << "' in time history database '"
+	      << _dbTimeHistory->label() << "'.";
+	  throw std::runtime_error(msg.str());
+	} // if
+      } // if
+    } // if
+    if (amplitude != _changeAmplitude[i]) {
+      _changeAmplitude[i] = amplitude;
+      isStatic = false;
+    } // if
+  } // for
 
-  topology::Field* changeField = (_dbChange) ? &_parameters->get("change") : 0;
-  topology::VecVisitorMesh* changeVisitor = (changeField) ? new topology::VecVisitorMesh(*changeField) : 0;
-  PetscScalar* changeArray = (changeVisitor) ? changeVisitor->localArray() : NULL;
+  if (isStatic) {
+    PYLITH_METHOD_END;
+  } // if
 
-  topology::Field* changeTimeField = (_dbChange) ? &_parameters->get("change time") : 0;
-  topology::VecVisitorMesh* changeTimeVisitor = (changeTimeField) ? new topology::VecVisitorMesh(*changeTimeField) : 0;
-  PetscScalar* changeTimeArray = (changeTimeVisitor) ? changeTimeVisitor->localArray() : NULL;
+  topology::Field& valueField = _parameters->get("value");
+  topology::VecVisitorMesh valueVisitor(valueField);
+  PetscScalar* valueArray = valueVisitor.localArray();
 
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt voff = valueVisitor.sectionOffset(v);
-    assert(spaceDim == valueVisitor.sectionDof(v));
+  const int numVertices = _valueOffsets.size();
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const PetscInt voff = _valueOffsets[iVertex];
+
+    // Contribution from initial value
     for (PetscInt d = 0; d < spaceDim; ++d) {
-      valueArray[voff+d] = 0.0;
+      valueArray[voff+d] = _valueInitial[iVertex*spaceDim+d];
     } // for
 
-    // Contribution from initial value
-    if (_dbInitial) {
-      assert(initialVisitor);
-      const PetscInt ioff = initialVisitor->sectionOffset(v);
-      assert(spaceDim == initialVisitor->sectionDof(v));
-      for (PetscInt d = 0; d < spaceDim; ++d) {
-        valueArray[voff+d] += initialArray[ioff+d];
-      } // for
-    } // if
-    
     // Contribution from rate of change of value
-    if (_dbRate) {
-      assert(rateVisitor);
-      const PetscInt roff = rateVisitor->sectionOffset(v);
-      assert(spaceDim == rateVisitor->sectionDof(v));
-      assert(rateTimeVisitor);
-      const PetscInt rtoff = rateTimeVisitor->sectionOffset(v);
-      assert(1 == rateTimeVisitor->sectionDof(v));
-
-      const PylithScalar tRel = t - rateTimeArray[rtoff];
+    if (numRate > 0) {
+      const PylithScalar tRel = t - _rateStartTime[iVertex];
       if (tRel > 0.0)  // rate of change integrated over time
 	for(int iDim = 0; iDim < spaceDim; ++iDim) {
-	  valueArray[voff+iDim] += rateArray[roff+iDim] * tRel;
+	  valueArray[voff+iDim] += _rate[iVertex*spaceDim+iDim] * tRel;
 	} // for
     } // if
 
     // Contribution from change of value
-    if (_dbChange) {
-      assert(changeVisitor);
-      const PetscInt coff = changeVisitor->sectionOffset(v);
-      assert(spaceDim == changeVisitor->sectionDof(v));
-      const PetscInt ctoff = changeTimeVisitor->sectionOffset(v);
-      assert(1 == changeTimeVisitor->sectionDof(v));
-
-      const PylithScalar tRel = t - changeTimeArray[ctoff];
-      if (tRel >= 0) { // change in value over time
-	PylithScalar scale = 1.0;
-	if (_dbTimeHistory) {
-	  PylithScalar tDim = tRel*_timeScale;
-	  const int err = _dbTimeHistory->query(&scale, tDim);
-	  if (err) {
-	    std::ostringstream msg;
-	    msg << "Error querying for time '" << tDim 
-		<< "' in time history database '"
-		<< _dbTimeHistory->label() << "'.";
-	    throw std::runtime_error(msg.str());
-	  } // if
-	} // if
-	for (int iDim = 0; iDim < spaceDim; ++iDim) {
-	  valueArray[voff+iDim] += changeArray[coff+iDim]*scale;
-	} // for
-      } // if
+    if (numChangeTimes > 0) {
+      const PylithScalar amplitude = _changeAmplitude[_changeGroup[iVertex]];
+      for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	valueArray[voff+iDim] += _change[iVertex*spaceDim+iDim]*amplitude;
+      } // for
     } // if
   } // for
-
-  delete initialVisitor; initialVisitor = 0;
-  delete rateVisitor; rateVisitor = 0;
-  delete rateTimeVisitor; rateTimeVisitor = 0;
-  delete changeVisitor; changeVisitor = 0;
-  delete changeTimeVisitor; changeTimeVisitor = 0;
+  _isCalculated = true;
 
   PYLITH_METHOD_END;
 }  // calculate
@@ -429,6 +410,114 @@ pylith::faults::TractPerturbation::_getLabel(void) const
   return _label.c_str();
 } // _getLabel
 
+// ----------------------------------------------------------------------
+// Setup time-independent values and group vertices by start time of
+// change in value for calculating value.
+void
+pylith::faults::TractPerturbation::_setupCalculate(void)
+{ // _setupCalculate
+  PYLITH_METHOD_BEGIN;
+
+  assert(_parameters);
+
+  // Get vertices.
+  PetscDM dmMesh = _parameters->mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  const int numVertices = vEnd - vStart;
+
+  const spatialdata::geocoords::CoordSys* cs = _parameters->mesh().coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  topology::VecVisitorMesh valueVisitor(_parameters->get("value"));
+  _valueOffsets.resize(numVertices);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    assert(spaceDim == valueVisitor.sectionDof(v));
+    _valueOffsets[v-vStart] = valueVisitor.sectionOffset(v);
+  } // for
+
+  _valueInitial.resize(numVertices*spaceDim);
+  if (_dbInitial) {
+    topology::VecVisitorMesh initialVisitor(_parameters->get("initial"));
+    const PetscScalar* initialArray = initialVisitor.localArray();
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt ioff = initialVisitor.sectionOffset(v);
+      assert(spaceDim == initialVisitor.sectionDof(v));
+      for (PetscInt d = 0; d < spaceDim; ++d) {
+	_valueInitial[(v-vStart)*spaceDim+d] = initialArray[ioff+d];
+      } // for
+    } // for
+  } // if
+
+  if (_dbRate) {
+    _rate.resize(numVertices*spaceDim);
+    _rateStartTime.resize(numVertices);
+
+    topology::VecVisitorMesh rateVisitor(_parameters->get("rate"));
+    const PetscScalar* rateArray = rateVisitor.localArray();
+    topology::VecVisitorMesh rateTimeVisitor(_parameters->get("rate time"));
+    const PetscScalar* rateTimeArray = rateTimeVisitor.localArray();
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt roff = rateVisitor.sectionOffset(v);
+      assert(spaceDim == rateVisitor.sectionDof(v));
+      for (PetscInt d = 0; d < spaceDim; ++d) {
+	_rate[(v-vStart)*spaceDim+d] = rateArray[roff+d];
+      } // for
+      const PetscInt rtoff = rateTimeVisitor.sectionOffset(v);
+      assert(1 == rateTimeVisitor.sectionDof(v));
+      _rateStartTime[v-vStart] = rateTimeArray[rtoff];
+    } // for
+  } else {
+    _rate.resize(0);
+    _rateStartTime.resize(0);
+  } // if/else
+
+  if (_dbChange) {
+    _change.resize(numVertices*spaceDim);
+    _changeGroup.resize(numVertices);
+
+    topology::VecVisitorMesh changeVisitor(_parameters->get("change"));
+    const PetscScalar* changeArray = changeVisitor.localArray();
+    topology::VecVisitorMesh changeTimeVisitor(_parameters->get("change time"));
+    const PetscScalar* changeTimeArray = changeTimeVisitor.localArray();
+
+    // Find distinct start times.
+    std::map<PylithScalar,int> startTimes;
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt ctoff = changeTimeVisitor.sectionOffset(v);
+      assert(1 == changeTimeVisitor.sectionDof(v));
+      startTimes[changeTimeArray[ctoff]] = 0;
+    } // for
+    _changeStartTime.resize(startTimes.size());
+    _changeAmplitude.resize(startTimes.size());
+    int index = 0;
+    for (std::map<PylithScalar,int>::iterator t_iter=startTimes.begin(); t_iter != startTimes.end(); ++t_iter, ++index) {
+      t_iter->second = index;
+      _changeStartTime[index] = t_iter->first;
+    } // for
+
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt coff = changeVisitor.sectionOffset(v);
+      assert(spaceDim == changeVisitor.sectionDof(v));
+      for (PetscInt d = 0; d < spaceDim; ++d) {
+	_change[(v-vStart)*spaceDim+d] = changeArray[coff+d];
+      } // for
+      const PetscInt ctoff = changeTimeVisitor.sectionOffset(v);
+      _changeGroup[v-vStart] = startTimes[changeTimeArray[ctoff]];
+    } // for
+  } else {
+    _change.resize(0);
+    _changeGroup.resize(0);
+    _changeStartTime.resize(0);
+    _changeAmplitude.resize(0);
+  } // if/else
+
+  _isCalculated = false;
+
+  PYLITH_METHOD_END;
+} // _setupCalculate
+
 // ----------------------------------------------------------------------
 // Query database for values.
 void
@@ -77,6 +77,12 @@ public :
 		  const spatialdata::units::Nondimensional& normalizer);
 
   /** Calculate spatial and temporal variation of value.
+   *
+   * The time history is evaluated once for each distinct start time
+   * of the change in value. The value is not recomputed if none of
+   * the contributions changed since the previous call (for example,
+   * after all changes in value have started and are constant and
+   * there is no rate of change).
    *
    * @param t Current time.
    */
@@ -122,12 +128,47 @@ protected :
 		const PylithScalar scale,
 		const spatialdata::units::Nondimensional& normalizer);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Setup time-independent values and group vertices by start time
+   * of change in value for calculating value.
+   */
+  void _setupCalculate(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
   
   
   topology::Fields* _parameters; ///< Parameters for perturbations.
 
+  /// Offset of each vertex in value field.
+  int_array _valueOffsets;
+
+  /// Time-independent contribution (initial value) at each vertex.
+  scalar_array _valueInitial;
+
+  /// Rate of change of value at each vertex.
+  scalar_array _rate;
+
+  /// Start time of rate of change of value at each vertex.
+  scalar_array _rateStartTime;
+
+  /// Change in value at each vertex.
+  scalar_array _change;
+
+  /// Index of start time of change in value for each vertex.
+  int_array _changeGroup;
+
+  /// Distinct start times of change in value.
+  scalar_array _changeStartTime;
+
+  /// Amplitude of change for each distinct start time at current time.
+  scalar_array _changeAmplitude;
+
+  /// True if value field holds values from a previous calculation.
+  bool _isCalculated;
+
   /// Time scale for current time.
   PylithScalar _timeScale;
 
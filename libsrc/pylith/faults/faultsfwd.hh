@@ -36,6 +36,7 @@ namespace pylith {
     class FaultCohesive;
     class FaultCohesiveLagrange;
     class FaultCohesiveKin;
+    class FaultCohesiveKinBatch;
     class FaultCohesiveDyn;
     class FaultCohesiveImpulses;
     class FaultCohesiveTract;
@@ -172,6 +172,15 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
 
+  // Keep strain and stress for reuse in updating state variables and
+  // output. They only match the solution after the solver says so.
+  const int tensorCellSize = numQuadPts*tensorSize;
+  _residualStressCurrent = false;
+  if (_reuseResidualStress && _strainResidual.size() != size_t(numCells*tensorCellSize)) {
+    _strainResidual.resize(numCells*tensorCellSize);
+    _stressResidual.resize(numCells*tensorCellSize);
+  } // if
+
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
@@ -258,6 +267,13 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     calcTotalStrainFn(&strainCell, basisDeriv, &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
 
+    if (_reuseResidualStress) {
+      for (int i=0; i < tensorCellSize; ++i) {
+	_strainResidual[c*tensorCellSize+i] = strainCell[i];
+	_stressResidual[c*tensorCellSize+i] = stressCell[i];
+      } // for
+    } // if
+
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
 
 #if 0 // DEBUGGING
@@ -203,6 +203,15 @@ public :
   void updateStateVars(const PylithScalar t,
 		       topology::SolutionFields* const fields);
 
+  /** Set whether state variables computed in the most recent residual
+   * evaluation correspond to the converged solution, so that
+   * updateStateVars() can use them without recomputing them.
+   *
+   * @param flag True if trial state variables are current, false otherwise.
+   */
+  virtual
+  void trialStateVarsCurrent(const bool flag);
+
   /** Constrain solution space.
    *
    * @param fields Solution fields.
@@ -49,7 +49,9 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _outputFields(0),
+    _reuseResidualStress(false),
+    _residualStressCurrent(false)
 { // constructor
 } // constructor
 
@@ -72,6 +74,9 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
     delete _outputFields; _outputFields = 0;
+    _strainResidual.resize(0);
+    _stressResidual.resize(0);
+    _residualStressCurrent = false;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -87,6 +92,27 @@ pylith::feassemble::IntegratorElasticity::material(materials::ElasticMaterial* m
     } // if
 } // material
 
+// ----------------------------------------------------------------------
+// Set whether to keep strain and stress from residual evaluation.
+void
+pylith::feassemble::IntegratorElasticity::reuseResidualStress(const bool flag)
+{ // reuseResidualStress
+    _reuseResidualStress = flag;
+    if (!flag) {
+        _strainResidual.resize(0);
+        _stressResidual.resize(0);
+        _residualStressCurrent = false;
+    } // if
+} // reuseResidualStress
+
+// ----------------------------------------------------------------------
+// Get whether to keep strain and stress from residual evaluation.
+bool
+pylith::feassemble::IntegratorElasticity::reuseResidualStress(void) const
+{ // reuseResidualStress
+    return _reuseResidualStress;
+} // reuseResidualStress
+
 // ----------------------------------------------------------------------
 // Determine whether we need to recompute the Jacobian.
 bool
@@ -160,6 +186,34 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     if (!_material->hasStateVars())
         PYLITH_METHOD_END;
 
+    // Trial state from last residual evaluation is already up to date.
+    if (_material->commitStateVars())
+        PYLITH_METHOD_END;
+
+    assert(_materialIS);
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    const int tensorCellSize = _quadrature->numQuadPts()*_material->tensorSize();
+
+    // Strain from last residual evaluation matches the solution, so
+    // there is no need to compute the geometry and strain.
+    if (_residualStressCurrent) {
+        assert(_strainResidual.size() == size_t(numCells*tensorCellSize));
+        scalar_array strainCell(tensorCellSize);
+        _material->createPropsAndVarsVisitors();
+        for(PetscInt c = 0; c < numCells; ++c) {
+            const PetscInt cell = cells[c];
+            _material->retrievePropsAndVars(cell);
+            for (int i=0; i < tensorCellSize; ++i) {
+                strainCell[i] = _strainResidual[c*tensorCellSize+i];
+            } // for
+            _material->updateStateVars(strainCell, cell);
+        } // for
+        _material->destroyPropsAndVarsVisitors();
+
+        PYLITH_METHOD_END;
+    } // if
+
     // Get cell information that doesn't depend on particular cell
     const int cellDim = _quadrature->cellDim();
     const int numQuadPts = _quadrature->numQuadPts();
@@ -184,9 +238,6 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
 
     // Get cell information
     PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
-    assert(_materialIS);
-    const PetscInt* cells = _materialIS->points();
-    const PetscInt numCells = _materialIS->size();
 
     // Setup visitors.
     scalar_array dispCell(numBasis*spaceDim);
@@ -224,6 +275,16 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Set whether trial state variables correspond to converged solution.
+void
+pylith::feassemble::IntegratorElasticity::trialStateVarsCurrent(const bool flag)
+{ // trialStateVarsCurrent
+    assert(_material);
+    _material->trialStateVarsCurrent(flag);
+    _residualStressCurrent = flag && _reuseResidualStress && _strainResidual.size() > 0;
+} // trialStateVarsCurrent
+
 // ----------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -477,6 +538,29 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
 
     const bool calcStress = (0 == strcasecmp(name, "stress") || 0 == strcasecmp(name, "cauchy_stress")) ? true : false;
 
+    // Use strain and stress from last residual evaluation if they
+    // match the solution.
+    if (_residualStressCurrent) {
+        assert(_materialIS);
+        const PetscInt* cells = _materialIS->points();
+        const PetscInt numCells = _materialIS->size();
+        const int tensorCellSize = _quadrature->numQuadPts()*_material->tensorSize();
+        const scalar_array& values = (calcStress) ? _stressResidual : _strainResidual;
+        assert(values.size() == size_t(numCells*tensorCellSize));
+
+        topology::VecVisitorMesh fieldVisitor(*field);
+        PetscScalar* fieldArray = fieldVisitor.localArray();
+        for(PetscInt c = 0; c < numCells; ++c) {
+            const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+            assert(tensorCellSize == fieldVisitor.sectionDof(cells[c]));
+            for (int i=0; i < tensorCellSize; ++i) {
+                fieldArray[off+i] = values[c*tensorCellSize+i];
+            } // for
+        } // for
+
+        PYLITH_METHOD_END;
+    } // if
+
     // Get cell information that doesn't depend on particular cell
     const int cellDim = _quadrature->cellDim();
     const int numQuadPts = _quadrature->numQuadPts();
@@ -87,6 +87,25 @@ public :
    * @param mesh Finite-element mesh.
    */
   void initialize(const topology::Mesh& mesh);
+
+  /** Set whether to keep the strain and stress at the quadrature
+   * points from the residual evaluation.
+   *
+   * If the last residual evaluation corresponds to the converged
+   * solution (see trialStateVarsCurrent()), the stored strain and
+   * stress are used in updating the state variables and for output
+   * of the total strain and stress instead of recomputing them.
+   *
+   * @param flag True to keep strain and stress, false otherwise.
+   */
+  void reuseResidualStress(const bool flag);
+
+  /** Get whether to keep the strain and stress at the quadrature
+   * points from the residual evaluation.
+   *
+   * @returns True if keeping strain and stress, false otherwise.
+   */
+  bool reuseResidualStress(void) const;
   
   /** Update state variables as needed.
    *
@@ -98,6 +117,13 @@ public :
   void updateStateVars(const PylithScalar t,
 		       topology::SolutionFields* const fields);
 
+  /** Set whether state variables computed in the most recent residual
+   * evaluation correspond to the converged solution.
+   *
+   * @param flag True if trial state variables are current, false otherwise.
+   */
+  void trialStateVarsCurrent(const bool flag);
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
@@ -217,6 +243,25 @@ protected :
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  /** Total strain at quadrature points of each cell in material from
+   * the most recent residual evaluation.
+   *
+   * size = numCells * numQuadPts * tensorSize
+   * index = (iCell * numQuadPts + iQuadPt) * tensorSize + iComponent
+   */
+  scalar_array _strainResidual;
+
+  /** Stress at quadrature points of each cell in material from the
+   * most recent residual evaluation.
+   *
+   * size = numCells * numQuadPts * tensorSize
+   * index = (iCell * numQuadPts + iQuadPt) * tensorSize + iComponent
+   */
+  scalar_array _stressResidual;
+
+  bool _reuseResidualStress; ///< True if keeping strain and stress from residual.
+  bool _residualStressCurrent; ///< True if stored strain and stress correspond to converged solution.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
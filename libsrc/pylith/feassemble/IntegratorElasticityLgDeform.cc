@@ -80,6 +80,10 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   if (!_material->hasStateVars())
     PYLITH_METHOD_END;
 
+  // Trial state from last residual evaluation is already up to date.
+  if (_material->commitStateVars())
+    PYLITH_METHOD_END;
+
   // Get cell information that doesn't depend on particular cell
   const int cellDim = _quadrature->cellDim();
   const int numQuadPts = _quadrature->numQuadPts();
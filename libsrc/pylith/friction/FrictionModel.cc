@@ -27,6 +27,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/meshio/ParameterCache.hh" // USES ParameterCache
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
 #include "pylith/faults/FaultCohesiveLagrange.hh" // USES isClampedVertex()
 
@@ -50,9 +51,21 @@ pylith::friction::FrictionModel::FrictionModel(const materials::Metadata& metada
   _dbProperties(0),
   _dbInitialState(0),
   _fieldsPropsStateVars(0),
+  _parameterCache(0),
   _propsFiberDim(0),
   _varsFiberDim(0)
 { // constructor
+  // Number of values needed to store physical properties and state
+  // variables at a vertex depends only on the metadata.
+  const int numProperties = _metadata.numProperties();
+  for (int i=0; i < numProperties; ++i)
+    _propsFiberDim += _metadata.getProperty(i).fiberDim;
+  assert(_propsFiberDim >= 0);
+
+  const int numStateVars = _metadata.numStateVars();
+  for (int i=0; i < numStateVars; ++i)
+    _varsFiberDim += _metadata.getStateVar(i).fiberDim;
+  assert(_varsFiberDim >= 0);
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -69,10 +82,10 @@ pylith::friction::FrictionModel::deallocate(void)
 { // deallocate
   PYLITH_METHOD_BEGIN;
 
+  destroyPropsStateVarsVisitors();
   delete _normalizer; _normalizer = 0;
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = 0;
-  _propsFiberDim = 0;
-  _varsFiberDim = 0;
+  delete _parameterCache; _parameterCache = 0;
 
   _dbProperties = 0; // :TODO: Use shared pointer.
   _dbInitialState = 0; // :TODO: Use shared pointer.
@@ -95,6 +108,24 @@ pylith::friction::FrictionModel::normalizer(const spatialdata::units::Nondimensi
   PYLITH_METHOD_END;
 } // normalizer
 
+// ----------------------------------------------------------------------
+// Set filename and key for cache of initialized parameter fields.
+void
+pylith::friction::FrictionModel::parameterCache(const char* filename,
+						const char* dbKey)
+{ // parameterCache
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+  assert(dbKey);
+
+  delete _parameterCache; _parameterCache = new meshio::ParameterCache;assert(_parameterCache);
+  _parameterCache->filename(filename);
+  _parameterCache->dbKey(dbKey);
+
+  PYLITH_METHOD_END;
+} // parameterCache
+
 // ----------------------------------------------------------------------
 // Get physical property parameters and initial state (if used) from database.
 void
@@ -128,6 +159,36 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = new topology::Fields(faultMesh);assert(_fieldsPropsStateVars);
   _setupPropsStateVars();
 
+  // Setup buffers for restrict/update of properties and state variables.
+  _propsStateVarsVertex.resize(_propsFiberDim+_varsFiberDim);
+
+  // Use cached values if they match the current mesh and databases.
+  if (_parameterCache) {
+    std::vector<PetscInt> vertices(vEnd-vStart);
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      vertices[v-vStart] = v;
+    } // for
+    _parameterCache->resetKey();
+    _parameterCache->hashMesh(faultMesh, (vertices.size() > 0) ? &vertices[0] : NULL, vertices.size());
+    if (quadrature) {
+      _parameterCache->hashQuadrature(*quadrature);
+    } // if
+    _parameterCache->hashNormalizer(*_normalizer);
+
+    bool isCached = true;
+    for (int i=0; i < _metadata.numProperties() && isCached; ++i) {
+      const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
+      isCached = _parameterCache->read(&_fieldsPropsStateVars->get(property.name.c_str()), property.name.c_str());
+    } // for
+    for (int i=0; i < _metadata.numStateVars() && isCached; ++i) {
+      const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+      isCached = _parameterCache->read(&_fieldsPropsStateVars->get(stateVar.name.c_str()), stateVar.name.c_str());
+    } // for
+    if (isCached) {
+      PYLITH_METHOD_END;
+    } // if
+  } // if
+
   // Create arrays for querying.
   const int numDBProperties = _metadata.numDBProperties();
   scalar_array propertiesDBQuery(numDBProperties);
@@ -240,8 +301,16 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
     std::cerr << "WARNING: No initial state given for friction model '" << label() << "'. Using default value of zero." << std::endl;
   } // if/else
 
-  // Setup buffers for restrict/update of properties and state variables.
-  _propsStateVarsVertex.resize(_propsFiberDim+_varsFiberDim);
+  if (_parameterCache) {
+    for (int i=0; i < _metadata.numProperties(); ++i) {
+      const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
+      _parameterCache->write(_fieldsPropsStateVars->get(property.name.c_str()), property.name.c_str());
+    } // for
+    for (int i=0; i < _metadata.numStateVars(); ++i) {
+      const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+      _parameterCache->write(_fieldsPropsStateVars->get(stateVar.name.c_str()), stateVar.name.c_str());
+    } // for
+  } // if
 
   PYLITH_METHOD_END;
 } // initialize
@@ -281,6 +350,14 @@ pylith::friction::FrictionModel::hasPropStateVar(const char* name)
   PYLITH_METHOD_RETURN(false);
 } // hasPropStateVar
 
+// ----------------------------------------------------------------------
+// Check whether friction strength of locked vertices is nondecreasing.
+bool
+pylith::friction::FrictionModel::lockedStrengthNondecreasing(void) const
+{ // lockedStrengthNondecreasing
+  return false;
+} // lockedStrengthNondecreasing
+
 // ----------------------------------------------------------------------
 // Get metadta for physical properties or state variables.
 const pylith::materials::Metadata&
@@ -303,42 +380,93 @@ pylith::friction::FrictionModel::getField(const char* name)
 } // getField
   
 // ----------------------------------------------------------------------
-// Retrieve properties and state variables for a point.
+// Create visitors for properties and state variables.
 void
-pylith::friction::FrictionModel::retrievePropsStateVars(const int point)
-{ // retrievePropsStateVars
+pylith::friction::FrictionModel::createPropsStateVarsVisitors(void)
+{ // createPropsStateVarsVisitors
   PYLITH_METHOD_BEGIN;
 
   assert(_fieldsPropsStateVars);
-  PetscInt iOff = 0;
 
-  for (int i=0; i < _metadata.numProperties(); ++i) {
+  destroyPropsStateVarsVisitors();
+  const int numProperties = _metadata.numProperties();
+  const int numStateVars = _metadata.numStateVars();
+  _propsStateVarsVisitors.resize(numProperties+numStateVars);
+  for (int i=0; i < numProperties; ++i) {
     const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
     topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(point);
-    const PetscInt dof = propertyVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = propertyArray[off+d];
-    } // for
+    _propsStateVarsVisitors[i] = new topology::VecVisitorMesh(propertyField);
   } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
+  for (int i=0; i < numStateVars; ++i) {
     const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
     topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(point);
-    const PetscInt dof = stateVarVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = stateVarArray[off+d];
-    } // for
+    _propsStateVarsVisitors[numProperties+i] = new topology::VecVisitorMesh(stateVarField);
   } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
 
   PYLITH_METHOD_END;
+} // createPropsStateVarsVisitors
+
+// ----------------------------------------------------------------------
+// Destroy visitors for properties and state variables.
+void
+pylith::friction::FrictionModel::destroyPropsStateVarsVisitors(void)
+{ // destroyPropsStateVarsVisitors
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numVisitors = _propsStateVarsVisitors.size();
+  for (size_t i=0; i < numVisitors; ++i) {
+    delete _propsStateVarsVisitors[i]; _propsStateVarsVisitors[i] = 0;
+  } // for
+  _propsStateVarsVisitors.clear();
+
+  PYLITH_METHOD_END;
+} // destroyPropsStateVarsVisitors
+
+// ----------------------------------------------------------------------
+// Retrieve properties and state variables for a point.
+void
+pylith::friction::FrictionModel::retrievePropsStateVars(const int point)
+{ // retrievePropsStateVars
+  PYLITH_METHOD_BEGIN;
+
+  const bool tmpVisitors = _propsStateVarsVisitors.empty();
+  if (tmpVisitors) {
+    createPropsStateVarsVisitors();
+  } // if
+
+  assert(size_t(propsStateVarsSize()) == _propsStateVarsVertex.size());
+  retrievePropsStateVars(&_propsStateVarsVertex[0], point);
+
+  if (tmpVisitors) {
+    destroyPropsStateVarsVisitors();
+  } // if
+
+  PYLITH_METHOD_END;
+} // retrievePropsStateVars
+
+// ----------------------------------------------------------------------
+// Retrieve properties and state variables for a point into buffer
+// supplied by caller.
+void
+pylith::friction::FrictionModel::retrievePropsStateVars(PylithScalar* const propsStateVars,
+							const int point) const
+{ // retrievePropsStateVars
+  // No PYLITH_METHOD_BEGIN/END; may be called from multiple threads.
+  assert(propsStateVars);
+  assert(!_propsStateVarsVisitors.empty());
+
+  PetscInt iOff = 0;
+  const size_t numVisitors = _propsStateVarsVisitors.size();
+  for (size_t i=0; i < numVisitors; ++i) {
+    const topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[i];assert(visitor);
+    const PetscScalar* fieldArray = visitor->localArray();
+    const PetscInt off = visitor->sectionOffset(point);
+    const PetscInt dof = visitor->sectionDof(point);
+    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+      propsStateVars[iOff] = fieldArray[off+d];
+    } // for
+  } // for
+  assert(propsStateVarsSize() == iOff);
 } // retrievePropsStateVars
 
 // ----------------------------------------------------------------------
@@ -354,17 +482,33 @@ pylith::friction::FrictionModel::calcFriction(const PylithScalar t,
   assert(_fieldsPropsStateVars);
 
   assert(size_t(_propsFiberDim+_varsFiberDim) == _propsStateVarsVertex.size());
-  const PylithScalar* propertiesVertex = &_propsStateVarsVertex[0];
-  const PylithScalar* stateVarsVertex = (_varsFiberDim > 0) ?
-    &_propsStateVarsVertex[_propsFiberDim] : 0;
-
-  const PylithScalar friction = _calcFriction(t, slip, slipRate, normalTraction,
-					      propertiesVertex, _propsFiberDim,
-					      stateVarsVertex, _varsFiberDim);
+  const PylithScalar friction = calcFriction(t, slip, slipRate, normalTraction, &_propsStateVarsVertex[0]);
   
   PYLITH_METHOD_RETURN(friction);
 } // calcFriction
 
+// ----------------------------------------------------------------------
+// Compute friction at vertex using properties and state variables
+// supplied by caller.
+PylithScalar
+pylith::friction::FrictionModel::calcFriction(const PylithScalar t,
+					      const PylithScalar slip,
+                                              const PylithScalar slipRate,
+                                              const PylithScalar normalTraction,
+					      const PylithScalar* propsStateVars)
+{ // calcFriction
+  // No PYLITH_METHOD_BEGIN/END; may be called from multiple threads.
+  assert(propsStateVars);
+
+  const PylithScalar* propertiesVertex = &propsStateVars[0];
+  const PylithScalar* stateVarsVertex = (_varsFiberDim > 0) ?
+    &propsStateVars[_propsFiberDim] : 0;
+
+  return _calcFriction(t, slip, slipRate, normalTraction,
+		       propertiesVertex, _propsFiberDim,
+		       stateVarsVertex, _varsFiberDim);
+} // calcFriction
+
 // ----------------------------------------------------------------------
 // Compute derivative of friction with slip at vertex.
 PylithScalar
@@ -378,17 +522,33 @@ pylith::friction::FrictionModel::calcFrictionDeriv(const PylithScalar t,
   assert(_fieldsPropsStateVars);
 
   assert(size_t(_propsFiberDim+_varsFiberDim) == _propsStateVarsVertex.size());
-  const PylithScalar* propertiesVertex = &_propsStateVarsVertex[0];
-  const PylithScalar* stateVarsVertex = (_varsFiberDim > 0) ?
-    &_propsStateVarsVertex[_propsFiberDim] : 0;
-
-  const PylithScalar frictionDeriv = _calcFrictionDeriv(t, slip, slipRate, normalTraction,
-							propertiesVertex, _propsFiberDim,
-							stateVarsVertex, _varsFiberDim);
+  const PylithScalar frictionDeriv = calcFrictionDeriv(t, slip, slipRate, normalTraction, &_propsStateVarsVertex[0]);
   
   PYLITH_METHOD_RETURN(frictionDeriv);
 } // calcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at vertex using properties
+// and state variables supplied by caller.
+PylithScalar
+pylith::friction::FrictionModel::calcFrictionDeriv(const PylithScalar t,
+						   const PylithScalar slip,
+						   const PylithScalar slipRate,
+						   const PylithScalar normalTraction,
+						   const PylithScalar* propsStateVars)
+{ // calcFrictionDeriv
+  // No PYLITH_METHOD_BEGIN/END; may be called from multiple threads.
+  assert(propsStateVars);
+
+  const PylithScalar* propertiesVertex = &propsStateVars[0];
+  const PylithScalar* stateVarsVertex = (_varsFiberDim > 0) ?
+    &propsStateVars[_propsFiberDim] : 0;
+
+  return _calcFrictionDeriv(t, slip, slipRate, normalTraction,
+			    propertiesVertex, _propsFiberDim,
+			    stateVarsVertex, _varsFiberDim);
+} // calcFrictionDeriv
+
 // ----------------------------------------------------------------------
 // Update state variables (for next time step).
 void
@@ -411,33 +571,153 @@ pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
 		   &stateVarsVertex[0], _varsFiberDim,
 		   &propertiesVertex[0], _propsFiberDim);
 
-  PetscInt iOff = 0;
+  // Only the state variables change, so we only write those back.
+  const bool tmpVisitors = _propsStateVarsVisitors.empty();
+  if (tmpVisitors) {
+    createPropsStateVarsVisitors();
+  } // if
+
+  PetscInt iOff = _propsFiberDim;
+  const size_t numVisitors = _propsStateVarsVisitors.size();
+  for (size_t i=_metadata.numProperties(); i < numVisitors; ++i) {
+    topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[i];assert(visitor);
+    PetscScalar* stateVarArray = visitor->localArray();
+    const PetscInt off = visitor->sectionOffset(vertex);
+    const PetscInt dof = visitor->sectionDof(vertex);
+    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+      stateVarArray[off+d] = _propsStateVarsVertex[iOff];
+    } // for
+  } // for
+  assert(_propsStateVarsVertex.size() == size_t(iOff));
 
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(vertex);
-    const PetscInt dof = propertyVisitor.sectionDof(vertex);
+  if (tmpVisitors) {
+    destroyPropsStateVarsVisitors();
+  } // if
+
+  PYLITH_METHOD_END;
+} // updateStateVars
+
+// ----------------------------------------------------------------------
+// Retrieve properties and state variables for a batch of points into
+// buffer supplied by caller.
+void
+pylith::friction::FrictionModel::retrievePropsStateVars(PylithScalar* const propsStateVars,
+							const int* points,
+							const int numPoints) const
+{ // retrievePropsStateVars
+  assert(!numPoints || (propsStateVars && points));
+  assert(!_propsStateVarsVisitors.empty());
+
+  PetscInt iOff = 0;
+  const int numProperties = _metadata.numProperties();
+  const int numVisitors = _propsStateVarsVisitors.size();
+  for (int iVisitor=0; iVisitor < numVisitors; ++iVisitor) {
+    const topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[iVisitor];assert(visitor);
+    const PetscScalar* fieldArray = visitor->localArray();
+    const PetscInt dof = (iVisitor < numProperties) ?
+      _metadata.getProperty(iVisitor).fiberDim : _metadata.getStateVar(iVisitor-numProperties).fiberDim;
     for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      propertyArray[off+d] = _propsStateVarsVertex[iOff];
+      PylithScalar* values = &propsStateVars[iOff*numPoints];
+      for (int i=0; i < numPoints; ++i) {
+	assert(dof == visitor->sectionDof(points[i]));
+	values[i] = fieldArray[visitor->sectionOffset(points[i])+d];
+      } // for
     } // for
   } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(vertex);
-    const PetscInt dof = stateVarVisitor.sectionDof(vertex);
+  assert(propsStateVarsSize() == iOff);
+} // retrievePropsStateVars
+
+// ----------------------------------------------------------------------
+// Store state variables for a batch of points.
+void
+pylith::friction::FrictionModel::storeStateVars(const PylithScalar* propsStateVars,
+						const int* points,
+						const int numPoints)
+{ // storeStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(!numPoints || (propsStateVars && points));
+  assert(!_propsStateVarsVisitors.empty());
+  if (0 == _varsFiberDim) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscInt iOff = _propsFiberDim;
+  const int numProperties = _metadata.numProperties();
+  const int numVisitors = _propsStateVarsVisitors.size();
+  for (int iVisitor=numProperties; iVisitor < numVisitors; ++iVisitor) {
+    topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[iVisitor];assert(visitor);
+    PetscScalar* stateVarArray = visitor->localArray();
+    const PetscInt dof = _metadata.getStateVar(iVisitor-numProperties).fiberDim;
     for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      stateVarArray[off+d] = _propsStateVarsVertex[iOff];
+      const PylithScalar* values = &propsStateVars[iOff*numPoints];
+      for (int i=0; i < numPoints; ++i) {
+	assert(dof == visitor->sectionDof(points[i]));
+	stateVarArray[visitor->sectionOffset(points[i])+d] = values[i];
+      } // for
     } // for
   } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
+  assert(propsStateVarsSize() == iOff);
+
+  PYLITH_METHOD_END;
+} // storeStateVars
+
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFriction(PylithScalar* const friction,
+					      const PylithScalar t,
+					      const PylithScalar* slip,
+					      const PylithScalar* slipRate,
+					      const PylithScalar* normalTraction,
+					      const PylithScalar* propsStateVars,
+					      const int numPoints)
+{ // calcFriction
+  PYLITH_METHOD_BEGIN;
+
+  assert(!numPoints || (friction && slip && slipRate && normalTraction && propsStateVars));
+  _calcFrictionBatch(friction, t, slip, slipRate, normalTraction, propsStateVars, numPoints);
+
+  PYLITH_METHOD_END;
+} // calcFriction
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::FrictionModel::calcFrictionDeriv(PylithScalar* const frictionDeriv,
+						   const PylithScalar t,
+						   const PylithScalar* slip,
+						   const PylithScalar* slipRate,
+						   const PylithScalar* normalTraction,
+						   const PylithScalar* propsStateVars,
+						   const int numPoints)
+{ // calcFrictionDeriv
+  PYLITH_METHOD_BEGIN;
+
+  assert(!numPoints || (frictionDeriv && slip && slipRate && normalTraction && propsStateVars));
+  _calcFrictionDerivBatch(frictionDeriv, t, slip, slipRate, normalTraction, propsStateVars, numPoints);
+
+  PYLITH_METHOD_END;
+} // calcFrictionDeriv
+
+// ----------------------------------------------------------------------
+// Compute update to state variables at a batch of vertices.
+void
+pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
+						 const PylithScalar* slip,
+						 const PylithScalar* slipRate,
+						 const PylithScalar* normalTraction,
+						 PylithScalar* const propsStateVars,
+						 const int numPoints)
+{ // updateStateVars
+  PYLITH_METHOD_BEGIN;
+
+  if (0 == _varsFiberDim) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(!numPoints || (slip && slipRate && normalTraction && propsStateVars));
+  _updateStateVarsBatch(t, slip, slipRate, normalTraction, propsStateVars, numPoints);
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -457,6 +737,73 @@ pylith::friction::FrictionModel::_updateStateVars(
 { // _updateStateVars
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::FrictionModel::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numPoints)
+{ // _calcFrictionBatch
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  scalar_array propsStateVarsVertex(numValues);
+  for (int i=0; i < numPoints; ++i) {
+    for (int iValue=0; iValue < numValues; ++iValue) {
+      propsStateVarsVertex[iValue] = propsStateVars[iValue*numPoints+i];
+    } // for
+    friction[i] = calcFriction(t, slip[i], slipRate[i], normalTraction[i], &propsStateVarsVertex[0]);
+  } // for
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::FrictionModel::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numPoints)
+{ // _calcFrictionDerivBatch
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  scalar_array propsStateVarsVertex(numValues);
+  for (int i=0; i < numPoints; ++i) {
+    for (int iValue=0; iValue < numValues; ++iValue) {
+      propsStateVarsVertex[iValue] = propsStateVars[iValue*numPoints+i];
+    } // for
+    frictionDeriv[i] = calcFrictionDeriv(t, slip[i], slipRate[i], normalTraction[i], &propsStateVarsVertex[0]);
+  } // for
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::FrictionModel::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numPoints)
+{ // _updateStateVarsBatch
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  scalar_array propsStateVarsVertex(numValues);
+  for (int i=0; i < numPoints; ++i) {
+    for (int iValue=0; iValue < numValues; ++iValue) {
+      propsStateVarsVertex[iValue] = propsStateVars[iValue*numPoints+i];
+    } // for
+    _updateStateVars(t, slip[i], slipRate[i], normalTraction[i],
+		     &propsStateVarsVertex[_propsFiberDim], _varsFiberDim,
+		     &propsStateVarsVertex[0], _propsFiberDim);
+    for (int iValue=_propsFiberDim; iValue < numValues; ++iValue) {
+      propsStateVars[iValue*numPoints+i] = propsStateVarsVertex[iValue];
+    } // for
+  } // for
+} // _updateStateVarsBatch
+
 // ----------------------------------------------------------------------
 // Setup fields for physical properties and state variables.
 void
@@ -464,26 +811,16 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
 { // _setupPropsStateVars
   PYLITH_METHOD_BEGIN;
 
-  // Determine number of values needed to store physical properties.
   const int numProperties = _metadata.numProperties();
-  _propsFiberDim = 0;
-  for (int i=0; i < numProperties; ++i)
-    _propsFiberDim += _metadata.getProperty(i).fiberDim;
-  assert(_propsFiberDim >= 0);
-  
+
   // Determine scales for each physical property.
   scalar_array propertiesVertex(_propsFiberDim);
   for (int i=0; i < _propsFiberDim; ++i)
     propertiesVertex[i] = 1.0;
   _dimProperties(&propertiesVertex[0], propertiesVertex.size());
 
-  // Determine number of values needed to store state variables.
   const int numStateVars = _metadata.numStateVars();
-  _varsFiberDim = 0;
-  for (int i=0; i < numStateVars; ++i)
-    _varsFiberDim += _metadata.getStateVar(i).fiberDim;
-  assert(_varsFiberDim >= 0);
-  
+
   // Determine scales for each state variable.
   scalar_array stateVarsVertex(_varsFiberDim);
   for (int i=0; i < _varsFiberDim; ++i)
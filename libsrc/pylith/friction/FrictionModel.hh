@@ -29,12 +29,14 @@
 
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 
 #include "pylith/materials/Metadata.hh" // HASA Metadata
 
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 // FrictionModel --------------------------------------------------------
 /** @brief C++ abstract base class for FrictionModel object.
@@ -108,6 +110,15 @@ public :
    */
   void normalizer(const spatialdata::units::Nondimensional& dim);
 
+  /** Use a persistent cache for the fields initialized from the
+   * spatial databases.
+   *
+   * @param filename Root of filename for cache files.
+   * @param dbKey Digest of the contents of the spatial databases.
+   */
+  void parameterCache(const char* filename,
+		      const char* dbKey);
+
   /** Initialize friction model by getting physical property
    * parameters from database.
    *
@@ -131,6 +142,19 @@ public :
    */
   bool hasPropStateVar(const char* name);
   
+  /** Check whether the friction strength at a vertex that is not
+   * slipping can only increase or stay the same over time (for
+   * example, friction does not depend explicitly on time).
+   *
+   * Faults use this to decide whether the friction strength of locked
+   * vertices remains valid across time steps.
+   *
+   * @returns True if strength of locked vertices is nondecreasing,
+   * false otherwise.
+   */
+  virtual
+  bool lockedStrengthNondecreasing(void) const;
+  
   /** Return the property and state variable metadata.
    *
    * @returns Metadata for properties and state variables.
@@ -151,12 +175,45 @@ public :
    */
   const topology::Fields& fieldsPropsStateVars() const;
 
+  /// Create visitors for properties and state variables.
+  void createPropsStateVarsVisitors(void);
+
+  /// Destroy visitors for properties and state variables.
+  void destroyPropsStateVarsVisitors(void);
+
   /** Retrieve properties and state variables for a point.
+   *
+   * Calling createPropsStateVarsVisitors() before looping over points
+   * avoids creating visitors for each field at every point.
    *
    * @param point Finite-element point.
    */
   void retrievePropsStateVars(const int point);
 
+  /** Get number of values for properties and state variables at a
+   * point.
+   *
+   * @returns Number of properties and state variables at a point.
+   */
+  int propsStateVarsSize(void) const;
+
+  /** Retrieve properties and state variables for a point into a
+   * buffer supplied by the caller.
+   *
+   * Unlike retrievePropsStateVars(point), this method does not use
+   * any scratch space of the friction model, so it may be called
+   * concurrently from multiple threads.
+   *
+   * @pre Must call createPropsStateVarsVisitors() before calling
+   * this method.
+   *
+   * @param propsStateVars Array of properties followed by state
+   * variables [propsStateVarsSize()].
+   * @param point Finite-element point.
+   */
+  void retrievePropsStateVars(PylithScalar* const propsStateVars,
+			      const int point) const;
+
   /** Compute friction at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -191,6 +248,43 @@ public :
 				 const PylithScalar slipRate,
 				 const PylithScalar normalTraction);
   
+  /** Compute friction at vertex using properties and state variables
+   * supplied by the caller. Safe to call concurrently.
+   *
+   * @param t Time in simulation.
+   * @param slip Current slip at location.
+   * @param slipRate Current slip rate at location.
+   * @param normalTraction Normal traction at location.
+   * @param propsStateVars Properties followed by state variables at
+   * vertex (from retrievePropsStateVars(propsStateVars, point)).
+   *
+   * @returns Friction (magnitude of shear traction) at vertex.
+   */
+  PylithScalar calcFriction(const PylithScalar t,
+			    const PylithScalar slip,
+			    const PylithScalar slipRate,
+			    const PylithScalar normalTraction,
+			    const PylithScalar* propsStateVars);
+  
+  /** Compute derivative of friction with slip at vertex using
+   * properties and state variables supplied by the caller. Safe to
+   * call concurrently.
+   *
+   * @param t Time in simulation.
+   * @param slip Current slip at location.
+   * @param slipRate Current slip rate at location.
+   * @param normalTraction Normal traction at location.
+   * @param propsStateVars Properties followed by state variables at
+   * vertex (from retrievePropsStateVars(propsStateVars, point)).
+   *
+   * @returns Derivative of friction (magnitude of shear traction).
+   */
+  PylithScalar calcFrictionDeriv(const PylithScalar t,
+				 const PylithScalar slip,
+				 const PylithScalar slipRate,
+				 const PylithScalar normalTraction,
+				 const PylithScalar* propsStateVars);
+  
   /** Compute update to state variables at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -208,6 +302,96 @@ public :
 		       const PylithScalar normalTraction,
 		       const int vertex);
   
+  /** Retrieve properties and state variables for a batch of points
+   * into a buffer supplied by the caller. The buffer holds one
+   * contiguous array over the points for each property and state
+   * variable value (properties followed by state variables), so value
+   * i at point p is propsStateVars[i*numPoints+p].
+   *
+   * @pre Must call createPropsStateVarsVisitors() before calling
+   * this method.
+   *
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param points Array of finite-element points [numPoints].
+   * @param numPoints Number of points.
+   */
+  void retrievePropsStateVars(PylithScalar* const propsStateVars,
+			      const int* points,
+			      const int numPoints) const;
+
+  /** Store state variables for a batch of points from a contiguous
+   * buffer (same layout as retrievePropsStateVars()).
+   *
+   * @pre Must call createPropsStateVarsVisitors() before calling
+   * this method.
+   *
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param points Array of finite-element points [numPoints].
+   * @param numPoints Number of points.
+   */
+  void storeStateVars(const PylithScalar* propsStateVars,
+		      const int* points,
+		      const int numPoints);
+
+  /** Compute friction at a batch of vertices.
+   *
+   * @param friction Array of friction values [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void calcFriction(PylithScalar* const friction,
+		    const PylithScalar t,
+		    const PylithScalar* slip,
+		    const PylithScalar* slipRate,
+		    const PylithScalar* normalTraction,
+		    const PylithScalar* propsStateVars,
+		    const int numPoints);
+
+  /** Compute derivative of friction with slip at a batch of vertices.
+   *
+   * @param frictionDeriv Array of derivatives of friction [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void calcFrictionDeriv(PylithScalar* const frictionDeriv,
+			 const PylithScalar t,
+			 const PylithScalar* slip,
+			 const PylithScalar* slipRate,
+			 const PylithScalar* normalTraction,
+			 const PylithScalar* propsStateVars,
+			 const int numPoints);
+
+  /** Compute update to state variables at a batch of vertices. The
+   * state variables are updated in the buffer; use storeStateVars()
+   * to write them to the fields.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void updateStateVars(const PylithScalar t,
+		       const PylithScalar* slip,
+		       const PylithScalar* slipRate,
+		       const PylithScalar* normalTraction,
+		       PylithScalar* const propsStateVars,
+		       const int numPoints);
+  
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -335,6 +519,69 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices.
+   *
+   * The default implementation gathers the values for each vertex and
+   * calls _calcFriction(). Friction models override it with a loop
+   * over the arrays for each property and state variable that the
+   * compiler can inline and vectorize.
+   *
+   * @param friction Array of friction values [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  virtual
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const PylithScalar* propsStateVars,
+			  const int numPoints);
+
+  /** Compute derivative of friction with slip at a batch of vertices.
+   *
+   * @param frictionDeriv Array of derivatives of friction [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  virtual
+  void _calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const PylithScalar* propsStateVars,
+			       const int numPoints);
+
+  /** Update state variables at a batch of vertices.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  virtual
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     PylithScalar* const propsStateVars,
+			     const int numPoints);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -366,9 +613,15 @@ private :
   /// friction model.
   topology::Fields* _fieldsPropsStateVars;
 
+  /// Cache of initialized parameter fields (NULL if not used).
+  meshio::ParameterCache* _parameterCache;
+
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Visitors for property fields followed by state variable fields.
+  std::vector<topology::VecVisitorMesh*> _propsStateVarsVisitors;
+
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
@@ -21,15 +21,21 @@
 #include "RateStateAgeing.hh" // implementation of object methods
 
 #include "pylith/materials/Metadata.hh" // USES Metadata
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
 
-#include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
 #include "pylith/utils/constdefs.h" // USES MAXSCALAR
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petsc.h" // USES PetscLogFlops
 
+#include <algorithm> // USES std::min(), std::max()
 #include <cassert> // USES assert()
+#include <cmath> // USES HUGE_VAL
+#include <cstring> // USES memcpy()
+#include <limits> // USES std::numeric_limits
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
@@ -52,11 +58,12 @@ namespace pylith {
       };
 
       // Number of State Variables.
-      const int numStateVars = 1;
+      const int numStateVars = 2;
 
       // State Variables.
       const pylith::materials::Metadata::ParamDescription stateVars[] = {
         { "state_variable", 1, pylith::topology::FieldBase::SCALAR },
+        { "state_term", 1, pylith::topology::FieldBase::SCALAR },
       };
 
       // Values expected in spatial database
@@ -74,7 +81,232 @@ namespace pylith {
       const char* dbStateVars[1] = {
 	"state-variable",
       };
-      
+
+      // Split of log(2) into high and low parts (Cody-Waite), so
+      // that k*log(2) is exact for the high part.
+      const double ln2Hi = 6.93147180369123816490e-01;
+      const double ln2Lo = 1.90821492927058770002e-10;
+
+      /** Fast approximation of log(x).
+       *
+       * Write x = m*2^e with m in [sqrt(1/2), sqrt(2)) using the bits
+       * of the floating point representation, so log(x) = e*log(2) +
+       * log(m). With s = (m-1)/(m+1), log(m) = 2*atanh(s), which we
+       * evaluate using the first 7 terms of the Taylor series. |s| <=
+       * 0.1716, so the maximum relative error is 2.0e-12. Subnormal
+       * values are scaled by 2^54 before the range reduction.
+       *
+       * There are no branches or table lookups; the range reduction
+       * and special values (0, inf, negative values, and NaN) use
+       * selects on the bits of x, so loops calling this function can
+       * be vectorized.
+       */
+      inline
+      double
+      fastLog(const double x) {
+	unsigned long long bits = 0;
+	memcpy(&bits, &x, sizeof(x));
+
+	// Scale subnormal values by 2^54 so they are normal.
+	const bool isSubnormal = (bits >> 52) == 0;
+	const double xNormal = x*(isSubnormal ? 18014398509481984.0 : 1.0);
+	unsigned long long bitsNormal = 0;
+	memcpy(&bitsNormal, &xNormal, sizeof(xNormal));
+	const unsigned long long bias = isSubnormal ? 1023+54 : 1023;
+
+	// Mantissa above sqrt(2) is halved, incrementing the exponent.
+	const unsigned long long mbits = bitsNormal & 0x000fffffffffffffULL;
+	const bool isLarge = mbits > 0x6a09e667f3bccULL;
+	const unsigned long long ebits = (bitsNormal >> 52) + (isLarge ? 1 : 0);
+	const unsigned long long mbitsReduced = mbits | (isLarge ? 0x3fe0000000000000ULL : 0x3ff0000000000000ULL);
+	double m = 0.0;
+	memcpy(&m, &mbitsReduced, sizeof(m));
+
+	// Convert exponent to floating point using the mantissa of 2^52.
+	const unsigned long long ebitsDouble = ebits | 0x4330000000000000ULL;
+	double e = 0.0;
+	memcpy(&e, &ebitsDouble, sizeof(e));
+	e -= 4503599627370496.0 + double(bias);
+
+	const double s = (m - 1.0) / (m + 1.0);
+	const double s2 = s*s;
+	const double logm = 2.0*s*(1.0 + s2*(1.0/3.0 + s2*(1.0/5.0 + s2*(1.0/7.0 + s2*(1.0/9.0 + s2*(1.0/11.0 + s2*(1.0/13.0)))))));
+	const double value = e*ln2Hi + (e*ln2Lo + logm);
+
+	// log(inf) = inf; negative values and NaN give NaN; log(0) = -inf.
+	const double special = (bits == 0x7ff0000000000000ULL) ? HUGE_VAL : std::numeric_limits<double>::quiet_NaN();
+	const double valueFinite = (bits < 0x7ff0000000000000ULL) ? value : special;
+	return ((bits << 1) == 0) ? -HUGE_VAL : valueFinite;
+      } // fastLog
+
+      /** Fast approximation of exp(x).
+       *
+       * Write x = k*log(2) + r with integer k and |r| <= log(2)/2, so
+       * exp(x) = 2^k * exp(r). We evaluate exp(r) using the Taylor
+       * series through r^11 and construct 2^k as the product of two
+       * normal floating point values 2^k1 and 2^k2 from the bits of
+       * their representation, so values that underflow to subnormals
+       * or zero and values that overflow are handled without
+       * branches. The maximum relative error is 2.0e-14.
+       */
+      inline
+      double
+      fastExp(const double x) {
+	// Limit x to range between underflow to 0 and overflow to inf;
+	// NaN passes through.
+	const double xLimited = std::min(std::max(x, -746.0), 710.0);
+
+	// Round to nearest integer by adding and subtracting 1.5*2^52.
+	const double roundShift = 6755399441055744.0;
+	const double k = (xLimited*1.44269504088896338700 + roundShift) - roundShift;
+	const double r = (xLimited - k*ln2Hi) - k*ln2Lo;
+	const double expr = 1.0 + r*(1.0 + r*(1.0/2.0 + r*(1.0/6.0 + r*(1.0/24.0 + r*(1.0/120.0 + r*(1.0/720.0 + r*(1.0/5040.0 + r*(1.0/40320.0 + r*(1.0/362880.0 + r*(1.0/3628800.0 + r*(1.0/39916800.0)))))))))));
+
+	// The low bits of the mantissa of 2^52+1023+k1 hold the biased
+	// exponent of 2^k1.
+	const double k1 = (0.5*k + roundShift) - roundShift;
+	const double k2 = k - k1;
+	const double k1Shifted = k1 + (4503599627370496.0 + 1023.0);
+	const double k2Shifted = k2 + (4503599627370496.0 + 1023.0);
+	unsigned long long bits1 = 0;
+	unsigned long long bits2 = 0;
+	memcpy(&bits1, &k1Shifted, sizeof(k1Shifted));
+	memcpy(&bits2, &k2Shifted, sizeof(k2Shifted));
+	bits1 <<= 52;
+	bits2 <<= 52;
+	double scale1 = 0.0;
+	double scale2 = 0.0;
+	memcpy(&scale1, &bits1, sizeof(scale1));
+	memcpy(&scale2, &bits2, sizeof(scale2));
+
+	return expr*scale1*scale2;
+      } // fastExp
+
+      // Standard library log() and exp().
+      struct StdMath {
+	static PylithScalar log(const PylithScalar x) { return ::log(x); }
+	static PylithScalar exp(const PylithScalar x) { return ::exp(x); }
+      }; // StdMath
+
+      // Fast approximations of log() and exp().
+      struct FastMath {
+	static PylithScalar log(const PylithScalar x) { return fastLog(x); }
+	static PylithScalar exp(const PylithScalar x) { return fastExp(x); }
+      }; // FastMath
+
+      // Kernels used for single vertices and batches.
+
+      // Compute state term b*log(slipRate0*theta/L) of the friction
+      // coefficient.
+      template<typename Math>
+      inline
+      PylithScalar
+      calcStateTerm(const PylithScalar theta,
+		    const PylithScalar slipRate0,
+		    const PylithScalar L,
+		    const PylithScalar b) {
+	// Prevent zero value for theta, reasonable value is L / slipRate0
+	const PylithScalar thetaPositive = (theta > 0.0) ? theta : L / slipRate0;
+	return b*Math::log(slipRate0*thetaPositive/L);
+      } // calcStateTerm
+
+      // Compute friction.
+      template<typename Math>
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar slipRate,
+		   const PylithScalar normalTraction,
+		   const PylithScalar f0,
+		   const PylithScalar slipRate0,
+		   const PylithScalar a,
+		   const PylithScalar stateTerm,
+		   const PylithScalar cohesion,
+		   const PylithScalar slipRateLinear) {
+	const bool isLinear = slipRate < slipRateLinear;
+	const PylithScalar slipRateLimited = isLinear ? slipRateLinear : slipRate;
+	const PylithScalar linearTerm = isLinear ? a*(1.0 - slipRate/slipRateLinear) : 0.0;
+	const PylithScalar mu_f = f0 + a*Math::log(slipRateLimited / slipRate0) + stateTerm - linearTerm;
+	// Friction only in compression.
+	return (normalTraction <= 0.0) ? -mu_f * normalTraction + cohesion : cohesion;
+      } // calcFriction
+
+      // Compute derivative of friction with slip.
+      inline
+      PylithScalar
+      calcFrictionDeriv(const PylithScalar slipRate,
+			const PylithScalar normalTraction,
+			const PylithScalar a,
+			const PylithScalar slipRateLinear,
+			const PylithScalar dt) {
+	const PylithScalar slipRateLimited = (slipRate < slipRateLinear) ? slipRateLinear : slipRate;
+	return (normalTraction <= 0.0) ? -normalTraction * a / (slipRateLimited * dt) : 0.0;
+      } // calcFrictionDeriv
+
+      // Compute state variable theta at t+dt.
+      template<typename Math>
+      inline
+      PylithScalar
+      calcState(const PylithScalar theta,
+		const PylithScalar slipRate,
+		const PylithScalar L,
+		const PylithScalar dt) {
+	const PylithScalar vDtL = slipRate * dt / L;
+	const PylithScalar expTerm = Math::exp(-vDtL);
+	return (vDtL > 1.0e-20) ?
+	  theta * expTerm + L / slipRate * (1 - expTerm) :
+	  theta * expTerm + dt - 0.5 * slipRate/L * dt*dt;
+      } // calcState
+
+      // Compute friction at a batch of vertices.
+      template<typename Math>
+      void
+      calcFrictionBatch(PylithScalar* const friction,
+			const PylithScalar* slipRate,
+			const PylithScalar* normalTraction,
+			const PylithScalar* f0,
+			const PylithScalar* slipRate0,
+			const PylithScalar* a,
+			const PylithScalar* stateTerm,
+			const PylithScalar* cohesion,
+			const PylithScalar slipRateLinear,
+			const int numPoints) {
+	for (int i=0; i < numPoints; ++i) {
+	  friction[i] = calcFriction<Math>(slipRate[i], normalTraction[i], f0[i], slipRate0[i], a[i],
+					   stateTerm[i], cohesion[i], slipRateLinear);
+	} // for
+      } // calcFrictionBatch
+
+      // Update state variable and state term at a batch of vertices.
+      template<typename Math>
+      void
+      updateStateVarsBatch(PylithScalar* const theta,
+			   PylithScalar* const stateTerm,
+			   const PylithScalar* slipRate,
+			   const PylithScalar* slipRate0,
+			   const PylithScalar* L,
+			   const PylithScalar* b,
+			   const PylithScalar dt,
+			   const int numPoints) {
+	for (int i=0; i < numPoints; ++i) {
+	  theta[i] = calcState<Math>(theta[i], slipRate[i], L[i], dt);
+	  stateTerm[i] = calcStateTerm<Math>(theta[i], slipRate0[i], L[i], b[i]);
+	} // for
+      } // updateStateVarsBatch
+
+      // Compute state term at a batch of vertices.
+      template<typename Math>
+      void
+      calcStateTermBatch(PylithScalar* const stateTerm,
+			 const PylithScalar* theta,
+			 const PylithScalar* slipRate0,
+			 const PylithScalar* L,
+			 const PylithScalar* b,
+			 const int numPoints) {
+	for (int i=0; i < numPoints; ++i) {
+	  stateTerm[i] = calcStateTerm<Math>(theta[i], slipRate0[i], L[i], b[i]);
+	} // for
+      } // calcStateTermBatch
+
     } // _RateStateAgeing
   } // friction
 } // pylith
@@ -107,6 +339,8 @@ const int pylith::friction::RateStateAgeing::db_cohesion =
 
 // Indices of state variables.
 const int pylith::friction::RateStateAgeing::s_state = 0;
+const int pylith::friction::RateStateAgeing::s_stateTerm = 
+  pylith::friction::RateStateAgeing::s_state + 1;
 
 // Indices of database values (order must match dbProperties)
 const int pylith::friction::RateStateAgeing::db_state = 0;
@@ -122,7 +356,8 @@ pylith::friction::RateStateAgeing::RateStateAgeing(void) :
 				    _RateStateAgeing::numStateVars,
 				    _RateStateAgeing::dbStateVars,
 				    _RateStateAgeing::numDBStateVars)),
-  _linearSlipRate(1.0e-12)
+  _linearSlipRate(1.0e-12),
+  _fastMath(false)
 { // constructor
 } // constructor
 
@@ -148,6 +383,74 @@ pylith::friction::RateStateAgeing::linearSlipRate(const PylithScalar value)
   _linearSlipRate = value;
 } // linearSlipRate
 
+// ----------------------------------------------------------------------
+// Set flag for using fast approximations of log() and exp().
+void
+pylith::friction::RateStateAgeing::fastMath(const bool value)
+{ // fastMath
+  _fastMath = value;
+} // fastMath
+
+// ----------------------------------------------------------------------
+// Get physical property parameters and initial state from database
+// and compute state term from initial state.
+void
+pylith::friction::RateStateAgeing::initialize(const topology::Mesh& faultMesh,
+					      feassemble::Quadrature* quadrature)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  FrictionModel::initialize(faultMesh, quadrature);
+
+  PetscDM faultDMMesh = faultMesh.dmMesh();assert(faultDMMesh);
+  topology::Stratum verticesStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  const int numVertices = vEnd - vStart;
+  if (!numVertices) {
+    PYLITH_METHOD_END;
+  } // if
+
+  int_array vertices(numVertices);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    vertices[v-vStart] = v;
+  } // for
+  scalar_array propsStateVars(propsStateVarsSize()*numVertices);
+
+  createPropsStateVarsVisitors();
+  retrievePropsStateVars(&propsStateVars[0], &vertices[0], numVertices);
+
+  const PylithScalar* slipRate0 = &propsStateVars[p_slipRate0*numVertices];
+  const PylithScalar* L = &propsStateVars[p_L*numVertices];
+  const PylithScalar* b = &propsStateVars[p_b*numVertices];
+  PylithScalar* stateVars = &propsStateVars[_RateStateAgeing::numProperties*numVertices];
+  const PylithScalar* theta = &stateVars[s_state*numVertices];
+  PylithScalar* stateTerm = &stateVars[s_stateTerm*numVertices];
+  if (_fastMath) {
+    _RateStateAgeing::calcStateTermBatch<_RateStateAgeing::FastMath>(stateTerm, theta, slipRate0, L, b, numVertices);
+  } else {
+    _RateStateAgeing::calcStateTermBatch<_RateStateAgeing::StdMath>(stateTerm, theta, slipRate0, L, b, numVertices);
+  } // if/else
+  PetscLogFlops(numVertices*4);
+
+  storeStateVars(&propsStateVars[0], &vertices[0], numVertices);
+  destroyPropsStateVarsVisitors();
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Check whether friction strength of locked vertices is nondecreasing.
+bool
+pylith::friction::RateStateAgeing::lockedStrengthNondecreasing(void) const
+{ // lockedStrengthNondecreasing
+  // With zero slip rate theta grows by dt each time step and b > 0
+  // (checked in _dbToProperties()), so the state term increases,
+  // except that theta = 0 uses L/slipRate0 in place of theta, which
+  // may be larger than dt after the first update.
+  return false;
+} // lockedStrengthNondecreasing
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -255,6 +558,8 @@ pylith::friction::RateStateAgeing::_dbToStateVars(PylithScalar* const stateValue
   assert(_RateStateAgeing::numDBStateVars == numDBValues);
 
   stateValues[s_state] = dbValues[db_state];
+  // Computed from state variable in initialize().
+  stateValues[s_stateTerm] = 0.0;
 } // _dbToStateVars
 
 // ----------------------------------------------------------------------
@@ -304,33 +609,13 @@ pylith::friction::RateStateAgeing::_calcFriction(const PylithScalar t,
   assert(numStateVars);
   assert(_RateStateAgeing::numStateVars == numStateVars);
 
-  PylithScalar friction = 0.0;
-  PylithScalar mu_f = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-
-    const PylithScalar slipRateLinear = _linearSlipRate;
-
-    const PylithScalar f0 = properties[p_coef];
-    const PylithScalar a = properties[p_a];
-    const PylithScalar b = properties[p_b];
-    const PylithScalar L = properties[p_L];
-    const PylithScalar slipRate0 = properties[p_slipRate0];
-
-    // Prevent zero value for theta, reasonable value is L / slipRate0
-    const PylithScalar theta = (stateVars[s_state] > 0.0) ? stateVars[s_state] : L / slipRate0;
-
-    if (slipRate >= slipRateLinear) {
-      mu_f = f0 + a*log(slipRate / slipRate0) + b*log(slipRate0*theta/L);
-    } else {
-      mu_f = f0 + a*log(slipRateLinear / slipRate0) + b*log(slipRate0*theta/L) -
-	a*(1.0 - slipRate/slipRateLinear);
-    } // else
-    friction = -mu_f * normalTraction + properties[p_cohesion];
-    
-  } else {
-    friction = properties[p_cohesion];
-  } // if/else
+  const PylithScalar friction = (_fastMath) ?
+    _RateStateAgeing::calcFriction<_RateStateAgeing::FastMath>(slipRate, normalTraction,
+							       properties[p_coef], properties[p_slipRate0], properties[p_a],
+							       stateVars[s_stateTerm], properties[p_cohesion], _linearSlipRate) :
+    _RateStateAgeing::calcFriction<_RateStateAgeing::StdMath>(slipRate, normalTraction,
+							      properties[p_coef], properties[p_slipRate0], properties[p_a],
+							      stateVars[s_stateTerm], properties[p_cohesion], _linearSlipRate);
 
   PetscLogFlops(12);
 
@@ -356,20 +641,8 @@ pylith::friction::RateStateAgeing::_calcFrictionDeriv(const PylithScalar t,
   assert(numStateVars);
   assert(_RateStateAgeing::numStateVars == numStateVars);
 
-  PylithScalar frictionDeriv = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-
-    const PylithScalar slipRateLinear = _linearSlipRate;
-
-    const PylithScalar a = properties[p_a];
-
-    if (slipRate >= slipRateLinear) {
-      frictionDeriv = -normalTraction * a / (slipRate * _dt);
-    } else {
-      frictionDeriv = -normalTraction * a / (slipRateLinear * _dt);
-    } // else
-  } // if    
+  const PylithScalar frictionDeriv =
+    _RateStateAgeing::calcFrictionDeriv(slipRate, normalTraction, properties[p_a], _linearSlipRate, _dt);
 
   PetscLogFlops(12);
 
@@ -414,23 +687,100 @@ pylith::friction::RateStateAgeing::_updateStateVars(const PylithScalar t,
   //             + dt - 0.5*(sliprate/L)*dt**2 + 1.0/6.0*(slipRate/L)*dt**3;
 
   const PylithScalar dt = _dt;
-  const PylithScalar thetaTVertex = stateVars[s_state];
+  const PylithScalar slipRate0 = properties[p_slipRate0];
   const PylithScalar L = properties[p_L];
-  const PylithScalar vDtL = slipRate * dt / L;
-  const PylithScalar expTerm = exp(-vDtL);
-
-  PylithScalar thetaTpdtVertex = 0.0;
-  if (vDtL > 1.0e-20) {
-    thetaTpdtVertex = thetaTVertex * expTerm + L / slipRate * (1 - expTerm);
-    PetscLogFlops(7);
+  const PylithScalar b = properties[p_b];
+  if (_fastMath) {
+    stateVars[s_state] = _RateStateAgeing::calcState<_RateStateAgeing::FastMath>(stateVars[s_state], slipRate, L, dt);
+    stateVars[s_stateTerm] = _RateStateAgeing::calcStateTerm<_RateStateAgeing::FastMath>(stateVars[s_state], slipRate0, L, b);
   } else {
-    thetaTpdtVertex = thetaTVertex * expTerm + dt - 0.5 * slipRate/L * dt*dt;
-    PetscLogFlops(9);
+    stateVars[s_state] = _RateStateAgeing::calcState<_RateStateAgeing::StdMath>(stateVars[s_state], slipRate, L, dt);
+    stateVars[s_stateTerm] = _RateStateAgeing::calcStateTerm<_RateStateAgeing::StdMath>(stateVars[s_state], slipRate0, L, b);
   } // if/else
-  
-  stateVars[s_state] = thetaTpdtVertex;
 
+  PetscLogFlops(13);
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::RateStateAgeing::_calcFrictionBatch(PylithScalar* const friction,
+						      const PylithScalar t,
+						      const PylithScalar* slip,
+						      const PylithScalar* slipRate,
+						      const PylithScalar* normalTraction,
+						      const PylithScalar* propsStateVars,
+						      const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && slipRate && normalTraction && propsStateVars));
+
+  const PylithScalar* f0 = &propsStateVars[p_coef*numPoints];
+  const PylithScalar* slipRate0 = &propsStateVars[p_slipRate0*numPoints];
+  const PylithScalar* a = &propsStateVars[p_a*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_RateStateAgeing::numProperties*numPoints];
+  const PylithScalar* stateTerm = &stateVars[s_stateTerm*numPoints];
+  if (_fastMath) {
+    _RateStateAgeing::calcFrictionBatch<_RateStateAgeing::FastMath>(friction, slipRate, normalTraction, f0, slipRate0, a,
+								     stateTerm, cohesion, _linearSlipRate, numPoints);
+  } else {
+    _RateStateAgeing::calcFrictionBatch<_RateStateAgeing::StdMath>(friction, slipRate, normalTraction, f0, slipRate0, a,
+								    stateTerm, cohesion, _linearSlipRate, numPoints);
+  } // if/else
+
+  PetscLogFlops(numPoints*12);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::RateStateAgeing::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							   const PylithScalar t,
+							   const PylithScalar* slip,
+							   const PylithScalar* slipRate,
+							   const PylithScalar* normalTraction,
+							   const PylithScalar* propsStateVars,
+							   const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || (frictionDeriv && slipRate && normalTraction && propsStateVars));
+
+  const PylithScalar slipRateLinear = _linearSlipRate;
+  const PylithScalar dt = _dt;
+  const PylithScalar* a = &propsStateVars[p_a*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = _RateStateAgeing::calcFrictionDeriv(slipRate[i], normalTraction[i], a[i], slipRateLinear, dt);
+  } // for
+
+  PetscLogFlops(numPoints*12);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::RateStateAgeing::_updateStateVarsBatch(const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 PylithScalar* const propsStateVars,
+							 const int numPoints)
+{ // _updateStateVarsBatch
+  assert(!numPoints || (slipRate && propsStateVars));
+
+  const PylithScalar dt = _dt;
+  const PylithScalar* slipRate0 = &propsStateVars[p_slipRate0*numPoints];
+  const PylithScalar* L = &propsStateVars[p_L*numPoints];
+  const PylithScalar* b = &propsStateVars[p_b*numPoints];
+  PylithScalar* stateVars = &propsStateVars[_RateStateAgeing::numProperties*numPoints];
+  PylithScalar* theta = &stateVars[s_state*numPoints];
+  PylithScalar* stateTerm = &stateVars[s_stateTerm*numPoints];
+  if (_fastMath) {
+    _RateStateAgeing::updateStateVarsBatch<_RateStateAgeing::FastMath>(theta, stateTerm, slipRate, slipRate0, L, b, dt, numPoints);
+  } else {
+    _RateStateAgeing::updateStateVarsBatch<_RateStateAgeing::StdMath>(theta, stateTerm, slipRate, slipRate0, L, b, dt, numPoints);
+  } // if/else
+
+  PetscLogFlops(numPoints*13);
+} // _updateStateVarsBatch
+
 
 // End of file 
@@ -66,6 +66,43 @@ public :
    */
   void linearSlipRate(const PylithScalar value);
 
+  /** Set flag for using fast approximations of log() and exp() in
+   * place of the standard library functions.
+   *
+   * The approximations use range reduction with polynomials and
+   * have a maximum relative error of 2.0e-12 for log() and 2.0e-14
+   * for exp(). They have no branches, so the loops over vertices in
+   * the batch methods can be vectorized.
+   *
+   * @param value True to use fast approximations, false otherwise.
+   */
+  void fastMath(const bool value);
+
+  /** Check whether the friction strength at a vertex that is not
+   * slipping can only increase or stay the same over time.
+   *
+   * While a vertex is locked (zero slip rate), theta grows by dt
+   * each time step and b > 0, so the state term and the strength
+   * increase. However, at vertices where theta is zero (no initial
+   * state) we use theta = L/slipRate0, and after the first update
+   * theta = dt, which is usually much smaller, so the strength
+   * decreases.
+   *
+   * @returns False.
+   */
+  bool lockedStrengthNondecreasing(void) const;
+
+  /** Initialize friction model by getting physical property
+   * parameters and initial state from database and computing the
+   * state term b*log(slipRate0*theta/L) of the friction coefficient
+   * from the initial state.
+   *
+   * @param mesh Finite-element mesh of subdomain.
+   * @param quadrature Quadrature for finite-element integration
+   */
+  void initialize(const topology::Mesh& mesh,
+		  feassemble::Quadrature* quadrature);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -189,12 +226,70 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices.
+   *
+   * @param friction Array of friction values [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const PylithScalar* propsStateVars,
+			  const int numPoints);
+
+  /** Compute derivative of friction with slip at a batch of vertices.
+   *
+   * @param frictionDeriv Array of derivatives of friction [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const PylithScalar* propsStateVars,
+			       const int numPoints);
+
+  /** Update state variables at a batch of vertices.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     PylithScalar* const propsStateVars,
+			     const int numPoints);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
   /// Floor for slip rate used in friction calculation.
   PylithScalar _linearSlipRate;
 
+  /// Flag for using fast approximations of log() and exp().
+  bool _fastMath;
+
   /// Indices for properties in section and spatial database.
   static const int p_coef;
   static const int p_slipRate0;
@@ -211,7 +306,11 @@ private :
   static const int db_cohesion;
 
   /// Indices for state variables in section and spatial database.
+  /// The state term b*log(slipRate0*theta/L) is stored with the
+  /// state variable and updated with it, so evaluations of friction
+  /// do not recompute it.
   static const int s_state;
+  static const int s_stateTerm;
 
   static const int db_state;
 
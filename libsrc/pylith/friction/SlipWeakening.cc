@@ -70,6 +70,60 @@ namespace pylith {
 				     "previous-slip",
       };      
       
+      // Kernels used for single vertices and batches.
+
+      // Compute friction.
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar slip,
+		   const PylithScalar normalTraction,
+		   const PylithScalar coefS,
+		   const PylithScalar coefD,
+		   const PylithScalar d0,
+		   const PylithScalar cohesion,
+		   const PylithScalar slipCum,
+		   const PylithScalar slipPrev) {
+	if (normalTraction <= 0.0) {
+	  // if fault is in compression
+	  const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	  // linear slip-weakening form of mu_f
+	  const PylithScalar mu_f = (slipCumTpdt < d0) ?
+	    coefS - (coefS - coefD) * slipCumTpdt / d0 : coefD;
+	  return -mu_f * normalTraction + cohesion;
+	} // if
+	return cohesion;
+      } // calcFriction
+
+      // Compute derivative of friction with slip.
+      inline
+      PylithScalar
+      calcFrictionDeriv(const PylithScalar slip,
+			const PylithScalar normalTraction,
+			const PylithScalar coefS,
+			const PylithScalar coefD,
+			const PylithScalar d0,
+			const PylithScalar slipCum,
+			const PylithScalar slipPrev) {
+	const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	return (normalTraction <= 0.0 && slipCumTpdt < d0) ?
+	  normalTraction * (coefS - coefD) / d0 : 0.0;
+      } // calcFrictionDeriv
+
+      // Update state variables.
+      inline
+      void
+      updateStateVars(const PylithScalar slip,
+		      const PylithScalar slipRate,
+		      const bool forceHealing,
+		      PylithScalar* const slipCum,
+		      PylithScalar* const slipPrev) {
+	const PylithScalar tolerance = 1.0e-12;
+	// Reset cumulative slip if sliding has stopped.
+	*slipCum = (slipRate > tolerance && !forceHealing) ?
+	  *slipCum + fabs(slip - *slipPrev) : 0.0;
+	*slipPrev = slip;
+      } // updateStateVars
+
     } // _SlipWeakening
   } // friction
 } // pylith
@@ -131,6 +185,16 @@ pylith::friction::SlipWeakening::forceHealing(const bool flag)
   _forceHealing = flag;
 } // forceHealing
 
+// ----------------------------------------------------------------------
+// Check whether friction strength of locked vertices is nondecreasing.
+bool
+pylith::friction::SlipWeakening::lockedStrengthNondecreasing(void) const
+{ // lockedStrengthNondecreasing
+  // Friction depends on slip, which does not change while locked,
+  // and healing only restores the static coefficient.
+  return true;
+} // lockedStrengthNondecreasing
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -279,25 +343,10 @@ pylith::friction::SlipWeakening::_calcFriction(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakening::numStateVars == numStateVars);
 
-  PylithScalar friction = 0.0;
-  PylithScalar mu_f = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    if (slipCum < properties[p_d0]) {
-	// if/else linear slip-weakening form of mu_f 
-	mu_f = properties[p_coefS] -
-	  (properties[p_coefS] - properties[p_coefD]) * 
-	  slipCum / properties[p_d0];
-      } else {
-	mu_f = properties[p_coefD];
-      } // if/else
-    friction = -mu_f * normalTraction + properties[p_cohesion];
-  } else { // else
-    friction = properties[p_cohesion];
-  } // if/else
+  const PylithScalar friction =
+    _SlipWeakening::calcFriction(slip, normalTraction,
+				 properties[p_coefS], properties[p_coefD], properties[p_d0], properties[p_cohesion],
+				 stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(10);
 
@@ -322,16 +371,10 @@ pylith::friction::SlipWeakening::_calcFrictionDeriv(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakening::numStateVars == numStateVars);
 
-  PylithScalar frictionDeriv = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    if (slipCum < properties[p_d0]) {
-      frictionDeriv = normalTraction * (properties[p_coefS] - properties[p_coefD]) / properties[p_d0];
-    } // if
-  } // if
+  const PylithScalar frictionDeriv =
+    _SlipWeakening::calcFrictionDeriv(slip, normalTraction,
+				      properties[p_coefS], properties[p_coefD], properties[p_d0],
+				      stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(6);
 
@@ -356,20 +399,91 @@ pylith::friction::SlipWeakening::_updateStateVars(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakening::numStateVars == numStateVars);
 
-  const PylithScalar tolerance = 1.0e-12;
-  if (slipRate > tolerance && !_forceHealing) {
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] += fabs(slip - slipPrev);
-  } else {
-    // Sliding has stopped, so reset state variables.
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] = 0.0;
-  } // else
+  _SlipWeakening::updateStateVars(slip, slipRate, _forceHealing,
+				  &stateVars[s_slipCum], &stateVars[s_slipPrev]);
 
   PetscLogFlops(3);
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::SlipWeakening::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakening::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    friction[i] = _SlipWeakening::calcFriction(slip[i], normalTraction[i],
+					       coefS[i], coefD[i], d0[i], cohesion[i],
+					       slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*10);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::SlipWeakening::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || (frictionDeriv && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakening::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = _SlipWeakening::calcFrictionDeriv(slip[i], normalTraction[i],
+							 coefS[i], coefD[i], d0[i],
+							 slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::SlipWeakening::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numPoints)
+{ // _updateStateVarsBatch
+  assert(!numPoints || (slip && slipRate && propsStateVars));
+
+  const bool forceHealing = _forceHealing;
+  PylithScalar* stateVars = &propsStateVars[_SlipWeakening::numProperties*numPoints];
+  PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    _SlipWeakening::updateStateVars(slip[i], slipRate[i], forceHealing, &slipCum[i], &slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*3);
+} // _updateStateVarsBatch
+
 
 // End of file 
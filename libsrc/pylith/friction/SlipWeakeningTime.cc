@@ -72,6 +72,62 @@ namespace pylith {
 				     "previous-slip",
       };      
       
+      // Kernels used for single vertices and batches.
+
+      // Compute friction.
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar t,
+		   const PylithScalar slip,
+		   const PylithScalar normalTraction,
+		   const PylithScalar coefS,
+		   const PylithScalar coefD,
+		   const PylithScalar d0,
+		   const PylithScalar cohesion,
+		   const PylithScalar weakTime,
+		   const PylithScalar slipCum,
+		   const PylithScalar slipPrev) {
+	if (normalTraction <= 0.0) {
+	  // if fault is in compression
+	  const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	  // linear slip-weakening form of mu_f before weakening time
+	  const PylithScalar mu_f = (slipCumTpdt < d0 && t < weakTime) ?
+	    coefS - (coefS - coefD) * slipCumTpdt / d0 : coefD;
+	  return -mu_f * normalTraction + cohesion;
+	} // if
+	return 0.0;
+      } // calcFriction
+
+      // Compute derivative of friction with slip.
+      inline
+      PylithScalar
+      calcFrictionDeriv(const PylithScalar t,
+			const PylithScalar slip,
+			const PylithScalar normalTraction,
+			const PylithScalar coefS,
+			const PylithScalar coefD,
+			const PylithScalar d0,
+			const PylithScalar weakTime,
+			const PylithScalar slipCum,
+			const PylithScalar slipPrev) {
+	const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	return (normalTraction <= 0.0 && slipCumTpdt < d0 && t < weakTime) ?
+	  normalTraction * (coefS - coefD) / d0 : 0.0;
+      } // calcFrictionDeriv
+
+      // Update state variables.
+      inline
+      void
+      updateStateVars(const PylithScalar slip,
+		      const PylithScalar slipRate,
+		      PylithScalar* const slipCum,
+		      PylithScalar* const slipPrev) {
+	const PylithScalar tolerance = 1.0e-12;
+	// Reset cumulative slip if sliding has stopped.
+	*slipCum = (slipRate > tolerance) ? *slipCum + fabs(slip - *slipPrev) : 0.0;
+	*slipPrev = slip;
+      } // updateStateVars
+
     } // _SlipWeakeningTime
   } // friction
 } // pylith
@@ -289,21 +345,11 @@ pylith::friction::SlipWeakeningTime::_calcFriction(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakeningTime::numStateVars == numStateVars);
 
-  PylithScalar friction = 0.0;
-  PylithScalar mu_f = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    if (slipCum < properties[p_d0] && t < properties[p_weaktime]) {
-	// if/else linear slip-weakening form of mu_f 
-	mu_f = properties[p_coefS] - (properties[p_coefS] - properties[p_coefD]) * slipCum / properties[p_d0];
-      } else {
-	mu_f = properties[p_coefD];
-      } // if/else
-    friction = - mu_f * normalTraction + properties[p_cohesion];
-  } // if
+  const PylithScalar friction =
+    _SlipWeakeningTime::calcFriction(t, slip, normalTraction,
+				     properties[p_coefS], properties[p_coefD], properties[p_d0],
+				     properties[p_cohesion], properties[p_weaktime],
+				     stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(6);
 
@@ -329,16 +375,11 @@ pylith::friction::SlipWeakeningTime::_calcFrictionDeriv(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakeningTime::numStateVars == numStateVars);
 
-  PylithScalar frictionDeriv = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    if (slipCum < properties[p_d0] && t < properties[p_weaktime]) {
-      frictionDeriv = normalTraction * (properties[p_coefS] - properties[p_coefD]) / properties[p_d0];
-    } // if
-  } // if
+  const PylithScalar frictionDeriv =
+    _SlipWeakeningTime::calcFrictionDeriv(t, slip, normalTraction,
+					  properties[p_coefS], properties[p_coefD], properties[p_d0],
+					  properties[p_weaktime],
+					  stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(6);
 
@@ -363,18 +404,87 @@ pylith::friction::SlipWeakeningTime::_updateStateVars(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakeningTime::numStateVars == numStateVars);
 
-  const PylithScalar tolerance = 1.0e-12;
-  if (slipRate > tolerance) {
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] += fabs(slip - slipPrev);
-  } else {
-    // Sliding has stopped, so reset state variables.
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] = 0.0;
-  } // else
+  _SlipWeakeningTime::updateStateVars(slip, slipRate, &stateVars[s_slipCum], &stateVars[s_slipPrev]);
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTime::_calcFrictionBatch(PylithScalar* const friction,
+							const PylithScalar t,
+							const PylithScalar* slip,
+							const PylithScalar* slipRate,
+							const PylithScalar* normalTraction,
+							const PylithScalar* propsStateVars,
+							const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  const PylithScalar* weakTime = &propsStateVars[p_weaktime*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTime::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    friction[i] = _SlipWeakeningTime::calcFriction(t, slip[i], normalTraction[i],
+						   coefS[i], coefD[i], d0[i], cohesion[i], weakTime[i],
+						   slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTime::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							     const PylithScalar t,
+							     const PylithScalar* slip,
+							     const PylithScalar* slipRate,
+							     const PylithScalar* normalTraction,
+							     const PylithScalar* propsStateVars,
+							     const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || (frictionDeriv && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* weakTime = &propsStateVars[p_weaktime*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTime::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = _SlipWeakeningTime::calcFrictionDeriv(t, slip[i], normalTraction[i],
+							     coefS[i], coefD[i], d0[i], weakTime[i],
+							     slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTime::_updateStateVarsBatch(const PylithScalar t,
+							   const PylithScalar* slip,
+							   const PylithScalar* slipRate,
+							   const PylithScalar* normalTraction,
+							   PylithScalar* const propsStateVars,
+							   const int numPoints)
+{ // _updateStateVarsBatch
+  assert(!numPoints || (slip && slipRate && propsStateVars));
+
+  PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTime::numProperties*numPoints];
+  PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    _SlipWeakeningTime::updateStateVars(slip[i], slipRate[i], &slipCum[i], &slipPrev[i]);
+  } // for
+} // _updateStateVarsBatch
+
 
 // End of file 
@@ -74,6 +74,83 @@ namespace pylith {
 				     "previous-slip",
       };      
       
+      // Kernels used for single vertices and batches.
+
+      // Compute fraction of weakening from slip.
+      inline
+      PylithScalar
+      slipWeakening(const PylithScalar slipCum,
+		    const PylithScalar d0) {
+	return (slipCum >= d0) ? 1.0 : slipCum / d0;
+      } // slipWeakening
+
+      // Compute fraction of weakening from time.
+      inline
+      PylithScalar
+      timeWeakening(const PylithScalar t,
+		    const PylithScalar weakTime,
+		    const PylithScalar t0) {
+	return (t < weakTime) ? 0.0 : (t < weakTime + t0) ? (t - weakTime) / t0 : 1.0;
+      } // timeWeakening
+
+      // Compute friction.
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar t,
+		   const PylithScalar slip,
+		   const PylithScalar normalTraction,
+		   const PylithScalar coefS,
+		   const PylithScalar coefD,
+		   const PylithScalar d0,
+		   const PylithScalar cohesion,
+		   const PylithScalar weakTime,
+		   const PylithScalar t0,
+		   const PylithScalar slipCum,
+		   const PylithScalar slipPrev) {
+	if (normalTraction <= 0.0) {
+	  // if fault is in compression
+	  const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	  const PylithScalar slipWeak = slipWeakening(slipCumTpdt, d0);
+	  const PylithScalar timeWeak = timeWeakening(t, weakTime, t0);
+	  const PylithScalar mu_f = coefS - (coefS - coefD) * ((slipWeak > timeWeak) ? slipWeak : timeWeak);
+	  return -mu_f * normalTraction + cohesion;
+	} // if
+	return 0.0;
+      } // calcFriction
+
+      // Compute derivative of friction with slip.
+      inline
+      PylithScalar
+      calcFrictionDeriv(const PylithScalar t,
+			const PylithScalar slip,
+			const PylithScalar normalTraction,
+			const PylithScalar coefS,
+			const PylithScalar coefD,
+			const PylithScalar d0,
+			const PylithScalar weakTime,
+			const PylithScalar t0,
+			const PylithScalar slipCum,
+			const PylithScalar slipPrev) {
+	const PylithScalar slipCumTpdt = slipCum + fabs(slip - slipPrev);
+	const PylithScalar slipWeak = slipWeakening(slipCumTpdt, d0);
+	const PylithScalar timeWeak = timeWeakening(t, weakTime, t0);
+	return (normalTraction <= 0.0 && slipWeak > timeWeak && slipCumTpdt < d0) ?
+	  normalTraction * (coefS - coefD) / d0 : 0.0;
+      } // calcFrictionDeriv
+
+      // Update state variables.
+      inline
+      void
+      updateStateVars(const PylithScalar slip,
+		      const PylithScalar slipRate,
+		      PylithScalar* const slipCum,
+		      PylithScalar* const slipPrev) {
+	const PylithScalar tolerance = 1.0e-12;
+	// Reset cumulative slip if sliding has stopped.
+	*slipCum = (slipRate > tolerance) ? *slipCum + fabs(slip - *slipPrev) : 0.0;
+	*slipPrev = slip;
+      } // updateStateVars
+
     } // _SlipWeakeningTimeStable
   } // friction
 } // pylith
@@ -303,23 +380,11 @@ pylith::friction::SlipWeakeningTimeStable::_calcFriction(const PylithScalar t,
   assert(stateVars);
   assert(_SlipWeakeningTimeStable::numStateVars == numStateVars);
 
-  PylithScalar friction = 0.0;
-  PylithScalar mu_f = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    const PylithScalar slipWeak = (slipCum >= properties[p_d0]) ? 1.0 : slipCum / properties[p_d0];
-    PylithScalar timeWeak = 1.0;
-    if (t < properties[p_weaktime]) {
-      timeWeak = 0.0;
-    } else if (t < properties[p_weaktime] + properties[p_t0]) {
-      timeWeak = (t - properties[p_weaktime]) / properties[p_t0];
-    } // if/else
-    mu_f = properties[p_coefS] - (properties[p_coefS] - properties[p_coefD]) * std::max(slipWeak, timeWeak);
-    friction = - mu_f * normalTraction + properties[p_cohesion];
-  } // if
+  const PylithScalar friction =
+    _SlipWeakeningTimeStable::calcFriction(t, slip, normalTraction,
+					   properties[p_coefS], properties[p_coefD], properties[p_d0],
+					   properties[p_cohesion], properties[p_weaktime], properties[p_t0],
+					   stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(6);
 
@@ -345,23 +410,11 @@ pylith::friction::SlipWeakeningTimeStable::_calcFrictionDeriv(const PylithScalar
   assert(stateVars);
   assert(_SlipWeakeningTimeStable::numStateVars == numStateVars);
 
-  PylithScalar frictionDeriv = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-    const PylithScalar slipCum = stateVars[s_slipCum] + fabs(slip - slipPrev);
-
-    const PylithScalar slipWeak = (slipCum >= properties[p_d0]) ? 1.0 : slipCum / properties[p_d0];
-    PylithScalar timeWeak = 1.0;
-    if (t < properties[p_weaktime]) {
-      timeWeak = 0.0;
-    } else if (t < properties[p_weaktime] + properties[p_t0]) {
-      timeWeak = (t - properties[p_weaktime]) / properties[p_t0];
-    } // if/else
-    if (slipWeak > timeWeak && slipCum < properties[p_d0]) {
-      frictionDeriv = normalTraction * (properties[p_coefS] - properties[p_coefD]) / properties[p_d0];
-    } // if
-  } // if
+  const PylithScalar frictionDeriv =
+    _SlipWeakeningTimeStable::calcFrictionDeriv(t, slip, normalTraction,
+						properties[p_coefS], properties[p_coefD], properties[p_d0],
+						properties[p_weaktime], properties[p_t0],
+						stateVars[s_slipCum], stateVars[s_slipPrev]);
 
   PetscLogFlops(10);
 
@@ -386,18 +439,89 @@ pylith::friction::SlipWeakeningTimeStable::_updateStateVars(const PylithScalar t
   assert(stateVars);
   assert(_SlipWeakeningTimeStable::numStateVars == numStateVars);
 
-  const PylithScalar tolerance = 1.0e-12;
-  if (slipRate > tolerance) {
-    const PylithScalar slipPrev = stateVars[s_slipPrev];
-
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] += fabs(slip - slipPrev);
-  } else {
-    // Sliding has stopped, so reset state variables.
-    stateVars[s_slipPrev] = slip;
-    stateVars[s_slipCum] = 0.0;
-  } // else
+  _SlipWeakeningTimeStable::updateStateVars(slip, slipRate, &stateVars[s_slipCum], &stateVars[s_slipPrev]);
 } // _updateStateVars
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTimeStable::_calcFrictionBatch(PylithScalar* const friction,
+							      const PylithScalar t,
+							      const PylithScalar* slip,
+							      const PylithScalar* slipRate,
+							      const PylithScalar* normalTraction,
+							      const PylithScalar* propsStateVars,
+							      const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  const PylithScalar* weakTime = &propsStateVars[p_weaktime*numPoints];
+  const PylithScalar* t0 = &propsStateVars[p_t0*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTimeStable::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    friction[i] = _SlipWeakeningTimeStable::calcFriction(t, slip[i], normalTraction[i],
+							 coefS[i], coefD[i], d0[i], cohesion[i], weakTime[i], t0[i],
+							 slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTimeStable::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+								   const PylithScalar t,
+								   const PylithScalar* slip,
+								   const PylithScalar* slipRate,
+								   const PylithScalar* normalTraction,
+								   const PylithScalar* propsStateVars,
+								   const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || (frictionDeriv && slip && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* d0 = &propsStateVars[p_d0*numPoints];
+  const PylithScalar* weakTime = &propsStateVars[p_weaktime*numPoints];
+  const PylithScalar* t0 = &propsStateVars[p_t0*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTimeStable::numProperties*numPoints];
+  const PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  const PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = _SlipWeakeningTimeStable::calcFrictionDeriv(t, slip[i], normalTraction[i],
+								   coefS[i], coefD[i], d0[i], weakTime[i], t0[i],
+								   slipCum[i], slipPrev[i]);
+  } // for
+
+  PetscLogFlops(numPoints*10);
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::SlipWeakeningTimeStable::_updateStateVarsBatch(const PylithScalar t,
+								 const PylithScalar* slip,
+								 const PylithScalar* slipRate,
+								 const PylithScalar* normalTraction,
+								 PylithScalar* const propsStateVars,
+								 const int numPoints)
+{ // _updateStateVarsBatch
+  assert(!numPoints || (slip && slipRate && propsStateVars));
+
+  PylithScalar* stateVars = &propsStateVars[_SlipWeakeningTimeStable::numProperties*numPoints];
+  PylithScalar* slipCum = &stateVars[s_slipCum*numPoints];
+  PylithScalar* slipPrev = &stateVars[s_slipPrev*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    _SlipWeakeningTimeStable::updateStateVars(slip[i], slipRate[i], &slipCum[i], &slipPrev[i]);
+  } // for
+} // _updateStateVarsBatch
+
 
 // End of file 
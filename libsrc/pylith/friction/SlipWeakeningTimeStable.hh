@@ -177,6 +177,61 @@ protected :
 			const PylithScalar* properties,
 			const int numProperties);
 
+  /** Compute friction at a batch of vertices.
+   *
+   * @param friction Array of friction values [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _calcFrictionBatch(PylithScalar* const friction,
+			  const PylithScalar t,
+			  const PylithScalar* slip,
+			  const PylithScalar* slipRate,
+			  const PylithScalar* normalTraction,
+			  const PylithScalar* propsStateVars,
+			  const int numPoints);
+
+  /** Compute derivative of friction with slip at a batch of vertices.
+   *
+   * @param frictionDeriv Array of derivatives of friction [numPoints] (output).
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+			       const PylithScalar t,
+			       const PylithScalar* slip,
+			       const PylithScalar* slipRate,
+			       const PylithScalar* normalTraction,
+			       const PylithScalar* propsStateVars,
+			       const int numPoints);
+
+  /** Update state variables at a batch of vertices.
+   *
+   * @param t Time in simulation.
+   * @param slip Array of slip at vertices [numPoints].
+   * @param slipRate Array of slip rate at vertices [numPoints].
+   * @param normalTraction Array of normal traction at vertices [numPoints].
+   * @param propsStateVars Array of properties and state variables
+   * [propsStateVarsSize()*numPoints].
+   * @param numPoints Number of vertices.
+   */
+  void _updateStateVarsBatch(const PylithScalar t,
+			     const PylithScalar* slip,
+			     const PylithScalar* slipRate,
+			     const PylithScalar* normalTraction,
+			     PylithScalar* const propsStateVars,
+			     const int numPoints);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
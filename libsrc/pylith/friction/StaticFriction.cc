@@ -53,6 +53,15 @@ namespace pylith {
 				     "cohesion"
 };      
       
+      // Compute friction (used for single vertices and batches).
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar normalTraction,
+		   const PylithScalar coef,
+		   const PylithScalar cohesion) {
+	return (normalTraction <= 0.0) ? cohesion - coef * normalTraction : cohesion;
+      } // calcFriction
+
     } // _StaticFriction
   } // friction
 } // pylith
@@ -85,6 +94,15 @@ pylith::friction::StaticFriction::~StaticFriction(void)
 { // destructor
 } // destructor
 
+// ----------------------------------------------------------------------
+// Check whether friction strength of locked vertices is nondecreasing.
+bool
+pylith::friction::StaticFriction::lockedStrengthNondecreasing(void) const
+{ // lockedStrengthNondecreasing
+  // Friction depends only on the normal traction.
+  return true;
+} // lockedStrengthNondecreasing
+
 // ----------------------------------------------------------------------
 // Compute properties from values in spatial database.
 void
@@ -156,9 +174,7 @@ pylith::friction::StaticFriction::_calcFriction(const PylithScalar t,
   assert(_StaticFriction::numProperties == numProperties);
   assert(0 == numStateVars);
 
-  const PylithScalar friction = (normalTraction <= 0.0) ?
-    properties[p_cohesion] - properties[p_coef] * normalTraction :
-    properties[p_cohesion];
+  const PylithScalar friction = _StaticFriction::calcFriction(normalTraction, properties[p_coef], properties[p_cohesion]);
 
   PetscLogFlops(2);
 
@@ -182,5 +198,45 @@ pylith::friction::StaticFriction::_calcFrictionDeriv(const PylithScalar t,
   return 0.0;
 } // _calcFrictionDeriv
 
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::StaticFriction::_calcFrictionBatch(PylithScalar* const friction,
+						     const PylithScalar t,
+						     const PylithScalar* slip,
+						     const PylithScalar* slipRate,
+						     const PylithScalar* normalTraction,
+						     const PylithScalar* propsStateVars,
+						     const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && normalTraction && propsStateVars));
+
+  const PylithScalar* coef = &propsStateVars[p_coef*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    friction[i] = _StaticFriction::calcFriction(normalTraction[i], coef[i], cohesion[i]);
+  } // for
+
+  PetscLogFlops(numPoints*2);
+} // _calcFrictionBatch
+
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::StaticFriction::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							  const PylithScalar t,
+							  const PylithScalar* slip,
+							  const PylithScalar* slipRate,
+							  const PylithScalar* normalTraction,
+							  const PylithScalar* propsStateVars,
+							  const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || frictionDeriv);
+
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = 0.0;
+  } // for
+} // _calcFrictionDerivBatch
+
 
 // End of file 
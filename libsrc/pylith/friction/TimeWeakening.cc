@@ -69,6 +69,36 @@ namespace pylith {
       const char* dbStateVars[1] = { "elapsed-time",
       };      
       
+      // Kernels used for single vertices and batches.
+
+      // Compute friction.
+      inline
+      PylithScalar
+      calcFriction(const PylithScalar normalTraction,
+		   const PylithScalar coefS,
+		   const PylithScalar coefD,
+		   const PylithScalar Tc,
+		   const PylithScalar cohesion,
+		   const PylithScalar time) {
+	if (normalTraction <= 0.0) {
+	  // if fault is in compression
+	  // linear time-weakening form of mu_f
+	  const PylithScalar mu_f = (time < Tc) ? coefS - (coefS - coefD) * time / Tc : coefD;
+	  return -mu_f * normalTraction + cohesion;
+	} // if
+	return cohesion;
+      } // calcFriction
+
+      // Update state variables.
+      inline
+      void
+      updateStateVars(const PylithScalar slipRate,
+		      const PylithScalar dt,
+		      PylithScalar* const time) {
+	const PylithScalar tolerance = 1.0e-12;
+	*time = (slipRate > tolerance) ? *time + dt : 0.0;
+      } // updateStateVars
+
     } // _TimeWeakening
   } // friction
 } // pylith
@@ -261,22 +291,9 @@ pylith::friction::TimeWeakening::_calcFriction(const PylithScalar t,
   assert(numStateVars);
   assert(_TimeWeakening::numStateVars == numStateVars);
 
-  PylithScalar friction = 0.0;
-  PylithScalar mu_f = 0.0;
-  if (normalTraction <= 0.0) {
-    // if fault is in compression
-    if (stateVars[s_time] < properties[p_Tc]) {
-	// if/else linear time-weakening form of mu_f 
-	mu_f = properties[p_coefS] -
-	  (properties[p_coefS] - properties[p_coefD]) * 
-	  stateVars[s_time] / properties[p_Tc];
-      } else {
-	mu_f = properties[p_coefD];
-      } // if/else
-    friction = - mu_f * normalTraction + properties[p_cohesion];
-  } else {
-    friction = properties[p_cohesion];
-  } // if/else
+  const PylithScalar friction =
+    _TimeWeakening::calcFriction(normalTraction, properties[p_coefS], properties[p_coefD], properties[p_Tc],
+				 properties[p_cohesion], stateVars[s_time]);
 
   PetscLogFlops(6);
 
@@ -317,16 +334,72 @@ pylith::friction::TimeWeakening::_updateStateVars(const PylithScalar t,
   assert(numStateVars);
   assert(_TimeWeakening::numStateVars == numStateVars);
 
-  const PylithScalar tolerance = 1.0e-12;
-  if (slipRate > tolerance) {
-    const PylithScalar dt = _dt;
+  _TimeWeakening::updateStateVars(slipRate, _dt, &stateVars[s_time]);
+} // _updateStateVars
 
-    stateVars[s_time] += dt;
-  } else {
-    stateVars[s_time] = 0.0;
-  } // else
+// ----------------------------------------------------------------------
+// Compute friction at a batch of vertices.
+void
+pylith::friction::TimeWeakening::_calcFrictionBatch(PylithScalar* const friction,
+						    const PylithScalar t,
+						    const PylithScalar* slip,
+						    const PylithScalar* slipRate,
+						    const PylithScalar* normalTraction,
+						    const PylithScalar* propsStateVars,
+						    const int numPoints)
+{ // _calcFrictionBatch
+  assert(!numPoints || (friction && normalTraction && propsStateVars));
+
+  const PylithScalar* coefS = &propsStateVars[p_coefS*numPoints];
+  const PylithScalar* coefD = &propsStateVars[p_coefD*numPoints];
+  const PylithScalar* Tc = &propsStateVars[p_Tc*numPoints];
+  const PylithScalar* cohesion = &propsStateVars[p_cohesion*numPoints];
+  const PylithScalar* stateVars = &propsStateVars[_TimeWeakening::numProperties*numPoints];
+  const PylithScalar* time = &stateVars[s_time*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    friction[i] = _TimeWeakening::calcFriction(normalTraction[i], coefS[i], coefD[i], Tc[i], cohesion[i], time[i]);
+  } // for
+
+  PetscLogFlops(numPoints*6);
+} // _calcFrictionBatch
 
-} // _updateStateVars
+// ----------------------------------------------------------------------
+// Compute derivative of friction with slip at a batch of vertices.
+void
+pylith::friction::TimeWeakening::_calcFrictionDerivBatch(PylithScalar* const frictionDeriv,
+							 const PylithScalar t,
+							 const PylithScalar* slip,
+							 const PylithScalar* slipRate,
+							 const PylithScalar* normalTraction,
+							 const PylithScalar* propsStateVars,
+							 const int numPoints)
+{ // _calcFrictionDerivBatch
+  assert(!numPoints || frictionDeriv);
+
+  for (int i=0; i < numPoints; ++i) {
+    frictionDeriv[i] = 0.0;
+  } // for
+} // _calcFrictionDerivBatch
+
+// ----------------------------------------------------------------------
+// Update state variables at a batch of vertices.
+void
+pylith::friction::TimeWeakening::_updateStateVarsBatch(const PylithScalar t,
+						       const PylithScalar* slip,
+						       const PylithScalar* slipRate,
+						       const PylithScalar* normalTraction,
+						       PylithScalar* const propsStateVars,
+						       const int numPoints)
+{ // _updateStateVarsBatch
+  assert(!numPoints || (slipRate && propsStateVars));
+
+  const PylithScalar dt = _dt;
+  PylithScalar* stateVars = &propsStateVars[_TimeWeakening::numProperties*numPoints];
+  PylithScalar* time = &stateVars[s_time*numPoints];
+  for (int i=0; i < numPoints; ++i) {
+    _TimeWeakening::updateStateVars(slipRate[i], dt, &time[i]);
+  } // for
+} // _updateStateVarsBatch
 
 
 // End of file 
@@ -28,6 +28,7 @@
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/meshio/ParameterCache.hh" // USES ParameterCache
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
 #include "pylith/utils/constdefs.h" // USES MAXSCALAR
 
@@ -35,6 +36,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <strings.h> // USES strcasecmp()
+#include <cmath> // USES fabs()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
@@ -49,10 +51,21 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
+  _stateVarsTpdt(0),
+  _propertiesCell(0),
+  _stateVarsCell(0),
+  _stateVarsTpdtCell(0),
+  _initialStressCell(0),
+  _initialStrainCell(0),
+  _dtStableExplicit(pylith::PYLITH_MAXSCALAR),
+  _dtStableTolerance(-1.0),
+  _doubleBufferStateVars(false),
+  _stateVarsTpdtCurrent(false),
   _numQuadPts(0),
   _numElasticConsts(numElasticConsts),
   _propertiesVisitor(0),
   _stateVarsVisitor(0),
+  _stateVarsTpdtVisitor(0),
   _stressVisitor(0),
   _strainVisitor(0)
 { // constructor
@@ -74,10 +87,12 @@ pylith::materials::ElasticMaterial::deallocate(void)
 
   delete _propertiesVisitor; _propertiesVisitor = 0;
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
+  delete _stateVarsTpdtVisitor; _stateVarsTpdtVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
 
   delete _initialFields; _initialFields = 0;
+  delete _stateVarsTpdt; _stateVarsTpdt = 0;
 
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
@@ -109,6 +124,24 @@ pylith::materials::ElasticMaterial::initialize(const topology::Mesh& mesh,
   _initializeInitialStrain(mesh, quadrature);
   _allocateCellArrays();
 
+  // Create buffer for trial state variables with same layout as
+  // state variables.
+  delete _stateVarsTpdt; _stateVarsTpdt = 0;
+  _stateVarsTpdtCurrent = false;
+  if (_doubleBufferStateVars && hasStateVars()) {
+    assert(_stateVars);
+    _stateVarsTpdt = new topology::Field(mesh);assert(_stateVarsTpdt);
+    _stateVarsTpdt->label(_stateVars->label());
+    _stateVarsTpdt->cloneSection(*_stateVars);
+    _stateVarsTpdt->copy(*_stateVars);
+  } // if
+
+  // Discard stable time steps computed from previous parameters.
+  _dtStableImplicitCells.resize(0);
+  _dtStableStateVars.resize(0);
+  _dtStableExplicitCells.resize(0);
+  _dtStableExplicit = pylith::PYLITH_MAXSCALAR;
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -127,6 +160,10 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
     delete _stateVarsVisitor; _stateVarsVisitor = new pylith::topology::VecVisitorMesh(*_stateVars);assert(_stateVarsVisitor);
     _stateVarsVisitor->optimizeClosure();
   } // if
+  if (_stateVarsTpdt) {
+    delete _stateVarsTpdtVisitor; _stateVarsTpdtVisitor = new pylith::topology::VecVisitorMesh(*_stateVarsTpdt);assert(_stateVarsTpdtVisitor);
+    _stateVarsTpdtVisitor->optimizeClosure();
+  } // if
 
   if (_initialFields) {
     if (_initialFields->hasField("initial stress")) {
@@ -152,9 +189,17 @@ pylith::materials::ElasticMaterial::destroyPropsAndVarsVisitors(void)
 
   delete _propertiesVisitor; _propertiesVisitor = 0;
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
+  delete _stateVarsTpdtVisitor; _stateVarsTpdtVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
 
+  // Views into local arrays are no longer valid.
+  _propertiesCell = 0;
+  _stateVarsCell = 0;
+  _stateVarsTpdtCell = 0;
+  _initialStressCell = 0;
+  _initialStrainCell = 0;
+
   PYLITH_METHOD_END;
 } // destroyPropsAndVarsVisitors
 
@@ -170,54 +215,41 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
 
   const int propertiesSize = _numQuadPts*_numPropsQuadPt;
   const int stateVarsSize = _numQuadPts*_numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(propertiesSize));
-  assert(_stateVarsCell.size() == size_t(stateVarsSize));
 
   assert(_propertiesVisitor);
-  PetscScalar* propertiesArray = _propertiesVisitor->localArray();
   const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
   assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
-  } // for
+  _propertiesCell = &_propertiesVisitor->localArray()[poff];
 
   if (hasStateVars()) {
     assert(_stateVarsVisitor);
-    PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
     const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
     assert(stateVarsSize == _stateVarsVisitor->sectionDof(cell));
-    for(PetscInt d = 0; d < stateVarsSize; ++d) {
-      _stateVarsCell[d] = stateVarsArray[soff+d];
-    } // for
+    _stateVarsCell = &_stateVarsVisitor->localArray()[soff];
   } // if
-
-  _initialStressCell = 0.0;
-  _initialStrainCell = 0.0;
-  if (_initialFields) {
-    if (_initialFields->hasField("initial stress")) {
-      const int stressSize = _numQuadPts*_tensorSize;
-      assert(_initialStressCell.size() == size_t(stressSize));
-      assert(_stressVisitor);
-      PetscScalar* stressArray = _stressVisitor->localArray();
-      const PetscInt ioff = _stressVisitor->sectionOffset(cell);
-      assert(stressSize == _stressVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < stressSize; ++d) {
-	_initialStressCell[d] = stressArray[ioff+d];
-      } // for
-    } // if
-    if (_initialFields->hasField("initial strain")) {
-      const int strainSize = _numQuadPts*_tensorSize;
-      assert(_initialStrainCell.size() == size_t(strainSize));
-      assert(_strainVisitor);
-      PetscScalar* strainArray = _strainVisitor->localArray();
-      const PetscInt ioff = _strainVisitor->sectionOffset(cell);
-      assert(strainSize == _strainVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < strainSize; ++d) {
-	_initialStrainCell[d] = strainArray[ioff+d];
-      } // for
-    } // if
+  if (_stateVarsTpdtVisitor) {
+    const PetscInt soff = _stateVarsTpdtVisitor->sectionOffset(cell);
+    assert(stateVarsSize == _stateVarsTpdtVisitor->sectionDof(cell));
+    _stateVarsTpdtCell = &_stateVarsTpdtVisitor->localArray()[soff];
   } // if
 
+  const int tensorCellSize = _numQuadPts*_tensorSize;
+  assert(_zeroTensorCell.size() == size_t(tensorCellSize));
+  if (_stressVisitor) {
+    const PetscInt ioff = _stressVisitor->sectionOffset(cell);
+    assert(tensorCellSize == _stressVisitor->sectionDof(cell));
+    _initialStressCell = &_stressVisitor->localArray()[ioff];
+  } else {
+    _initialStressCell = &_zeroTensorCell[0];
+  } // if/else
+  if (_strainVisitor) {
+    const PetscInt ioff = _strainVisitor->sectionOffset(cell);
+    assert(tensorCellSize == _strainVisitor->sectionDof(cell));
+    _initialStrainCell = &_strainVisitor->localArray()[ioff];
+  } else {
+    _initialStrainCell = &_zeroTensorCell[0];
+  } // if/else
+
   PYLITH_METHOD_END;
 } // retrievePropsAndVars
 
@@ -232,11 +264,8 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(_propertiesCell);
   assert(_stressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
@@ -248,6 +277,24 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
 		&_initialStrainCell[iQuad*_tensorSize], _tensorSize,
 		computeStateVars);
 
+  // Store updated state variables as the trial state at t+dt. Any
+  // trial state committed earlier no longer corresponds to the
+  // latest residual evaluation.
+  if (computeStateVars && _stateVarsTpdtCell) {
+    assert(_stateVarsCell);
+    const int stateVarsSize = numQuadPts*numVarsQuadPt;
+    for (int i=0; i < stateVarsSize; ++i) {
+      _stateVarsTpdtCell[i] = _stateVarsCell[i];
+    } // for
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+      _updateStateVars(&_stateVarsTpdtCell[iQuad*numVarsQuadPt], numVarsQuadPt,
+		       &_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
+		       &totalStrain[iQuad*_tensorSize], _tensorSize,
+		       &_initialStressCell[iQuad*_tensorSize], _tensorSize,
+		       &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+    _stateVarsTpdtCurrent = false;
+  } // if
+
   PYLITH_METHOD_RETURN(_stressCell);
 } // calcStress
 
@@ -261,11 +308,8 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
+  assert(_propertiesCell);
   assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
@@ -292,12 +336,11 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
+  assert(_propertiesCell);
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
+  assert(!hasStateVars() || (_stateVarsVisitor && _stateVarsCell == &_stateVarsVisitor->localArray()[_stateVarsVisitor->sectionOffset(cell)]));
 
+  // State variables are updated in place in the local array.
   for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
     _updateStateVars(&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		     &_propertiesCell[iQuad*numPropsQuadPt], 
@@ -306,18 +349,33 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
 		     &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		     &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
   
-  topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
-  PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
-  const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
-  const int stateVarsSize = numQuadPts*numVarsQuadPt;
-  assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
-  for (PetscInt d = 0; d < stateVarsSize; ++d) {
-    stateVarsArray[soff+d] = _stateVarsCell[d];
-  } // for
-
   PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Commit trial state variables.
+bool
+pylith::materials::ElasticMaterial::commitStateVars(void)
+{ // commitStateVars
+  PYLITH_METHOD_BEGIN;
+
+  if (!_stateVarsTpdtCurrent) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  assert(_stateVars);
+  assert(_stateVarsTpdt);
+  assert(!_stateVarsVisitor && !_stateVarsTpdtVisitor);
+
+  // The previous state becomes the buffer for the next trial state.
+  topology::Field* stateVarsTmp = _stateVars;
+  _stateVars = _stateVarsTpdt;
+  _stateVarsTpdt = stateVarsTmp;
+  _stateVarsTpdtCurrent = false;
+
+  PYLITH_METHOD_RETURN(true);
+} // commitStateVars
+
 // ----------------------------------------------------------------------
 // Get stable time step for implicit time integration.
 PylithScalar
@@ -329,79 +387,82 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
   assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
 
   // Get cells associated with material
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
- 
-  // Setup field if necessary.
-  topology::VecVisitorMesh* fieldVisitor = NULL;
-  PetscScalar* fieldArray = NULL;
-  if (field) {
-    const int fiberDim = 1*numQuadPts;
-    bool useCurrentField = false;
-    if (field->hasSection()) {
-      // check fiber dimension
-      int fiberDimCurrentLocal = 0;
-      int fiberDimCurrent = 0;
-      if (numCells > 0) {
-	topology::VecVisitorMesh fieldVisitor(*field);
-	fiberDimCurrentLocal = fieldVisitor.sectionDof(cells[0]);
-      } // if
-      MPI_Allreduce((void *) &fiberDimCurrentLocal, 
-		    (void *) &fiberDimCurrent, 1, 
-		    MPI_INT, MPI_MAX, field->mesh().comm());
-      assert(fiberDimCurrent > 0);
-      useCurrentField = fiberDim == fiberDimCurrent;
-    } // if
-    if (!useCurrentField) {
-      int_array cellsTmp(cells, numCells);
-      field->newSection(cellsTmp, fiberDim);
-      field->allocate();
-    } // if
-    field->label("stable_dt_implicit");
-    assert(_normalizer);
-    field->scale(_normalizer->timeScale());
-    field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
-    fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
-    fieldArray = fieldVisitor->localArray();
+
+  // The stable time step depends only on the properties (which do
+  // not change) and the state variables. Without state variables the
+  // values from the first computation remain valid. In incremental
+  // mode we keep a copy of the state variables used in the
+  // computation and only recompute cells where they changed.
+  const int stateVarsSize = numQuadPts*numVarsQuadPt;
+  const bool incremental = hasStateVars() && _dtStableTolerance >= 0.0;
+  bool useCache = _dtStableImplicitCells.size() == size_t(numCells*numQuadPts) && (!hasStateVars() || incremental);
+  if (incremental && _dtStableStateVars.size() != size_t(numCells*stateVarsSize)) {
+    _dtStableStateVars.resize(numCells*stateVarsSize);
+    useCache = false;
+  } // if
+  if (!useCache) {
+    _dtStableImplicitCells.resize(numCells*numQuadPts);
   } // if
-  createPropsAndVarsVisitors();
 
-  PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
+  if (!useCache || incremental) {
+    createPropsAndVarsVisitors();
+    const PetscScalar* stateVarsArray = (incremental) ? _stateVarsVisitor->localArray() : NULL;
+    const PylithScalar tolerance = _dtStableTolerance;
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
 
-    retrievePropsAndVars(cell);
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-        _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-                                numPropsQuadPt,
-                                &_stateVarsCell[iQuad*numVarsQuadPt],
-                                numVarsQuadPt);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
+      if (useCache) {
+	assert(_stateVarsVisitor);
+	const PetscInt soff = _stateVarsVisitor->sectionOffset(cell);
+	assert(stateVarsSize == _stateVarsVisitor->sectionDof(cell));
+	const PylithScalar* stateVarsPrev = &_dtStableStateVars[c*stateVarsSize];
+	bool changed = false;
+	for (int i=0; i < stateVarsSize; ++i) {
+	  if (fabs(stateVarsArray[soff+i] - stateVarsPrev[i]) > tolerance*fabs(stateVarsPrev[i])) {
+	    changed = true;
+	    break;
+	  } // if
+	} // for
+	if (!changed) {
+	  continue;
+	} // if
       } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
+
+      retrievePropsAndVars(cell);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-	fieldArray[off+iQuad] = dtStableCell[iQuad];
+	_dtStableImplicitCells[c*numQuadPts+iQuad] = 
+	  _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt);
       } // for
+      if (incremental) {
+	for (int i=0; i < stateVarsSize; ++i) {
+	  _dtStableStateVars[c*stateVarsSize+i] = _stateVarsCell[i];
+	} // for
+      } // if
+    } // for
+    destroyPropsAndVarsVisitors();
+  } // if
+
+  PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
+  const size_t size = _dtStableImplicitCells.size();
+  for (size_t i=0; i < size; ++i) {
+    if (_dtStableImplicitCells[i] < dtStable) {
+      dtStable = _dtStableImplicitCells[i];
     } // if
   } // for
-  destroyPropsAndVarsVisitors();
-  delete fieldVisitor; fieldVisitor = 0;
+
+  if (field) {
+    _stableTimeStepField(field, "stable_dt_implicit", _dtStableImplicitCells);
+  } // if
 
   assert(dtStable > 0.0);
 
@@ -422,11 +483,7 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
   const int numQuadPts = _numQuadPts;
   const int numPropsQuadPt = _numPropsQuadPt;
   const int numVarsQuadPt = _numVarsQuadPt;
-  assert(_propertiesCell.size() == size_t(numQuadPts*numPropsQuadPt));
-  assert(_stateVarsCell.size() == size_t(numQuadPts*numVarsQuadPt));
   assert(_elasticConstsCell.size() == size_t(numQuadPts*_numElasticConsts));
-  assert(_initialStressCell.size() == size_t(numQuadPts*_tensorSize));
-  assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
 
   // Get cells associated with material
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
@@ -434,81 +491,52 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
 
-  // Setup field if necessary.
-  topology::VecVisitorMesh* fieldVisitor = NULL;
-  PetscScalar *fieldArray = NULL;
-  if (field) {
-    const int fiberDim = 1*numQuadPts;
-    bool useCurrentField = false;
-    if (field->hasSection()) {
-      // check fiber dimension
-      PetscInt fiberDimCurrentLocal = 0;
-      if (numCells > 0) {
-	topology::VecVisitorMesh fieldVisitor(*field);
-	fiberDimCurrentLocal = fieldVisitor.sectionDof(cells[0]);
-      } // if
-      PetscInt fiberDimCurrent = 0;
-      MPI_Allreduce(&fiberDimCurrentLocal, &fiberDimCurrent, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
-      assert(fiberDimCurrent > 0);
-      useCurrentField = fiberDim == fiberDimCurrent;
-    } // if
-    if (!useCurrentField) {
-      field->newSection(cells, numCells, fiberDim);
-      field->allocate();
-    } // if
-    field->label("stable_dt_explicit");
-    assert(_normalizer);
-    field->scale(_normalizer->timeScale());
-    field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
-    fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
-    fieldArray = fieldVisitor->localArray();
-  } // if
-  createPropsAndVarsVisitors();
+  // Stable time step depends only on the mesh and the properties, so
+  // we only compute it once.
+  if (_dtStableExplicitCells.size() != size_t(numCells*numQuadPts)) {
+    _dtStableExplicitCells.resize(numCells*numQuadPts);
+    createPropsAndVarsVisitors();
 
-  const int spaceDim = quadrature->spaceDim();
-  const int numBasis = quadrature->numBasis();
+    const int spaceDim = quadrature->spaceDim();
+    const int numBasis = quadrature->numBasis();
 
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
+    scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+    topology::CoordsVisitor coordsVisitor(dmMesh);
 
-  PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
+    PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
 
-    retrievePropsAndVars(cell);
+      retrievePropsAndVars(cell);
 
-    coordsVisitor.getClosure(&coordsCell, cell);
-    const PylithScalar minCellWidth = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
-    assert(minCellWidth > 0.0);
-
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-	_stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-				numPropsQuadPt,
-				&_stateVarsCell[iQuad*numVarsQuadPt],
-				numVarsQuadPt,
-				minCellWidth);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
-      } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
-      assert(numQuadPts == fieldVisitor->sectionDof(cell));
-      for (PetscInt d = 0; d < numQuadPts; ++d) {
-        fieldArray[off+d] = dtStableCell[d];
+      coordsVisitor.getClosure(&coordsCell, cell);
+      const PylithScalar minCellWidth = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
+      assert(minCellWidth > 0.0);
+
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+	const PylithScalar dt = 
+	  _stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt,
+				  minCellWidth);
+	_dtStableExplicitCells[c*numQuadPts+iQuad] = dt;
+	if (dt < dtStable) {
+	  dtStable = dt;
+	} // if
       } // for
-    } // if
-  } // for
-  destroyPropsAndVarsVisitors();
-  delete fieldVisitor; fieldVisitor = 0;
+    } // for
+    destroyPropsAndVarsVisitors();
+    _dtStableExplicit = dtStable;
+  } // if
 
-  assert(dtStable > 0.0);
+  if (field) {
+    _stableTimeStepField(field, "stable_dt_explicit", _dtStableExplicitCells);
+  } // if
 
-  PYLITH_METHOD_RETURN(dtStable);
+  assert(_dtStableExplicit > 0.0);
+
+  PYLITH_METHOD_RETURN(_dtStableExplicit);
 } // stableTimeStepExplicit
 
 // ----------------------------------------------------------------------
@@ -573,6 +601,65 @@ pylith::materials::ElasticMaterial::_stableTimeStepImplicitMax(const topology::M
   PYLITH_METHOD_RETURN(dtStable);
 } // _stableTimeStepImplicitMax
 
+// ----------------------------------------------------------------------
+// Setup field with stable time step at quadrature points of each cell.
+void
+pylith::materials::ElasticMaterial::_stableTimeStepField(topology::Field* field,
+							 const char* label,
+							 const scalar_array& dtStableCells)
+{ // _stableTimeStepField
+  PYLITH_METHOD_BEGIN;
+
+  assert(field);
+  assert(label);
+
+  const int numQuadPts = _numQuadPts;
+
+  // Get cells associated with material
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+  assert(dtStableCells.size() == size_t(numCells*numQuadPts));
+
+  // Setup field if necessary.
+  const int fiberDim = 1*numQuadPts;
+  bool useCurrentField = false;
+  if (field->hasSection()) {
+    // check fiber dimension
+    PetscInt fiberDimCurrentLocal = 0;
+    if (numCells > 0) {
+      topology::VecVisitorMesh fieldVisitor(*field);
+      fiberDimCurrentLocal = fieldVisitor.sectionDof(cells[0]);
+    } // if
+    PetscInt fiberDimCurrent = 0;
+    MPI_Allreduce(&fiberDimCurrentLocal, &fiberDimCurrent, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
+    assert(fiberDimCurrent > 0);
+    useCurrentField = fiberDim == fiberDimCurrent;
+  } // if
+  if (!useCurrentField) {
+    field->newSection(cells, numCells, fiberDim);
+    field->allocate();
+  } // if
+  field->label(label);
+  assert(_normalizer);
+  field->scale(_normalizer->timeScale());
+  field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    const PetscInt off = fieldVisitor.sectionOffset(cell);
+    assert(numQuadPts == fieldVisitor.sectionDof(cell));
+    for (PetscInt d = 0; d < numQuadPts; ++d) {
+      fieldArray[off+d] = dtStableCells[c*numQuadPts+d];
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _stableTimeStepField
+
 // ----------------------------------------------------------------------
 // Allocate cell arrays.
 void
@@ -586,10 +673,8 @@ pylith::materials::ElasticMaterial::_allocateCellArrays(void)
   const int numVarsQuadPt = _numVarsQuadPt;
   const int numElasticConsts = _numElasticConsts;
 
-  _propertiesCell.resize(numQuadPts * numPropsQuadPt);
-  _stateVarsCell.resize(numQuadPts * numVarsQuadPt);
-  _initialStressCell.resize(numQuadPts * tensorSize);
-  _initialStrainCell.resize(numQuadPts * tensorSize);
+  _zeroTensorCell.resize(numQuadPts * tensorSize);
+  _zeroTensorCell = 0.0;
   _densityCell.resize(numQuadPts);
   _stressCell.resize(numQuadPts * tensorSize);
   _elasticConstsCell.resize(numQuadPts * numElasticConsts);
@@ -643,6 +728,9 @@ pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mes
   initialStress.newSection(cellsTmp, fiberDim);
   initialStress.allocate();
   initialStress.zeroAll();
+  if (_parameterCache && _parameterCache->read(&initialStress, "initial_stress")) {
+    PYLITH_METHOD_END;
+  } // if
   topology::VecVisitorMesh stressVisitor(initialStress);
 
   // Setup databases for querying
@@ -721,6 +809,11 @@ pylith::materials::ElasticMaterial::_initializeInitialStress(const topology::Mes
   // Close databases
   _dbInitialStress->close();
 
+  if (_parameterCache) {
+    stressVisitor.clear();
+    _parameterCache->write(initialStress, "initial_stress");
+  } // if
+
   PYLITH_METHOD_END;
 } // _initializeInitialStress
 
@@ -770,6 +863,9 @@ pylith::materials::ElasticMaterial::_initializeInitialStrain(const topology::Mes
   initialStrain.newSection(cellsTmp, fiberDim);
   initialStrain.allocate();
   initialStrain.zeroAll();
+  if (_parameterCache && _parameterCache->read(&initialStrain, "initial_strain")) {
+    PYLITH_METHOD_END;
+  } // if
   topology::VecVisitorMesh strainVisitor(initialStrain);
 
   // Setup databases for querying
@@ -845,6 +941,11 @@ pylith::materials::ElasticMaterial::_initializeInitialStrain(const topology::Mes
   // Close databases
   _dbInitialStrain->close();
 
+  if (_parameterCache) {
+    strainVisitor.clear();
+    _parameterCache->write(initialStrain, "initial_strain");
+  } // if
+
   PYLITH_METHOD_END;
 } // _initializeInitialStrain
 
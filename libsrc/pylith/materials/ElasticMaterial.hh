@@ -89,6 +89,13 @@ public :
   /** Retrieve parameters for physical properties and state variables
    * for cell.
    *
+   * The parameters are accessed in place in the local arrays of the
+   * fields, so the values are only valid until the next call to
+   * retrievePropsAndVars() or destroyPropsAndVarsVisitors().
+   *
+   * @pre Must call createPropsAndVarsVisitors() before calling
+   * retrievePropsAndVars().
+   *
    * @param cell Finite-element cell
    */
   void retrievePropsAndVars(const int cell);
@@ -161,6 +168,12 @@ public :
   calcDerivElastic(const scalar_array& totalStrain);
 
   /** Update state variables (for next time step).
+   *
+   * The state variables are updated in place in the local array of
+   * the state variables field.
+   *
+   * @pre Must call retrievePropsAndVars for cell before calling
+   * updateStateVars().
    *
    * @param totalStrain Total strain tensor at quadrature points
    *    [numQuadPts][tensorSize]
@@ -169,6 +182,50 @@ public :
   void updateStateVars(const scalar_array& totalStrain,
 		       const int cell);
 
+  /** Set whether state variables are stored in two buffers (state
+   * at time t and trial state at time t+dt).
+   *
+   * With double buffering, calcStress() with computeStateVars set to
+   * true writes the updated state variables into the t+dt buffer. If
+   * the last residual evaluation corresponds to the converged solution
+   * (see trialStateVarsCurrent()), updating the state variables at the
+   * end of the time step reduces to swapping the buffers. Otherwise
+   * the trial values are discarded and the state variables are
+   * recomputed from the strain.
+   *
+   * @param flag True to use double buffering, false otherwise.
+   */
+  void doubleBufferStateVars(const bool flag);
+
+  /** Get whether state variables are stored in two buffers.
+   *
+   * @returns True if using double buffering, false otherwise.
+   */
+  bool doubleBufferStateVars(void) const;
+
+  /** Set whether the trial state variables computed in the most
+   * recent residual evaluation correspond to the converged solution.
+   *
+   * Setting the flag to false rolls back the trial state; the state
+   * variables at time t are left unchanged.
+   *
+   * @param flag True if trial state variables are current, false otherwise.
+   */
+  void trialStateVarsCurrent(const bool flag);
+
+  /** Commit trial state variables by swapping the buffers for the
+   * state at time t and at time t+dt.
+   *
+   * @pre Must not have visitors for the state variables (must call
+   * commitStateVars() outside of createPropsAndVarsVisitors() and
+   * destroyPropsAndVarsVisitors()).
+   *
+   * @returns True if the trial state variables were committed, false
+   * if they are not current and the state variables must be updated
+   * via updateStateVars().
+   */
+  bool commitStateVars(void);
+
   /** Get flag indicating whether material implements an empty
    * _updateProperties() method.
    *
@@ -176,6 +233,30 @@ public :
    */
   bool hasStateVars(void) const;
 
+  /** Set relative tolerance for changes in the state variables that
+   * trigger recomputing the stable time step for implicit time
+   * integration in a cell.
+   *
+   * With a negative value (default) the stable time step is
+   * recomputed in every cell for each query. With a nonnegative value
+   * the stable time step for each cell is retained and only
+   * recomputed in cells where a state variable changed by more than
+   * the tolerance relative to the value used in the previous
+   * computation. A value of zero gives the same result as a full
+   * recomputation.
+   *
+   * @param value Relative tolerance.
+   */
+  void stableTimeStepTolerance(const PylithScalar value);
+
+  /** Get relative tolerance for changes in the state variables that
+   * trigger recomputing the stable time step for implicit time
+   * integration in a cell.
+   *
+   * @returns Relative tolerance.
+   */
+  PylithScalar stableTimeStepTolerance(void) const;
+
   /** Get stable time step for implicit time integration.
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
@@ -193,6 +274,10 @@ public :
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
    *
+   * The stable time step depends only on the mesh and the physical
+   * properties, so it is computed once after initialization and
+   * retained.
+   *
    * @param mesh Finite-element mesh.
    * @param quadrature Quadrature for finite-element integration
    * @param field Field for storing min stable time step for each cell.
@@ -457,6 +542,17 @@ private :
   void _initializeInitialStrain(const topology::Mesh& mesh,
 				feassemble::Quadrature* quadrature);
 
+  /** Setup field with stable time step at quadrature points of each
+   * cell.
+   *
+   * @param field Field for storing stable time step.
+   * @param label Label for field.
+   * @param dtStableCells Stable time step at quadrature points of each cell.
+   */
+  void _stableTimeStepField(topology::Field* field,
+			    const char* label,
+			    const scalar_array& dtStableCells);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -468,34 +564,58 @@ private :
 
   /// Initial stress/strain fields.
   topology::Fields* _initialFields;
+
+  /// Trial state variables at time t+dt (NULL if not double buffering).
+  topology::Field* _stateVarsTpdt;
   
-  /** Properties at quadrature points for current cell.
+  /** Properties at quadrature points for current cell (view into
+   * local array of properties field).
    *
    * size = numQuadPts * numPropsQuadPt
    * index = iQuadPt * numPropsQuadPt + iPropQuadPt
    */
-  scalar_array _propertiesCell;
+  const PylithScalar* _propertiesCell;
 
-  /** State variables at quadrature points for current cell.
+  /** State variables at quadrature points for current cell (view into
+   * local array of state variables field, NULL if no state variables).
    *
    * size = numQuadPts * numVarsQuadPt
    * index = iQuadPt * numVarsQuadPt + iStateVar
    */
-  scalar_array _stateVarsCell;
+  PylithScalar* _stateVarsCell;
+
+  /** Trial state variables (time t+dt) at quadrature points for
+   * current cell (view into local array of trial state variables
+   * field, NULL if not double buffering).
+   *
+   * size = numQuadPts * numVarsQuadPt
+   * index = iQuadPt * numVarsQuadPt + iStateVar
+   */
+  PylithScalar* _stateVarsTpdtCell;
+
+  /** Initial stress state for current cell (view into local array of
+   * initial stress field or _zeroTensorCell).
+   *
+   * size = numQuadPts * tensorSize
+   * index = iQuadPt * tensorSize + iComponent
+   */
+  const PylithScalar* _initialStressCell;
 
-  /** Initial stress state for current cell.
+  /** Initial strain state for current cell (view into local array of
+   * initial strain field or _zeroTensorCell).
    *
    * size = numQuadPts * tensorSize
    * index = iQuadPt * tensorSize + iComponent
    */
-  scalar_array _initialStressCell;
+  const PylithScalar* _initialStrainCell;
 
-  /** Initial strain state for current cell.
+  /** Zero tensor at quadrature points used for cells without an
+   * initial stress or initial strain.
    *
    * size = numQuadPts * tensorSize
    * index = iQuadPt * tensorSize + iComponent
    */
-  scalar_array _initialStrainCell;
+  scalar_array _zeroTensorCell;
 
   /** Density value at quadrature points for current cell.
    *
@@ -518,11 +638,42 @@ private :
    */
   scalar_array _elasticConstsCell;
 
+  /** Stable time step for implicit time integration at quadrature
+   * points of each cell in material.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableImplicitCells;
+
+  /** State variables used in computing the stable time step for
+   * implicit time integration (incremental mode only).
+   *
+   * size = numCells * numQuadPts * numVarsQuadPt
+   * index = (iCell * numQuadPts + iQuadPt) * numVarsQuadPt + iStateVar
+   */
+  scalar_array _dtStableStateVars;
+
+  /** Stable time step for explicit time integration at quadrature
+   * points of each cell in material.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableExplicitCells;
+
+  PylithScalar _dtStableExplicit; ///< Stable time step for explicit time integration.
+  PylithScalar _dtStableTolerance; ///< Tolerance for recomputing implicit stable time step.
+
+  bool _doubleBufferStateVars; ///< True if using trial state variables buffer.
+  bool _stateVarsTpdtCurrent; ///< True if trial state variables correspond to converged solution.
+
   int _numQuadPts; ///< Number of quadrature points
   const int _numElasticConsts; ///< Number of elastic constants.
 
   pylith::topology::VecVisitorMesh* _propertiesVisitor; ///< Visitor for properties field.
   pylith::topology::VecVisitorMesh* _stateVarsVisitor; ///< Visitor for stateVars field.
+  pylith::topology::VecVisitorMesh* _stateVarsTpdtVisitor; ///< Visitor for trial stateVars field.
   pylith::topology::VecVisitorMesh* _stressVisitor; ///< Visitor for initial stress field.
   pylith::topology::VecVisitorMesh* _strainVisitor; ///< Visitor for initial strain field.
 
@@ -26,6 +26,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/meshio/ParameterCache.hh" // USES ParameterCache
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
@@ -46,6 +47,7 @@ pylith::materials::Material::Material(const int dimension,
   _stateVars(0),
   _normalizer(new spatialdata::units::Nondimensional),
   _materialIS(0),
+  _parameterCache(0),
   _numPropsQuadPt(0),
   _numVarsQuadPt(0),
   _dimension(dimension),
@@ -87,6 +89,7 @@ pylith::materials::Material::deallocate(void)
   delete _materialIS; _materialIS = 0;
   delete _properties; _properties = 0;
   delete _stateVars; _stateVars = 0;
+  delete _parameterCache; _parameterCache = 0;
 
   _dbProperties = 0; // :TODO: Use shared pointer.
   _dbInitialState = 0; // :TODO: Use shared pointer.
@@ -109,6 +112,24 @@ pylith::materials::Material::normalizer(const spatialdata::units::Nondimensional
   PYLITH_METHOD_END;
 } // normalizer
 
+// ----------------------------------------------------------------------
+// Set filename and key for cache of initialized parameter fields.
+void
+pylith::materials::Material::parameterCache(const char* filename,
+					    const char* dbKey)
+{ // parameterCache
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+  assert(dbKey);
+
+  delete _parameterCache; _parameterCache = new meshio::ParameterCache;assert(_parameterCache);
+  _parameterCache->filename(filename);
+  _parameterCache->dbKey(dbKey);
+
+  PYLITH_METHOD_END;
+} // parameterCache
+
 // ----------------------------------------------------------------------
 // Get physical property parameters and initial state (if used) from database.
 void
@@ -143,6 +164,34 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   _properties->newSection(cellsTmp, propsFiberDim);
   _properties->allocate();
   _properties->zeroAll();
+
+  // Create field to hold state variables. We create the field even
+  // if there is no initial state, because this we will use this field
+  // to hold the state variables.
+  delete _stateVars; _stateVars = new topology::Field(mesh);assert(_stateVars);
+  _stateVars->label("state variables");
+  const int stateVarsFiberDim = numQuadPts * _numVarsQuadPt;
+  if (stateVarsFiberDim > 0) {
+    assert(_stateVars);
+    assert(_properties);
+    _stateVars->newSection(*_properties, stateVarsFiberDim);
+    _stateVars->allocate();
+    _stateVars->zeroAll();
+  } // if
+
+  // Use cached values if they match the current mesh, quadrature, and databases.
+  if (_parameterCache) {
+    assert(_normalizer);
+    _parameterCache->resetKey();
+    _parameterCache->hashMesh(mesh, cells, numCells);
+    _parameterCache->hashQuadrature(*quadrature);
+    _parameterCache->hashNormalizer(*_normalizer);
+    if (_parameterCache->read(_properties, "properties") &&
+	(0 == stateVarsFiberDim || _parameterCache->read(_stateVars, "state_variables"))) {
+      PYLITH_METHOD_END;
+    } // if
+  } // if
+
   topology::VecVisitorMesh propertiesVisitor(*_properties);
   PetscScalar* propertiesArray = propertiesVisitor.localArray();
 
@@ -164,25 +213,13 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   _dbProperties->queryVals(_metadata.dbProperties(),
 			   _metadata.numDBProperties());
 
-  // Create field to hold state variables. We create the field even
-  // if there is no initial state, because this we will use this field
-  // to hold the state variables.
-  delete _stateVars; _stateVars = new topology::Field(mesh);assert(_stateVars);
-  _stateVars->label("state variables");
-  const int stateVarsFiberDim = numQuadPts * _numVarsQuadPt;
   topology::VecVisitorMesh* stateVarsVisitor = 0;
   PetscScalar* stateVarsArray = NULL;
   if (stateVarsFiberDim > 0) {
-    assert(_stateVars);
-    assert(_properties);
-    _stateVars->newSection(*_properties, stateVarsFiberDim);
-    _stateVars->allocate();
-    _stateVars->zeroAll();
     stateVarsVisitor = new topology::VecVisitorMesh(*_stateVars);
     stateVarsArray = stateVarsVisitor->localArray();
   } // if
 
-
   // Create arrays for querying
   const int numDBStateVars = _metadata.numDBStateVars();
   scalar_array stateVarsQuery;
@@ -264,6 +301,14 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   if (_dbInitialState)
     _dbInitialState->close();
 
+  if (_parameterCache) {
+    propertiesVisitor.clear();
+    _parameterCache->write(*_properties, "properties");
+    if (stateVarsFiberDim > 0) {
+      _parameterCache->write(*_stateVars, "state_variables");
+    } // if
+  } // if
+
   PYLITH_METHOD_END;
 } // initialize
 
@@ -29,6 +29,7 @@
 
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/meshio/meshiofwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 
@@ -130,6 +131,15 @@ public :
    */
   void normalizer(const spatialdata::units::Nondimensional& dim);
 
+  /** Use a persistent cache for the fields initialized from the
+   * spatial databases.
+   *
+   * @param filename Root of filename for cache files.
+   * @param dbKey Digest of the contents of the spatial databases.
+   */
+  void parameterCache(const char* filename,
+		      const char* dbKey);
+
   /** Initialize material by getting physical property parameters from
    * database.
    *
@@ -284,6 +294,9 @@ protected :
   
   topology::StratumIS* _materialIS; ///< Index set for material cells.
 
+  /// Cache of initialized parameter fields (NULL if not used).
+  meshio::ParameterCache* _parameterCache;
+
   int _numPropsQuadPt; ///< Number of properties per quad point.
   int _numVarsQuadPt; ///< Number of state variables per quad point.
   const int _dimension; ///< Spatial dimension associated with material.
@@ -0,0 +1,267 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "GreensFnsWriterHDF5.hh" // implementation of class methods
+
+#include "HDF5.hh" // USES HDF5
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _GreensFnsWriterHDF5 {
+      /// Get HDF5 datatype corresponding to PylithScalar.
+      hid_t scalartype(void) {
+	return (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+      } // scalartype
+    } // _GreensFnsWriterHDF5
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::meshio::GreensFnsWriterHDF5::GreensFnsWriterHDF5(void) :
+  _filename("greensfns.h5"),
+  _h5(0),
+  _compression(6),
+  _numImpulses(0),
+  _numPoints(0),
+  _numComponents(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::GreensFnsWriterHDF5::~GreensFnsWriterHDF5(void)
+{ // destructor
+  close();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Set filename for HDF5 file.
+void
+pylith::meshio::GreensFnsWriterHDF5::filename(const char* value)
+{ // filename
+  assert(value);
+  _filename = value;
+} // filename
+
+// ----------------------------------------------------------------------
+// Get filename for HDF5 file.
+const char*
+pylith::meshio::GreensFnsWriterHDF5::filename(void) const
+{ // filename
+  return _filename.c_str();
+} // filename
+
+// ----------------------------------------------------------------------
+// Set level of gzip compression for responses.
+void
+pylith::meshio::GreensFnsWriterHDF5::compression(const int value)
+{ // compression
+  if (value < 0 || value > 9) {
+    std::ostringstream msg;
+    msg << "Level of compression for Green's functions (" << value << ") must be in range [0,9].";
+    throw std::runtime_error(msg.str());
+  } // if
+  _compression = value;
+} // compression
+
+// ----------------------------------------------------------------------
+// Open file and create dataset for responses.
+void
+pylith::meshio::GreensFnsWriterHDF5::open(const int numImpulses,
+					  const int numPoints,
+					  const int numComponents)
+{ // open
+  PYLITH_METHOD_BEGIN;
+
+  assert(numImpulses >= 0);
+  assert(numPoints > 0);
+  assert(numComponents > 0);
+
+  close();
+
+  _numImpulses = numImpulses;
+  _numPoints = numPoints;
+  _numComponents = numComponents;
+
+  _h5 = new HDF5(_filename.c_str(), H5F_ACC_TRUNC);assert(_h5);
+  _h5->createGroup("/points");
+  _h5->createGroup("/impulses");
+
+  // One chunk per impulse.
+  const int ndims = 3;
+  const hsize_t dims[ndims] = {
+    hsize_t((numImpulses > 0) ? numImpulses : 1),
+    hsize_t(numPoints),
+    hsize_t(numComponents),
+  };
+  const hsize_t dimsChunk[ndims] = { 1, hsize_t(numPoints), hsize_t(numComponents) };
+  _h5->createDataset("/", "responses", dims, dimsChunk, ndims, _GreensFnsWriterHDF5::scalartype(), _compression);
+  _h5->writeAttribute("/responses", "num_impulses", (void*)&numImpulses, H5T_NATIVE_INT);
+
+  PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Close file.
+void
+pylith::meshio::GreensFnsWriterHDF5::close(void)
+{ // close
+  PYLITH_METHOD_BEGIN;
+
+  if (_h5) {
+    _h5->close();
+  } // if
+  delete _h5; _h5 = 0;
+
+  PYLITH_METHOD_END;
+} // close
+
+// ----------------------------------------------------------------------
+// Write coordinates and names of points.
+void
+pylith::meshio::GreensFnsWriterHDF5::writePoints(const PylithScalar* points,
+						 const int numPoints,
+						 const int spaceDim,
+						 const char* const* names,
+						 const int numNames)
+{ // writePoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(points);
+  assert(names);
+
+  if (!_h5) {
+    throw std::runtime_error("Green's functions file must be opened before writing points.");
+  } // if
+  if (numPoints != _numPoints || numNames != _numPoints) {
+    std::ostringstream msg;
+    msg << "Number of points (" << numPoints << ") and names (" << numNames
+	<< ") must match number of points in Green's functions file (" << _numPoints << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int ndims = 2;
+  const hsize_t dims[ndims] = { hsize_t(numPoints), hsize_t(spaceDim) };
+  _h5->createDataset("/points", "coordinates", dims, dims, ndims, _GreensFnsWriterHDF5::scalartype(), 0);
+  _h5->writeDatasetChunk("/points", "coordinates", points, dims, dims, ndims, 0, _GreensFnsWriterHDF5::scalartype());
+  _h5->writeDataset("/points", "names", names, numNames);
+
+  PYLITH_METHOD_END;
+} // writePoints
+
+// ----------------------------------------------------------------------
+// Write information about impulses.
+void
+pylith::meshio::GreensFnsWriterHDF5::writeImpulses(const PylithScalar* coordinates,
+						   const int numImpulses,
+						   const int spaceDim,
+						   const int* vertices,
+						   const int numVertices,
+						   const int* components,
+						   const int numComponents,
+						   const PylithScalar* amplitudes,
+						   const int numAmplitudes)
+{ // writeImpulses
+  PYLITH_METHOD_BEGIN;
+
+  if (!_h5) {
+    throw std::runtime_error("Green's functions file must be opened before writing impulses.");
+  } // if
+  if (numImpulses != _numImpulses || numVertices != _numImpulses ||
+      numComponents != _numImpulses || numAmplitudes != _numImpulses) {
+    std::ostringstream msg;
+    msg << "Size of arrays with information about impulses (" << numImpulses << ", " << numVertices
+	<< ", " << numComponents << ", " << numAmplitudes
+	<< ") must match number of impulses in Green's functions file (" << _numImpulses << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (!numImpulses) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(coordinates);
+  assert(vertices);
+  assert(components);
+  assert(amplitudes);
+
+  const hid_t scalartype = _GreensFnsWriterHDF5::scalartype();
+
+  const int ndims2 = 2;
+  const hsize_t dimsCoords[ndims2] = { hsize_t(numImpulses), hsize_t(spaceDim) };
+  _h5->createDataset("/impulses", "coordinates", dimsCoords, dimsCoords, ndims2, scalartype, 0);
+  _h5->writeDatasetChunk("/impulses", "coordinates", coordinates, dimsCoords, dimsCoords, ndims2, 0, scalartype);
+
+  const int ndims1 = 1;
+  const hsize_t dims[ndims1] = { hsize_t(numImpulses) };
+  _h5->createDataset("/impulses", "vertex", dims, dims, ndims1, H5T_NATIVE_INT, 0);
+  _h5->writeDatasetChunk("/impulses", "vertex", vertices, dims, dims, ndims1, 0, H5T_NATIVE_INT);
+  _h5->createDataset("/impulses", "component", dims, dims, ndims1, H5T_NATIVE_INT, 0);
+  _h5->writeDatasetChunk("/impulses", "component", components, dims, dims, ndims1, 0, H5T_NATIVE_INT);
+  _h5->createDataset("/impulses", "amplitude", dims, dims, ndims1, scalartype, 0);
+  _h5->writeDatasetChunk("/impulses", "amplitude", amplitudes, dims, dims, ndims1, 0, scalartype);
+
+  PYLITH_METHOD_END;
+} // writeImpulses
+
+// ----------------------------------------------------------------------
+// Write responses at points to an impulse.
+void
+pylith::meshio::GreensFnsWriterHDF5::writeResponse(const int impulse,
+						   const PylithScalar* values,
+						   const int numPoints,
+						   const int numComponents)
+{ // writeResponse
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+
+  if (!_h5) {
+    throw std::runtime_error("Green's functions file must be opened before writing responses.");
+  } // if
+  if (impulse < 0 || impulse >= _numImpulses) {
+    std::ostringstream msg;
+    msg << "Index of impulse (" << impulse << ") is out of range [0," << _numImpulses << ").";
+    throw std::out_of_range(msg.str());
+  } // if
+  if (numPoints != _numPoints || numComponents != _numComponents) {
+    std::ostringstream msg;
+    msg << "Dimensions of responses (" << numPoints << ", " << numComponents
+	<< ") must match dimensions in Green's functions file (" << _numPoints << ", " << _numComponents << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int ndims = 3;
+  const hsize_t dims[ndims] = { hsize_t(_numImpulses), hsize_t(_numPoints), hsize_t(_numComponents) };
+  const hsize_t dimsChunk[ndims] = { 1, hsize_t(_numPoints), hsize_t(_numComponents) };
+  _h5->writeDatasetChunk("/", "responses", values, dims, dimsChunk, ndims, impulse, _GreensFnsWriterHDF5::scalartype());
+
+  PYLITH_METHOD_END;
+} // writeResponse
+
+
+// End of file
@@ -0,0 +1,165 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/meshio/GreensFnsWriterHDF5.hh
+ *
+ * @brief Writer for Green's functions at points as a single HDF5
+ * dataset.
+ */
+
+#if !defined(pylith_meshio_greensfnswriterhdf5_hh)
+#define pylith_meshio_greensfnswriterhdf5_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <string> // HASA std::string
+
+// GreensFnsWriterHDF5 --------------------------------------------------
+/** @brief Writer for Green's functions at points as a single HDF5
+ * dataset.
+ *
+ * The responses at the points to all of the impulses are written to
+ * the chunked (and optionally compressed) dataset '/responses' with
+ * dimensions (impulses, points, components). Each impulse occupies
+ * one chunk, so responses are streamed to the file as they are
+ * computed. The file also contains the coordinates and names of the
+ * points ('/points') and the fault vertex, component, amplitude, and
+ * coordinates of each impulse ('/impulses').
+ *
+ * The writer uses serial HDF5, so the values must be gathered and
+ * the methods called on a single process.
+ */
+class pylith::meshio::GreensFnsWriterHDF5
+{ // GreensFnsWriterHDF5
+  friend class TestGreensFnsWriterHDF5; // unit testing
+
+// PUBLIC METHODS -------------------------------------------------------
+public :
+
+  /// Default constructor.
+  GreensFnsWriterHDF5(void);
+
+  /// Destructor
+  ~GreensFnsWriterHDF5(void);
+
+  /** Set filename for HDF5 file.
+   *
+   * @param value Filename.
+   */
+  void filename(const char* value);
+
+  /** Get filename for HDF5 file.
+   *
+   * @returns Filename.
+   */
+  const char* filename(void) const;
+
+  /** Set level of gzip compression for responses.
+   *
+   * @param value Level of compression (0=none, 1-9).
+   */
+  void compression(const int value);
+
+  /** Open file and create dataset for responses.
+   *
+   * @param numImpulses Number of impulses.
+   * @param numPoints Number of points.
+   * @param numComponents Number of components of response.
+   */
+  void open(const int numImpulses,
+	    const int numPoints,
+	    const int numComponents);
+
+  /// Close file.
+  void close(void);
+
+  /** Write coordinates and names of points.
+   *
+   * @param points Array of dimensioned coordinates of points [numPoints*spaceDim].
+   * @param numPoints Number of points.
+   * @param spaceDim Spatial dimension.
+   * @param names Array of names of points.
+   * @param numNames Number of names.
+   */
+  void writePoints(const PylithScalar* points,
+		   const int numPoints,
+		   const int spaceDim,
+		   const char* const* names,
+		   const int numNames);
+
+  /** Write information about impulses.
+   *
+   * @param coordinates Array of dimensioned coordinates of fault
+   *   vertices of impulses [numImpulses*spaceDim].
+   * @param numImpulses Number of impulses.
+   * @param spaceDim Spatial dimension.
+   * @param vertices Array of fault vertices of impulses, numbered as
+   *   in the fault output.
+   * @param numVertices Size of array of fault vertices.
+   * @param components Array of indices of components of impulses.
+   * @param numComponents Size of array of components.
+   * @param amplitudes Array of dimensioned amplitudes of impulses.
+   * @param numAmplitudes Size of array of amplitudes.
+   */
+  void writeImpulses(const PylithScalar* coordinates,
+		     const int numImpulses,
+		     const int spaceDim,
+		     const int* vertices,
+		     const int numVertices,
+		     const int* components,
+		     const int numComponents,
+		     const PylithScalar* amplitudes,
+		     const int numAmplitudes);
+
+  /** Write responses at points to an impulse.
+   *
+   * @param impulse Index of impulse.
+   * @param values Array of responses [numPoints*numComponents].
+   * @param numPoints Number of points.
+   * @param numComponents Number of components of response.
+   */
+  void writeResponse(const int impulse,
+		     const PylithScalar* values,
+		     const int numPoints,
+		     const int numComponents);
+
+// PRIVATE MEMBERS ------------------------------------------------------
+private :
+
+  std::string _filename; ///< Name of HDF5 file.
+  HDF5* _h5; ///< HDF5 file.
+  int _compression; ///< Level of gzip compression.
+  int _numImpulses; ///< Number of impulses.
+  int _numPoints; ///< Number of points.
+  int _numComponents; ///< Number of components of response.
+
+// NOT IMPLEMENTED ------------------------------------------------------
+private :
+
+  GreensFnsWriterHDF5(const GreensFnsWriterHDF5&); ///< Not implemented
+  const GreensFnsWriterHDF5& operator=(const GreensFnsWriterHDF5&); ///< Not implemented
+
+}; // GreensFnsWriterHDF5
+
+#endif // pylith_meshio_greensfnswriterhdf5_hh
+
+
+// End of file
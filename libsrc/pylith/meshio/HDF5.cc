@@ -633,7 +633,8 @@ pylith::meshio::HDF5::createDataset(const char* parent,
 				    const hsize_t* maxDims,
 				    const hsize_t* dimsChunk,
 				    const int ndims,
-				    hid_t datatype)
+				    hid_t datatype,
+				    const int compression)
 { // createDataset
   PYLITH_METHOD_BEGIN;
 
@@ -673,7 +674,9 @@ pylith::meshio::HDF5::createDataset(const char* parent,
       throw std::runtime_error("Could not set chunk.");
       
     // Set gzip compression level for chunk.
-    H5Pset_deflate(property, 6);
+    if (compression > 0) {
+      H5Pset_deflate(property, compression);
+    } // if
 
 #if defined(PYLITH_HDF5_USE_API_18)
     hid_t dataset = H5Dcreate2(group, name,
@@ -192,13 +192,15 @@ public :
    * @param dimsChunk Dimensions of data chunks.
    * @param ndims Number of dimensions of data.
    * @param datatype Type of data.
+   * @param compression Level of gzip compression (0=none).
    */
   void createDataset(const char* parent,
 		     const char* name,
 		     const hsize_t* maxDims,
 		     const hsize_t* dimsChunk,
 		     const int ndims,
-		     hid_t datatype);
+		     hid_t datatype,
+		     const int compression =6);
   
   /** Append chunk to dataset.
    *
@@ -32,12 +32,18 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <map> // USES std::map
+#include <vector> // USES std::vector
+#include <stdexcept> // USES std::runtime_error, std::out_of_range
+#include <sstream> // USES std::ostringstream
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSolnPoints::OutputSolnPoints(void) :
     _mesh(0),
     _pointsMesh(0),
-    _interpolator(0)
+    _interpolator(0),
+    _numCorners(0)
 { // constructor
 } // constructor
 
@@ -63,6 +69,9 @@ pylith::meshio::OutputSolnPoints::deallocate(void)
 
     _mesh = 0; // :TODO: Use shared pointer
     delete _pointsMesh; _pointsMesh = 0;
+    _pointIndices.resize(0);
+    _weights.resize(0);
+    _numCorners = 0;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -169,6 +178,8 @@ pylith::meshio::OutputSolnPoints::setupInterpolator(topology::Mesh* mesh,
 
     // Copy station names. :TODO: Reorder to match output (pointsLocal).
     _stations.resize(numPointsLocal);
+    _pointIndices.resize(numPointsLocal);
+    _pointIndices = -1;
     for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
 	// Find point in array of points to get index for station name.
 	for (int iAll=0; iAll < numPoints; ++iAll) {
@@ -179,6 +190,7 @@ pylith::meshio::OutputSolnPoints::setupInterpolator(topology::Mesh* mesh,
 	    } // for
 	    if (sqrt(dist) < tolerance) {
 		_stations[iLocal] = names[iAll];
+		_pointIndices[iLocal] = iAll;
 		break;
 	    } // if
 	} // for
@@ -324,4 +336,256 @@ pylith::meshio::OutputSolnPoints::writePointNames(void)
     PYLITH_METHOD_END;
 } // writePointNames
 
+// ----------------------------------------------------------------------
+// Interpolate vertex field at all points and gather the values on all
+// processes.
+void
+pylith::meshio::OutputSolnPoints::gatherPointValues(PylithScalar* values,
+                                                    const int size,
+                                                    topology::Field& field)
+{ // gatherPointValues
+    PYLITH_METHOD_BEGIN;
+
+    assert(values);
+    assert(_interpolator);
+
+    PetscErrorCode err = 0;
+
+    PetscDM dmMesh = field.dmMesh(); assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    PetscInt fiberDimLocal = 0;
+    if (verticesStratum.size() > 0) {
+        topology::VecVisitorMesh fieldVisitor(field);
+        fiberDimLocal = fieldVisitor.sectionDof(verticesStratum.begin());
+    } // if
+    PetscInt fiberDim = 0;
+    err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPIU_INT, MPI_MAX, field.mesh().comm()); PYLITH_CHECK_ERROR(err);
+    assert(fiberDim > 0);
+    if (size % fiberDim) {
+        std::ostringstream msg;
+        msg << "Size of array for values at points (" << size << ") is not a multiple of the number of components ("
+            << fiberDim << ") of field '" << field.label() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const int numPointsLocal = _interpolator->n;
+    PetscVec valuesLocalVec = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numPointsLocal*fiberDim, &valuesLocalVec); PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDof(_interpolator, fiberDim); PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationEvaluate(_interpolator, dmMesh, field.localVector(), valuesLocalVec); PYLITH_CHECK_ERROR(err);
+
+    // Each point is located on exactly one process, so summing gathers
+    // the values.
+    scalar_array valuesAll(size);
+    valuesAll = 0.0;
+    const PetscScalar* valuesLocalArray = NULL;
+    err = VecGetArrayRead(valuesLocalVec, &valuesLocalArray); PYLITH_CHECK_ERROR(err);
+    for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+        const int iPoint = _pointIndices[iLocal];
+        if (iPoint < 0 || (iPoint+1)*fiberDim > size) {
+            continue;
+        } // if
+        for (int iDim=0; iDim < fiberDim; ++iDim) {
+            valuesAll[iPoint*fiberDim+iDim] = valuesLocalArray[iLocal*fiberDim+iDim];
+        } // for
+    } // for
+    err = VecRestoreArrayRead(valuesLocalVec, &valuesLocalArray); PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&valuesLocalVec); PYLITH_CHECK_ERROR(err);
+
+    err = MPI_Allreduce(&valuesAll[0], values, size, MPIU_SCALAR, MPI_SUM, field.mesh().comm()); PYLITH_CHECK_ERROR(err);
+
+    const PylithScalar scale = field.scale();
+    for (int i=0; i < size; ++i) {
+        values[i] *= scale;
+    } // for
+
+    PYLITH_METHOD_END;
+} // gatherPointValues
+
+// ----------------------------------------------------------------------
+// Add point force at a point to a vertex field.
+void
+pylith::meshio::OutputSolnPoints::addPointForce(topology::Field* field,
+                                                const int point,
+                                                const int component,
+                                                const PylithScalar value)
+{ // addPointForce
+    PYLITH_METHOD_BEGIN;
+
+    assert(field);
+    assert(_interpolator);
+
+    if (_numCorners <= 0) {
+        _setupInterpolationWeights();
+    } // if
+
+    topology::VecVisitorMesh fieldVisitor(*field);
+    scalar_array valuesCell;
+
+    const int numPointsLocal = _interpolator->n;
+    for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+        if (_pointIndices[iLocal] != point) {
+            continue;
+        } // if
+
+        const PetscInt cell = _interpolator->cells[iLocal];
+        fieldVisitor.getClosure(&valuesCell, cell);
+        const int fiberDim = valuesCell.size() / _numCorners;
+        assert(valuesCell.size() == size_t(fiberDim*_numCorners));
+        if (component < 0 || component >= fiberDim) {
+            std::ostringstream msg;
+            msg << "Component " << component << " of point force is out of range [0," << fiberDim
+                << ") for field '" << field->label() << "'.";
+            throw std::out_of_range(msg.str());
+        } // if
+
+        valuesCell = 0.0;
+        for (int iCorner=0; iCorner < _numCorners; ++iCorner) {
+            valuesCell[iCorner*fiberDim+component] = value*_weights[iLocal*_numCorners+iCorner];
+        } // for
+        fieldVisitor.setClosure(&valuesCell[0], valuesCell.size(), cell, ADD_VALUES);
+    } // for
+
+    PYLITH_METHOD_END;
+} // addPointForce
+
+// ----------------------------------------------------------------------
+// Compute weights of the vertices in the cells containing the local points.
+void
+pylith::meshio::OutputSolnPoints::_setupInterpolationWeights(void)
+{ // _setupInterpolationWeights
+    PYLITH_METHOD_BEGIN;
+
+    assert(_mesh);
+    assert(_interpolator);
+
+    PetscDM dmMesh = _mesh->dmMesh(); assert(dmMesh);
+    PetscErrorCode err = 0;
+
+    // All cells have the same number of vertices.
+    const int numPointsLocal = _interpolator->n;
+    PetscInt numCornersLocal = 0;
+    if (numPointsLocal > 0) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, _interpolator->cells[0], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+        const PetscInt vStart = verticesStratum.begin();
+        const PetscInt vEnd = verticesStratum.end();
+        for (PetscInt i=0; i < 2*closureSize; i += 2) {
+            if (closure[i] >= vStart && closure[i] < vEnd) {
+                ++numCornersLocal;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, _interpolator->cells[0], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+    } // if
+    PetscInt numCorners = 0;
+    err = MPI_Allreduce(&numCornersLocal, &numCorners, 1, MPIU_INT, MPI_MAX, _mesh->comm()); PYLITH_CHECK_ERROR(err);
+    if (!numCorners) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Probe field with one value per corner. Setting value iCorner at
+    // vertex iCorner of the cell and interpolating gives the weight of
+    // the vertex. Cells that share a vertex at a different corner
+    // cannot be probed at the same time, so we group the points so
+    // that within a group every vertex has a single corner index and
+    // evaluate the interpolation once per group. Stations seldom lie
+    // in neighboring cells, so there usually is only one group.
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    int_array cellVertices(numPointsLocal*numCorners);
+    for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        int iCorner = 0;
+        err = DMPlexGetTransitiveClosure(dmMesh, _interpolator->cells[iLocal], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        for (PetscInt i=0; i < 2*closureSize; i += 2) {
+            if (closure[i] >= vStart && closure[i] < vEnd) {
+                assert(iCorner < numCorners);
+                cellVertices[iLocal*numCorners+iCorner++] = closure[i];
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, _interpolator->cells[iLocal], PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+        assert(numCorners == iCorner);
+    } // for
+
+    int_array pointGroup(numPointsLocal);
+    std::vector<std::map<PetscInt,int> > groupCorners;
+    for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+        size_t iGroup = 0;
+        for (; iGroup < groupCorners.size(); ++iGroup) {
+            const std::map<PetscInt,int>& corners = groupCorners[iGroup];
+            bool compatible = true;
+            for (int iCorner=0; iCorner < numCorners && compatible; ++iCorner) {
+                const std::map<PetscInt,int>::const_iterator iter = corners.find(cellVertices[iLocal*numCorners+iCorner]);
+                compatible = iter == corners.end() || iter->second == iCorner;
+            } // for
+            if (compatible) {
+                break;
+            } // if
+        } // for
+        if (iGroup == groupCorners.size()) {
+            groupCorners.resize(iGroup+1);
+        } // if
+        for (int iCorner=0; iCorner < numCorners; ++iCorner) {
+            groupCorners[iGroup][cellVertices[iLocal*numCorners+iCorner]] = iCorner;
+        } // for
+        pointGroup[iLocal] = iGroup;
+    } // for
+    // Evaluation is collective, so all processes make the same number of evaluations.
+    PetscInt numGroupsLocal = groupCorners.size();
+    PetscInt numGroups = 0;
+    err = MPI_Allreduce(&numGroupsLocal, &numGroups, 1, MPIU_INT, MPI_MAX, _mesh->comm()); PYLITH_CHECK_ERROR(err);
+
+    topology::Field probe(*_mesh);
+    probe.label("interpolation weights");
+    probe.newSection(topology::FieldBase::VERTICES_FIELD, numCorners);
+    probe.allocate();
+    probe.zeroAll();
+    topology::VecVisitorMesh probeVisitor(probe);
+
+    const int probeSize = numCorners*numCorners;
+    scalar_array probeCell(probeSize);
+    scalar_array zeroCell(probeSize);
+    probeCell = 0.0;
+    zeroCell = 0.0;
+    for (int iCorner=0; iCorner < numCorners; ++iCorner) {
+        probeCell[iCorner*numCorners+iCorner] = 1.0;
+    } // for
+
+    PetscVec weightsVec = NULL;
+    err = VecCreateSeq(PETSC_COMM_SELF, numPointsLocal*numCorners, &weightsVec); PYLITH_CHECK_ERROR(err);
+    err = DMInterpolationSetDof(_interpolator, numCorners); PYLITH_CHECK_ERROR(err);
+
+    _weights.resize(numPointsLocal*numCorners);
+    for (PetscInt iGroup=0; iGroup < numGroups; ++iGroup) {
+        for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+            if (pointGroup[iLocal] == iGroup) {
+                probeVisitor.setClosure(&probeCell[0], probeSize, _interpolator->cells[iLocal], INSERT_VALUES);
+            } // if
+        } // for
+        err = DMInterpolationEvaluate(_interpolator, probe.dmMesh(), probe.localVector(), weightsVec); PYLITH_CHECK_ERROR(err);
+
+        const PetscScalar* weightsArray = NULL;
+        err = VecGetArrayRead(weightsVec, &weightsArray); PYLITH_CHECK_ERROR(err);
+        for (int iLocal=0; iLocal < numPointsLocal; ++iLocal) {
+            if (pointGroup[iLocal] != iGroup) {
+                continue;
+            } // if
+            for (int iCorner=0; iCorner < numCorners; ++iCorner) {
+                _weights[iLocal*numCorners+iCorner] = weightsArray[iLocal*numCorners+iCorner];
+            } // for
+            probeVisitor.setClosure(&zeroCell[0], probeSize, _interpolator->cells[iLocal], INSERT_VALUES);
+        } // for
+        err = VecRestoreArrayRead(weightsVec, &weightsArray); PYLITH_CHECK_ERROR(err);
+    } // for
+    err = VecDestroy(&weightsVec); PYLITH_CHECK_ERROR(err);
+
+    _numCorners = numCorners;
+
+    PYLITH_METHOD_END;
+} // _setupInterpolationWeights
+
 // End of file
@@ -36,6 +36,8 @@
 #include "pylith/topology/Field.hh" // ISA OutputManager<Field<Mesh>>
 #include "OutputManager.hh" // ISA OutputManager
 
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
+
 // OutputSolnPoints -----------------------------------------------------
 /** @brief C++ object for managing output of finite-element data over
  * a subdomain.
@@ -133,12 +135,52 @@ void appendCellField(const PylithScalar t,
  */
 void writePointNames(void);
 
+/** Interpolate vertex field at all points and gather the values on
+ * all processes.
+ *
+ * Values are ordered by the points in the array passed to
+ * setupInterpolator() and are dimensionalized using the scale of the
+ * field.
+ *
+ * @param values Array of values [numPoints*fiberDim].
+ * @param size Size of array.
+ * @param field Vertex field.
+ */
+void gatherPointValues(PylithScalar* values,
+                       const int size,
+                       pylith::topology::Field& field);
+
+/** Add point force at a point to a vertex field.
+ *
+ * The force is distributed to the vertices of the cell containing
+ * the point using the interpolation weights, i.e., the transpose of
+ * the interpolation used for output. Only the process that owns the
+ * point adds the force, so the field must be completed (assembled)
+ * afterwards. The interpolation weights are computed on the first
+ * call, so the method must be called by all processes.
+ *
+ * @param field Vertex field (e.g., residual).
+ * @param point Index of point in array of all points.
+ * @param component Index of component of force.
+ * @param value Magnitude of force.
+ */
+void addPointForce(pylith::topology::Field* field,
+                   const int point,
+                   const int component,
+                   const PylithScalar value);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
 OutputSolnPoints(const OutputSolnPoints&);   ///< Not implemented.
 const OutputSolnPoints& operator=(const OutputSolnPoints&);   ///< Not implemented
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+/// Compute weights of the vertices in the cells containing the local points.
+void _setupInterpolationWeights(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -146,6 +188,9 @@ pylith::topology::Mesh* _mesh;   ///< Domain mesh.
 pylith::topology::Mesh* _pointsMesh;   ///< Mesh for points (no cells).
 DMInterpolationInfo _interpolator;   ///< Field interpolator.
 pylith::string_vector _stations; ///< Array of station names.
+pylith::int_array _pointIndices; ///< Index of local points in array of all points.
+pylith::scalar_array _weights; ///< Interpolation weights of cell vertices for local points.
+int _numCorners; ///< Number of vertices in cells containing points.
 
 }; // OutputSolnPoints
 
@@ -0,0 +1,361 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "ParameterCache.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/feassemble/QuadratureRefCell.hh" // USES QuadratureRefCell
+#include "pylith/utils/array.hh" // USES scalar_array
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#if defined(ENABLE_HDF5)
+#include "HDF5.hh" // USES HDF5
+#endif
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ifstream
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <iomanip> // USES std::setw
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _ParameterCache {
+      /// Offset basis and prime for 64-bit FNV-1a hash.
+      const unsigned long long fnvOffset = 14695981039346656037ULL;
+      const unsigned long long fnvPrime = 1099511628211ULL;
+    } // _ParameterCache
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::meshio::ParameterCache::ParameterCache(void) :
+  _filename("parameters_cache"),
+  _dbKey(""),
+  _hashValue(_ParameterCache::fnvOffset),
+  _rank(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::ParameterCache::~ParameterCache(void)
+{ // destructor
+} // destructor
+
+// ----------------------------------------------------------------------
+// Set root of filename for cache files.
+void
+pylith::meshio::ParameterCache::filename(const char* value)
+{ // filename
+  assert(value);
+  _filename = value;
+} // filename
+
+// ----------------------------------------------------------------------
+// Get root of filename for cache files.
+const char*
+pylith::meshio::ParameterCache::filename(void) const
+{ // filename
+  return _filename.c_str();
+} // filename
+
+// ----------------------------------------------------------------------
+// Set user supplied portion of the cache key.
+void
+pylith::meshio::ParameterCache::dbKey(const char* value)
+{ // dbKey
+  assert(value);
+  _dbKey = value;
+} // dbKey
+
+// ----------------------------------------------------------------------
+// Start a new cache key.
+void
+pylith::meshio::ParameterCache::resetKey(void)
+{ // resetKey
+  _hashValue = _ParameterCache::fnvOffset;
+} // resetKey
+
+// ----------------------------------------------------------------------
+// Add points of the mesh to the cache key.
+void
+pylith::meshio::ParameterCache::hashMesh(const topology::Mesh& mesh,
+					 const PetscInt* points,
+					 const PetscInt numPoints)
+{ // hashMesh
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  _rank = mesh.commRank();
+  int commSize = 0;
+  err = MPI_Comm_size(mesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  _hash(&_rank, sizeof(_rank));
+  _hash(&commSize, sizeof(commSize));
+  _hash(&numPoints, sizeof(numPoints));
+
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  for (PetscInt p = 0; p < numPoints; ++p) {
+    const PetscInt point = points[p];
+    _hash(&point, sizeof(point));
+
+    const PetscInt* cone = NULL;
+    PetscInt coneSize = 0;
+    err = DMPlexGetConeSize(dmMesh, point, &coneSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetCone(dmMesh, point, &cone);PYLITH_CHECK_ERROR(err);
+    if (coneSize > 0) {
+      _hash(cone, coneSize*sizeof(PetscInt));
+    } // if
+
+    PetscScalar* coordsPoint = NULL;
+    PetscInt coordsSize = 0;
+    coordsVisitor.getClosure(&coordsPoint, &coordsSize, point);
+    if (coordsSize > 0) {
+      _hash(coordsPoint, coordsSize*sizeof(PetscScalar));
+    } // if
+    coordsVisitor.restoreClosure(&coordsPoint, &coordsSize, point);
+  } // for
+
+  PYLITH_METHOD_END;
+} // hashMesh
+
+// ----------------------------------------------------------------------
+// Add quadrature scheme to the cache key.
+void
+pylith::meshio::ParameterCache::hashQuadrature(const feassemble::QuadratureRefCell& quadrature)
+{ // hashQuadrature
+  PYLITH_METHOD_BEGIN;
+
+  const int sizes[4] = { quadrature.cellDim(), quadrature.spaceDim(), quadrature.numBasis(), quadrature.numQuadPts() };
+  _hash(sizes, sizeof(sizes));
+
+  const scalar_array& quadPtsRef = quadrature.quadPtsRef();
+  if (quadPtsRef.size() > 0) {
+    _hash(&quadPtsRef[0], quadPtsRef.size()*sizeof(PylithScalar));
+  } // if
+  const scalar_array& quadWts = quadrature.quadWts();
+  if (quadWts.size() > 0) {
+    _hash(&quadWts[0], quadWts.size()*sizeof(PylithScalar));
+  } // if
+
+  PYLITH_METHOD_END;
+} // hashQuadrature
+
+// ----------------------------------------------------------------------
+// Add nondimensionalization scales to the cache key.
+void
+pylith::meshio::ParameterCache::hashNormalizer(const spatialdata::units::Nondimensional& normalizer)
+{ // hashNormalizer
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar scales[4] = {
+    normalizer.lengthScale(),
+    normalizer.pressureScale(),
+    normalizer.timeScale(),
+    normalizer.densityScale(),
+  };
+  _hash(scales, sizeof(scales));
+
+  PYLITH_METHOD_END;
+} // hashNormalizer
+
+// ----------------------------------------------------------------------
+// Get the cache key.
+std::string
+pylith::meshio::ParameterCache::key(void) const
+{ // key
+  unsigned long long value = _hashValue;
+  for (size_t i=0; i < _dbKey.length(); ++i) {
+    value ^= (unsigned char)(_dbKey[i]);
+    value *= _ParameterCache::fnvPrime;
+  } // for
+
+  std::ostringstream s;
+  s << std::hex << std::setw(16) << std::setfill('0') << value;
+
+  return s.str();
+} // key
+
+// ----------------------------------------------------------------------
+// Read values of field from the cache.
+bool
+pylith::meshio::ParameterCache::read(topology::Field* field,
+				     const char* name)
+{ // read
+  PYLITH_METHOD_BEGIN;
+
+  assert(field);
+  assert(name);
+
+#if defined(ENABLE_HDF5)
+  if (!_isCurrent()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  HDF5 h5(_filenameLocal().c_str(), H5F_ACC_RDONLY);
+  const std::string path = std::string("/fields/") + name;
+  if (!h5.hasDataset(path.c_str())) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscInt size = 0;
+  PetscErrorCode err = VecGetLocalSize(fieldVisitor.localVec(), &size);PYLITH_CHECK_ERROR(err);
+
+  int sizeCache = 0;
+  h5.readAttribute(path.c_str(), "size", (void*)&sizeCache, H5T_NATIVE_INT);
+  if (sizeCache != size) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  if (size > 0) {
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    char* data = 0;
+    hsize_t* dims = 0;
+    int ndims = 0;
+    h5.readDatasetChunk("/fields", name, &data, &dims, &ndims, 0, scalartype);
+    assert(2 == ndims);
+    assert(hsize_t(size) == dims[1]);
+    const PylithScalar* values = (const PylithScalar*)data;
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt i = 0; i < size; ++i) {
+      fieldArray[i] = values[i];
+    } // for
+    delete[] data; data = 0;
+    delete[] dims; dims = 0;
+  } // if
+  h5.close();
+
+  PYLITH_METHOD_RETURN(true);
+#else
+  PYLITH_METHOD_RETURN(false);
+#endif
+} // read
+
+// ----------------------------------------------------------------------
+// Write values of field to the cache.
+void
+pylith::meshio::ParameterCache::write(const topology::Field& field,
+				      const char* name)
+{ // write
+  PYLITH_METHOD_BEGIN;
+
+  assert(name);
+
+#if defined(ENABLE_HDF5)
+  const std::string filename = _filenameLocal();
+  HDF5 h5;
+  if (_isCurrent()) {
+    h5.open(filename.c_str(), H5F_ACC_RDWR);
+  } else {
+    h5.open(filename.c_str(), H5F_ACC_TRUNC);
+    h5.writeAttribute("/", "key", key().c_str());
+    h5.createGroup("/fields");
+  } // if/else
+
+  const std::string path = std::string("/fields/") + name;
+  if (h5.hasDataset(path.c_str())) {
+    PYLITH_METHOD_END;
+  } // if
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  PetscInt size = 0;
+  PetscErrorCode err = VecGetLocalSize(fieldVisitor.localVec(), &size);PYLITH_CHECK_ERROR(err);
+
+  // Datasets require at least one value; processes without any
+  // points store a placeholder and a size of zero.
+  const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+  const PylithScalar zero = 0.0;
+  const PetscScalar* fieldArray = (size > 0) ? fieldVisitor.localArray() : &zero;
+  const int ndims = 2;
+  const hsize_t dims[ndims] = { 1, hsize_t((size > 0) ? size : 1) };
+  h5.createDataset("/fields", name, dims, dims, ndims, scalartype);
+  h5.writeDatasetChunk("/fields", name, fieldArray, dims, dims, ndims, 0, scalartype);
+  const int sizeCache = size;
+  h5.writeAttribute(path.c_str(), "size", (void*)&sizeCache, H5T_NATIVE_INT);
+  h5.close();
+#else
+  throw std::runtime_error("Parameter cache requires PyLith to be built with HDF5 support.");
+#endif
+
+  PYLITH_METHOD_END;
+} // write
+
+// ----------------------------------------------------------------------
+// Add bytes to the cache key.
+void
+pylith::meshio::ParameterCache::_hash(const void* data,
+				      const size_t size)
+{ // _hash
+  const unsigned char* bytes = (const unsigned char*)data;
+  for (size_t i=0; i < size; ++i) {
+    _hashValue ^= bytes[i];
+    _hashValue *= _ParameterCache::fnvPrime;
+  } // for
+} // _hash
+
+// ----------------------------------------------------------------------
+// Get name of cache file for local process.
+std::string
+pylith::meshio::ParameterCache::_filenameLocal(void) const
+{ // _filenameLocal
+  std::ostringstream filename;
+  filename << _filename << "_p" << _rank << ".h5";
+
+  return filename.str();
+} // _filenameLocal
+
+// ----------------------------------------------------------------------
+// Check whether the cache file exists and has a matching key.
+bool
+pylith::meshio::ParameterCache::_isCurrent(void) const
+{ // _isCurrent
+  PYLITH_METHOD_BEGIN;
+
+#if defined(ENABLE_HDF5)
+  const std::string filename = _filenameLocal();
+  std::ifstream fin(filename.c_str());
+  if (!fin.good()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  fin.close();
+
+  HDF5 h5(filename.c_str(), H5F_ACC_RDONLY);
+  const std::string keyCache = h5.readAttribute("/", "key");
+  h5.close();
+
+  PYLITH_METHOD_RETURN(keyCache == key());
+#else
+  PYLITH_METHOD_RETURN(false);
+#endif
+} // _isCurrent
+
+
+// End of file
@@ -0,0 +1,193 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/meshio/ParameterCache.hh
+ *
+ * @brief Persistent cache of initialized parameter fields.
+ */
+
+#if !defined(pylith_meshio_parametercache_hh)
+#define pylith_meshio_parametercache_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Field, Mesh
+#include "pylith/feassemble/feassemblefwd.hh" // USES QuadratureRefCell
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
+
+#include <string> // HASA std::string
+
+// ParameterCache -------------------------------------------------------
+/** @brief Persistent on-disk cache of initialized parameter fields.
+ *
+ * Fields that are filled by querying spatial databases (physical
+ * properties, state variables, initial stress/strain, friction
+ * parameters) are written to an HDF5 file after the first run. Later
+ * runs with an identical key load the local arrays directly instead
+ * of querying the databases.
+ *
+ * Each process reads and writes its own file, so the local arrays
+ * are used as-is and no communication is required. The key combines
+ * a user supplied string (a digest of the spatial database files),
+ * the local mesh topology and coordinates of the points associated
+ * with the fields, the partition (rank and number of processes), the
+ * quadrature scheme, and the nondimensionalization scales. A cache
+ * file with a different key is ignored and overwritten.
+ *
+ * The cache is only available when PyLith is built with HDF5 support.
+ */
+class pylith::meshio::ParameterCache
+{ // ParameterCache
+  friend class TestParameterCache; // unit testing
+
+// PUBLIC METHODS -------------------------------------------------------
+public :
+
+  /// Default constructor.
+  ParameterCache(void);
+
+  /// Destructor
+  ~ParameterCache(void);
+
+  /** Set root of filename for cache files.
+   *
+   * The process rank and the suffix '.h5' are appended to the root.
+   *
+   * @param value Root of filename.
+   */
+  void filename(const char* value);
+
+  /** Get root of filename for cache files.
+   *
+   * @returns Root of filename.
+   */
+  const char* filename(void) const;
+
+  /** Set user supplied portion of the cache key (usually a digest of
+   * the contents of the spatial database files).
+   *
+   * @param value Key for spatial databases.
+   */
+  void dbKey(const char* value);
+
+  /** Start a new cache key. Discards the mesh, quadrature, and
+   * nondimensionalization previously added to the key (the key for
+   * the spatial databases is kept).
+   */
+  void resetKey(void);
+
+  /** Add points of the mesh to the cache key. The point numbers, the
+   * cones of the points, and the coordinates of the vertices in the
+   * closure of each point are hashed along with the process rank and
+   * number of processes.
+   *
+   * @param mesh Finite-element mesh.
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   */
+  void hashMesh(const topology::Mesh& mesh,
+		const PetscInt* points,
+		const PetscInt numPoints);
+
+  /** Add quadrature scheme to the cache key.
+   *
+   * @param quadrature Quadrature for finite-element integration.
+   */
+  void hashQuadrature(const feassemble::QuadratureRefCell& quadrature);
+
+  /** Add nondimensionalization scales to the cache key.
+   *
+   * @param normalizer Nondimensionalizer.
+   */
+  void hashNormalizer(const spatialdata::units::Nondimensional& normalizer);
+
+  /** Get the cache key.
+   *
+   * @returns Cache key as a hexadecimal string.
+   */
+  std::string key(void) const;
+
+  /** Read values of field from the cache.
+   *
+   * The section of the field must already be set up and allocated.
+   *
+   * @param field Field to fill with values.
+   * @param name Name of field in cache.
+   *
+   * @returns True if the field was found in a cache file with a
+   * matching key and the size of the stored values matches the local
+   * size of the field, false otherwise.
+   */
+  bool read(topology::Field* field,
+	    const char* name);
+
+  /** Write values of field to the cache.
+   *
+   * A new cache file is created if none exists or the key of the
+   * existing file does not match.
+   *
+   * @param field Field with values.
+   * @param name Name of field in cache.
+   */
+  void write(const topology::Field& field,
+	     const char* name);
+
+// PRIVATE METHODS ------------------------------------------------------
+private :
+
+  /** Add bytes to the cache key.
+   *
+   * @param data Array of bytes.
+   * @param size Number of bytes.
+   */
+  void _hash(const void* data,
+	     const size_t size);
+
+  /** Get name of cache file for local process.
+   *
+   * @returns Name of cache file.
+   */
+  std::string _filenameLocal(void) const;
+
+  /** Check whether the cache file exists and has a matching key.
+   *
+   * @returns True if cache file matches, false otherwise.
+   */
+  bool _isCurrent(void) const;
+
+// PRIVATE MEMBERS ------------------------------------------------------
+private :
+
+  std::string _filename; ///< Root of filename for cache files.
+  std::string _dbKey; ///< User supplied portion of cache key.
+  unsigned long long _hashValue; ///< Hash of mesh, quadrature, and scales.
+  int _rank; ///< Rank of local process.
+
+// NOT IMPLEMENTED ------------------------------------------------------
+private :
+
+  ParameterCache(const ParameterCache&); ///< Not implemented
+  const ParameterCache& operator=(const ParameterCache&); ///< Not implemented
+
+}; // ParameterCache
+
+#endif // pylith_meshio_parametercache_hh
+
+
+// End of file
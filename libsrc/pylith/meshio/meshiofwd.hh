@@ -59,6 +59,8 @@ namespace pylith {
     class OutputSolnPoints;
 
     class HDF5;
+    class ParameterCache;
+    class GreensFnsWriterHDF5;
     class Xdmf;
 
   } // meshio
@@ -27,11 +27,14 @@
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/faults/FaultCohesiveKinBatch.hh" // HOLDSA FaultCohesiveKinBatch
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include "journal/debug.h" // USES journal::debug_t
 
 #include <cassert> // USES assert()
+#include <typeinfo> // USES typeid()
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -44,6 +47,8 @@ pylith::problems::Formulation::Formulation(void) :
   _fields(0),
   _isJacobianSymmetric(false),
   _splitFields(false),
+  _batchFaults(false),
+  _faultBatch(0),
   _residualWriter(NULL)
 { // constructor
 } // constructor
@@ -63,6 +68,7 @@ pylith::problems::Formulation::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   delete _residualWriter; _residualWriter = NULL;
+  delete _faultBatch; _faultBatch = 0;
   _jacobian = 0; // :TODO: Use shared pointer.
   _jacobianLumped = 0; // :TODO: Use shared pointer.
   _fields = 0; // :TODO: Use shared pointer.
@@ -112,6 +118,22 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for batching faults with kinematic slip.
+void
+pylith::problems::Formulation::batchFaults(const bool flag)
+{ // batchFaults
+  _batchFaults = flag;
+} // batchFaults
+
+// ----------------------------------------------------------------------
+// Get flag for batching faults with kinematic slip.
+bool
+pylith::problems::Formulation::batchFaults(void) const
+{ // batchFaults
+  return _batchFaults;
+} // batchFaults
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -139,6 +161,38 @@ pylith::problems::Formulation::integrators(feassemble::Integrator* integratorArr
   _integrators.resize(numIntegrators);
   for (int i=0; i < numIntegrators; ++i)
     _integrators[i] = integratorArray[i];
+
+  delete _faultBatch; _faultBatch = 0;
+  if (!_batchFaults) {
+    return;
+  } // if
+
+  // Replace faults with kinematic slip by a single batch at the
+  // position of the first one. Only objects that are exactly
+  // FaultCohesiveKin are batched; derived classes may add terms to
+  // the residual.
+  int numKinFaults = 0;
+  for (int i=0; i < numIntegrators; ++i) {
+    if (typeid(*integratorArray[i]) == typeid(faults::FaultCohesiveKin)) {
+      ++numKinFaults;
+    } // if
+  } // for
+  if (numKinFaults < 2) {
+    return;
+  } // if
+
+  _faultBatch = new faults::FaultCohesiveKinBatch;assert(_faultBatch);
+  _integrators.clear();
+  for (int i=0; i < numIntegrators; ++i) {
+    if (typeid(*integratorArray[i]) == typeid(faults::FaultCohesiveKin)) {
+      if (0 == _faultBatch->numFaults()) {
+	_integrators.push_back(_faultBatch);
+      } // if
+      _faultBatch->addFault(static_cast<faults::FaultCohesiveKin*>(integratorArray[i]));
+    } else {
+      _integrators.push_back(integratorArray[i]);
+    } // if/else
+  } // for
 } // integrators
   
 // ----------------------------------------------------------------------
@@ -396,6 +450,21 @@ pylith::problems::Formulation::adjustSolnLumped(void)
   PYLITH_METHOD_END;
 } // adjustSolnLumped
 
+// ----------------------------------------------------------------------
+// Set whether trial state variables correspond to converged solution.
+void
+pylith::problems::Formulation::trialStateVarsCurrent(const bool flag)
+{ // trialStateVarsCurrent
+  PYLITH_METHOD_BEGIN;
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->trialStateVarsCurrent(flag);
+  } // for
+
+  PYLITH_METHOD_END;
+} // trialStateVarsCurrent
+
 // ----------------------------------------------------------------------
 void
 pylith::problems::Formulation::printState(PetscVec* solutionVec,
@@ -32,6 +32,7 @@
 #include "pylith/feassemble/feassemblefwd.hh" // USES Integrator
 #include "pylith/topology/topologyfwd.hh" // USES Mesh, Field, SolutionFields
 #include "pylith/meshio/meshiofwd.hh" // USES DataWriterHDF5
+#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveKinBatch
 
 #include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
 
@@ -80,6 +81,20 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for batching residual computation of faults with
+   * kinematic (prescribed) slip.
+   *
+   * @param flag True if batching faults, false otherwise.
+   */
+  void batchFaults(const bool flag);
+
+  /** Get flag for batching residual computation of faults with
+   * kinematic (prescribed) slip.
+   *
+   * @returns True if batching faults, false otherwise.
+   */
+  bool batchFaults(void) const;
+
   /** Get solution fields.
    *
    * @returns solution fields.
@@ -93,6 +108,10 @@ public :
   bool isJacobianSymmetric(void) const;
   
   /** Set handles to integrators.
+   *
+   * If batching faults, faults with kinematic (prescribed) slip are
+   * replaced by a single integrator that computes their residual
+   * with one loop over their vertices.
    *
    * @param integratorArray Array of integrators.
    * @param numIntegrators Number of integrators.
@@ -161,6 +180,13 @@ public :
    */
   void adjustSolnLumped(void);
 
+  /** Set whether state variables computed in the most recent residual
+   * evaluation correspond to the converged solution.
+   *
+   * @param flag True if trial state variables are current, false otherwise.
+   */
+  void trialStateVarsCurrent(const bool flag);
+
   /// Compute rate fields (velocity and/or acceleration) at time t.
   virtual
   void calcRateFields(void) = 0;
@@ -187,6 +213,9 @@ protected :
   bool _splitFields; ///< True if splitting fields.
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
+  bool _batchFaults; ///< True if batching faults with kinematic slip.
+
+  faults::FaultCohesiveKinBatch* _faultBatch; ///< Batch of faults with kinematic slip.
 
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
@@ -33,10 +33,17 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+#include <cstring> // USES memcpy()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverLinear::SolverLinear(void) :
-  _ksp(0)
+  _ksp(0),
+  _blockRHS(0),
+  _blockSoln(0)
 { // constructor
 } // constructor
 
@@ -57,6 +64,8 @@ pylith::problems::SolverLinear::deallocate(void)
   Solver::deallocate();
 
   PetscErrorCode err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&_blockRHS);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&_blockSoln);PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -145,6 +154,189 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
   PYLITH_METHOD_END;
 } // solve
 
+// ----------------------------------------------------------------------
+// Allocate storage for solving systems with multiple right-hand sides.
+void
+pylith::problems::SolverLinear::createBlock(const topology::Field& solution,
+					    const int blockSize)
+{ // createBlock
+  PYLITH_METHOD_BEGIN;
+
+  if (blockSize < 1) {
+    std::ostringstream msg;
+    msg << "Number of right-hand sides in block (" << blockSize << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PetscErrorCode err = 0;
+  err = MatDestroy(&_blockRHS);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&_blockSoln);PYLITH_CHECK_ERROR(err);
+
+  PetscInt nrowsLocal = 0;
+  const PetscVec solutionVec = solution.globalVector();
+  err = VecGetLocalSize(solutionVec, &nrowsLocal);PYLITH_CHECK_ERROR(err);
+  err = MatCreateDense(solution.mesh().comm(), nrowsLocal, PETSC_DECIDE, PETSC_DETERMINE, blockSize, NULL, &_blockRHS);PYLITH_CHECK_ERROR(err);
+  err = MatDuplicate(_blockRHS, MAT_DO_NOT_COPY_VALUES, &_blockSoln);PYLITH_CHECK_ERROR(err);
+  err = MatZeroEntries(_blockRHS);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // createBlock
+
+// ----------------------------------------------------------------------
+// Get number of right-hand sides in each block.
+int
+pylith::problems::SolverLinear::blockSize(void) const
+{ // blockSize
+  PYLITH_METHOD_BEGIN;
+
+  PetscInt ncols = 0;
+  if (_blockRHS) {
+    PetscErrorCode err = MatGetSize(_blockRHS, NULL, &ncols);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_RETURN(ncols);
+} // blockSize
+
+// ----------------------------------------------------------------------
+// Store residual as right-hand side of block.
+void
+pylith::problems::SolverLinear::setBlockRHS(const topology::Field& residual,
+					    const int index)
+{ // setBlockRHS
+  PYLITH_METHOD_BEGIN;
+
+  assert(_blockRHS);
+  assert(0 <= index && index < blockSize());
+
+  const int scatterEvent = _logger->eventId("SoLi scatter");
+  _logger->eventBegin(scatterEvent);
+
+  // Update PetscVector view of field.
+  residual.scatterLocalToGlobal();
+
+  _logger->eventEnd(scatterEvent);
+
+  // Local block of dense matrix is stored by columns.
+  PetscErrorCode err = 0;
+  PetscInt nrowsLocal = 0;
+  err = MatGetLocalSize(_blockRHS, &nrowsLocal, NULL);PYLITH_CHECK_ERROR(err);
+
+  const PetscVec residualVec = residual.globalVector();
+  const PetscScalar* residualArray = NULL;
+  PetscScalar* rhsArray = NULL;
+  err = VecGetArrayRead(residualVec, &residualArray);PYLITH_CHECK_ERROR(err);
+  err = MatDenseGetArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  memcpy(&rhsArray[index*nrowsLocal], residualArray, nrowsLocal*sizeof(PetscScalar));
+  err = MatDenseRestoreArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(residualVec, &residualArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // setBlockRHS
+
+// ----------------------------------------------------------------------
+// Solve the system for a block of right-hand sides.
+void
+pylith::problems::SolverLinear::solveBlock(topology::Jacobian* jacobian,
+					   const int numRHS)
+{ // solveBlock
+  PYLITH_METHOD_BEGIN;
+
+  assert(jacobian);
+  assert(_blockRHS);
+  assert(_blockSoln);
+  assert(0 < numRHS && numRHS <= blockSize());
+
+  const int setupEvent = _logger->eventId("SoLi setup");
+  const int solveEvent = _logger->eventId("SoLi solve");
+  _logger->eventBegin(setupEvent);
+
+  PetscErrorCode err = 0;
+  const PetscMat jacobianMat = jacobian->matrix();
+  err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+  jacobian->resetValuesChanged();
+  err = KSPSetUp(_ksp);PYLITH_CHECK_ERROR(err);
+
+  PetscInt nrowsLocal = 0;
+  err = MatGetLocalSize(_blockRHS, &nrowsLocal, NULL);PYLITH_CHECK_ERROR(err);
+  PetscScalar* rhsArray = NULL;
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(solveEvent);
+
+#if PETSC_VERSION_GE(3,14,0)
+  // Unused right-hand sides in a partial block are zero, so they
+  // converge immediately.
+  err = MatDenseGetArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=numRHS*nrowsLocal; i < blockSize()*nrowsLocal; ++i) {
+    rhsArray[i] = 0.0;
+  } // for
+  err = MatDenseRestoreArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  err = KSPMatSolve(_ksp, _blockRHS, _blockSoln);PYLITH_CHECK_ERROR(err);
+#else
+  // Solve one column at a time, reusing the preconditioner setup.
+  PetscScalar* solnArray = NULL;
+  PetscVec rhsVec = NULL, solnVec = NULL;
+  err = MatCreateVecs(_blockRHS, &solnVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+  err = MatDenseGetArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  err = MatDenseGetArray(_blockSoln, &solnArray);PYLITH_CHECK_ERROR(err);
+  for (int i=0; i < numRHS; ++i) {
+    err = VecPlaceArray(rhsVec, &rhsArray[i*nrowsLocal]);PYLITH_CHECK_ERROR(err);
+    err = VecPlaceArray(solnVec, &solnArray[i*nrowsLocal]);PYLITH_CHECK_ERROR(err);
+    err = KSPSolve(_ksp, rhsVec, solnVec); PYLITH_CHECK_ERROR(err);
+    err = VecResetArray(rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecResetArray(solnVec);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = MatDenseRestoreArray(_blockSoln, &solnArray);PYLITH_CHECK_ERROR(err);
+  err = MatDenseRestoreArray(_blockRHS, &rhsArray);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&solnVec);PYLITH_CHECK_ERROR(err);
+#endif
+
+  _logger->eventEnd(solveEvent);
+
+  PYLITH_METHOD_END;
+} // solveBlock
+
+// ----------------------------------------------------------------------
+// Get solution corresponding to right-hand side of block.
+void
+pylith::problems::SolverLinear::getBlockSolution(topology::Field* solution,
+						 const int index)
+{ // getBlockSolution
+  PYLITH_METHOD_BEGIN;
+
+  assert(solution);
+  assert(_blockSoln);
+  assert(_formulation);
+  assert(0 <= index && index < blockSize());
+
+  PetscErrorCode err = 0;
+  PetscInt nrowsLocal = 0;
+  err = MatGetLocalSize(_blockSoln, &nrowsLocal, NULL);PYLITH_CHECK_ERROR(err);
+
+  const PetscVec solutionVec = solution->globalVector();
+  PetscScalar* solutionArray = NULL;
+  PetscScalar* solnArray = NULL;
+  err = VecGetArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+  err = MatDenseGetArray(_blockSoln, &solnArray);PYLITH_CHECK_ERROR(err);
+  memcpy(solutionArray, &solnArray[index*nrowsLocal], nrowsLocal*sizeof(PetscScalar));
+  err = MatDenseRestoreArray(_blockSoln, &solnArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(solutionVec, &solutionArray);PYLITH_CHECK_ERROR(err);
+
+  const int scatterEvent = _logger->eventId("SoLi scatter");
+  _logger->eventBegin(scatterEvent);
+
+  // Update section view of field.
+  solution->scatterGlobalToLocal();
+
+  _logger->eventEnd(scatterEvent);
+
+  // Update rate fields to be consistent with current solution.
+  _formulation->calcRateFields();
+
+  PYLITH_METHOD_END;
+} // getBlockSolution
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -75,6 +75,47 @@ public :
 	     topology::Jacobian* jacobian,
 	     const topology::Field& residual);
 
+  /** Allocate storage for solving systems with multiple right-hand
+   * sides at once.
+   *
+   * @param solution Solution field (provides the layout).
+   * @param blockSize Number of right-hand sides in each block.
+   */
+  void createBlock(const topology::Field& solution,
+		   const int blockSize);
+
+  /** Get number of right-hand sides in each block.
+   *
+   * @returns Number of right-hand sides (0 if no block storage).
+   */
+  int blockSize(void) const;
+
+  /** Store residual as right-hand side of block.
+   *
+   * @param residual Residual field.
+   * @param index Index of right-hand side in block.
+   */
+  void setBlockRHS(const topology::Field& residual,
+		   const int index);
+
+  /** Solve the system for the first numRHS right-hand sides of the
+   * block. The preconditioner is setup once for all of the right-hand
+   * sides.
+   *
+   * @param jacobian Jacobian of the system.
+   * @param numRHS Number of right-hand sides that have been set.
+   */
+  void solveBlock(topology::Jacobian* jacobian,
+		  const int numRHS);
+
+  /** Get solution corresponding to right-hand side of block.
+   *
+   * @param solution Solution field.
+   * @param index Index of right-hand side in block.
+   */
+  void getBlockSolution(topology::Field* solution,
+			const int index);
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
@@ -85,6 +126,8 @@ private :
 private :
 
   PetscKSP _ksp; ///< PETSc KSP linear solver.
+  PetscMat _blockRHS; ///< Dense matrix with block of right-hand sides.
+  PetscMat _blockSoln; ///< Dense matrix with block of solutions.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -150,6 +150,14 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   const PetscVec solutionVec = solution->globalVector();
 
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+
+  // The last residual evaluation used the final iterate (the line
+  // search evaluates the residual at the accepted solution), so the
+  // trial state variables match the converged solution.
+  SNESConvergedReason reason;
+  err = SNESGetConvergedReason(_snes, &reason);PYLITH_CHECK_ERROR(err);
+  assert(_formulation);
+  _formulation->trialStateVarsCurrent(reason > 0);
   
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
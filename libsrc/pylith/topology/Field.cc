@@ -1369,9 +1369,9 @@ pylith::topology::Field::copySubfield(const Field& field,
 
   // Copy values from field
   PylithScalar* subfieldArray = NULL;
-  PylithScalar* fieldArray = NULL;
+  const PylithScalar* fieldArray = NULL;
   err = VecGetArray(this->_localVec, &subfieldArray);PYLITH_CHECK_ERROR(err);
-  err = VecGetArray(field._localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(field._localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
   for (PetscInt p = pStart; p < pEnd; ++p) {
     PetscInt fdof, foff, sdof, soff;
     
@@ -1386,7 +1386,7 @@ pylith::topology::Field::copySubfield(const Field& field,
       subfieldArray[soff+d] = fieldArray[foff+d];
     } // for
   } // for
-  err = VecRestoreArray(field._localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(field._localVec, &fieldArray);PYLITH_CHECK_ERROR(err);
   err = VecRestoreArray(this->_localVec, &subfieldArray);PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
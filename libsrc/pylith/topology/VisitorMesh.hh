@@ -49,11 +49,17 @@ public :
    * when the visitor is associated with a single subfield within a
    * field.
    *
+   * Use readOnly for fields that are only read through the visitor,
+   * so the state of the PETSc Vec is not increased and values
+   * derived from the field remain current.
+   *
    * @param field Field over a mesh.
    * @param subfield Name of subfield section to use instead of field section.
+   * @param readOnly True if values are not modified through the visitor.
    */
   VecVisitorMesh(const Field& field,
-		 const char* subfield =0);
+		 const char* subfield =0,
+		 const bool readOnly =false);
 
   /// Default destructor
   ~VecVisitorMesh(void);
@@ -66,9 +72,11 @@ public :
    *
    * @param field Field over a mesh/submesh.
    * @param subfield Name of subfield section to use instead of field section.
+   * @param readOnly True if values are not modified through the visitor.
    */
   void initialize(const Field& field,
-		  const char *subfield =0);
+		  const char *subfield =0,
+		  const bool readOnly =false);
 
   /// Clear cached data.
   void clear(void);
@@ -176,6 +184,7 @@ private :
   PetscVec _localVec; ///< Cached local PETSc Vec.
   PetscSection _section; ///< Cached PETSc section.
   PetscScalar* _localArray; ///< Cached local array
+  bool _readOnly; ///< Local array was obtained with read-only access.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
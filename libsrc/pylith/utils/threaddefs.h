@@ -0,0 +1,42 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/threaddefs.h
+ *
+ * @brief Macro definitions for threaded loops in PyLith.
+ *
+ * Loops over independent vertices run on multiple threads when
+ * PyLith is built with OpenMP and PETSc is thread safe. Detailed
+ * event logging is not thread safe, so define DETAILED_EVENT_LOGGING
+ * before including this file to keep the loops serial.
+ */
+
+#if !defined(pylith_utils_threaddefs_h)
+#define pylith_utils_threaddefs_h
+
+#include <petscconf.h> // USES PETSC_HAVE_THREADSAFETY
+
+#if defined(ENABLE_OPENMP) && defined(PETSC_HAVE_THREADSAFETY) && !defined(DETAILED_EVENT_LOGGING)
+#define THREADED_VERTEX_LOOPS
+#endif
+
+#endif // pylith_utils_threaddefs_h
+
+
+// End of file
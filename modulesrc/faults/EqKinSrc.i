@@ -86,6 +86,19 @@ namespace pylith {
        */
       const pylith::topology::Field& slipTime(void) const;
 
+      /** Get earliest time when slip begins at any local point.
+       *
+       * @returns Time when slip begins.
+       */
+      PylithScalar startTime(void) const;
+
+      /** Get time after which slip at all local points is equal to
+       * the final slip.
+       *
+       * @returns Time when slip is complete.
+       */
+      PylithScalar completionTime(void) const;
+
     }; // class EqKinSrc
 
   } // faults
@@ -71,6 +71,20 @@ namespace pylith {
                           int *firstLagrangeVertex,
                           int *firstFaultCell);
       %clear int *firstFaultVertex, int *firstLagrangeVertex, int *firstFaultCell;
+
+      /** Adjust mesh topology for several faults with a single split
+       * of the mesh.
+       *
+       * @param mesh PETSc mesh.
+       * @param faults Array of faults.
+       * @param numFaults Number of faults.
+       * @returns True if cohesive cells were created, false if faults
+       *   share points.
+       */
+      static
+      bool adjustTopologyBatch(pylith::topology::Mesh* const mesh,
+			       pylith::faults::FaultCohesive** faults,
+			       const int numFaults);
       
       /** Cohesive cells use Lagrange multiplier constraints?
        *
@@ -75,6 +75,34 @@ namespace pylith {
        */
       void openFreeSurf(const bool value);
 
+      /** Set flag for reusing the matrices and factorization used in
+       * the sensitivity problem.
+       *
+       * @param value True to reuse factorization, false otherwise.
+       */
+      void reuseSensitivityFactorization(const bool value);
+
+      /** Set margin below the friction strength for treating locked
+       * vertices as inactive. A value of 1.0 (default) disables the
+       * active set.
+       *
+       * @param value Margin as a fraction of the friction strength [0,1].
+       */
+      void activeSetMargin(const PylithScalar value);
+
+      /** Set flag for accumulating rupture metrics (rupture time, peak
+       * slip rate, and time of peak slip rate) at each fault vertex.
+       *
+       * @param value True to accumulate rupture metrics, false otherwise.
+       */
+      void ruptureMetrics(const bool value);
+
+      /** Set threshold for slip rate defining the rupture time.
+       *
+       * @param value Nondimensional slip rate (>= 0).
+       */
+      void ruptureSlipRateThreshold(const PylithScalar value);
+
       /** Initialize fault. Determine orientation and setup boundary
        * condition parameters.
        *
@@ -92,6 +92,66 @@ namespace pylith {
       void initialize(const pylith::topology::Mesh& mesh,
 		      const PylithScalar upDir[3]);
       
+      /** Set relative displacement field to the impulse associated
+       * with time t.
+       *
+       * @param t Current time (index of impulse).
+       */
+      void updateRelativeDisp(const PylithScalar t);
+
+      /** Get information about impulses.
+       *
+       * @param coordinates Array of coordinates of fault vertices [numImpulses*spaceDim].
+       * @param numCoordinates Size of array of coordinates.
+       * @param vertices Array of fault vertices [numImpulses], numbered
+       *   as in the fault output (global vertex numbering of fault mesh).
+       * @param numVertices Size of array of vertices.
+       * @param amplitudes Array of amplitudes [numImpulses].
+       * @param numAmplitudes Size of array of amplitudes.
+       * @param components Array of indices of impulse components [numImpulses].
+       * @param numComponents Size of array of components.
+       */
+      %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+	(PylithScalar* coordinates,
+	 const int numCoordinates),
+	(PylithScalar* amplitudes,
+	 const int numAmplitudes)
+	  };
+      %apply(int* INPLACE_ARRAY1, int DIM1) {
+	(int* vertices,
+	 const int numVertices),
+	(int* components,
+	 const int numComponents)
+	  };
+      void impulseInfo(PylithScalar* coordinates,
+		       const int numCoordinates,
+		       int* vertices,
+		       const int numVertices,
+		       PylithScalar* amplitudes,
+		       const int numAmplitudes,
+		       int* components,
+		       const int numComponents);
+      %clear(PylithScalar* coordinates, const int numCoordinates);
+      %clear(int* vertices, const int numVertices);
+      %clear(PylithScalar* amplitudes, const int numAmplitudes);
+      %clear(int* components, const int numComponents);
+
+      /** Get response to each impulse at an observation point from
+       * the solution of the adjoint problem.
+       *
+       * @param values Array of responses [numImpulses].
+       * @param numValues Size of array.
+       * @param solution Solution of adjoint problem.
+       */
+      %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+	(PylithScalar* values,
+	 const int numValues)
+	  };
+      void impulseResponses(PylithScalar* values,
+			    const int numValues,
+			    const pylith::topology::Field& solution);
+      %clear(PylithScalar* values, const int numValues);
+
       /** Integrate contributions to residual term (r) for operator that
        * do not require assembly across cells, vertices, or processors.
        *
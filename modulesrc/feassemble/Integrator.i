@@ -157,6 +157,15 @@ namespace pylith {
       void updateStateVars(const PylithScalar t,
 			   pylith::topology::SolutionFields* const fields);
 
+      /** Set whether state variables computed in the most recent residual
+       * evaluation correspond to the converged solution, so that
+       * updateStateVars() can use them without recomputing them.
+       *
+       * @param flag True if trial state variables are current, false otherwise.
+       */
+      virtual
+      void trialStateVarsCurrent(const bool flag);
+
       /** Verify configuration is acceptable.
        *
        * @param mesh Finite-element mesh
@@ -58,6 +58,20 @@ namespace pylith {
        * @param mesh Finite-element mesh.
        */
       void initialize(const pylith::topology::Mesh& mesh);
+
+      /** Set whether to keep the strain and stress at the quadrature
+       * points from the residual evaluation.
+       *
+       * @param flag True to keep strain and stress, false otherwise.
+       */
+      void reuseResidualStress(const bool flag);
+
+      /** Get whether to keep the strain and stress at the quadrature
+       * points from the residual evaluation.
+       *
+       * @returns True if keeping strain and stress, false otherwise.
+       */
+      bool reuseResidualStress(void) const;
       
       /** Update state variables as needed.
        *
@@ -87,6 +87,15 @@ namespace pylith {
        */
       void normalizer(const spatialdata::units::Nondimensional& dim);
 
+      /** Use a persistent cache for the fields initialized from the
+       * spatial databases.
+       *
+       * @param filename Root of filename for cache files.
+       * @param dbKey Digest of the contents of the spatial databases.
+       */
+      void parameterCache(const char* filename,
+			  const char* dbKey);
+
       /** Initialize friction model by getting physical property
        * parameters from database.
        *
@@ -110,6 +119,15 @@ namespace pylith {
        */
       bool hasPropStateVar(const char* name);
 
+      /** Check whether the friction strength at a vertex that is not
+       * slipping can only increase or stay the same over time.
+       *
+       * @returns True if strength of locked vertices is
+       * nondecreasing, false otherwise.
+       */
+      virtual
+      bool lockedStrengthNondecreasing(void) const;
+
       /** Get physical property or state variable field. Data is returned
        * via the argument.
        *
@@ -43,6 +43,13 @@ namespace pylith {
        */
       void linearSlipRate(const PylithScalar value);
 
+      /** Set flag for using fast approximations of log() and exp() in
+       * place of the standard library functions.
+       *
+       * @param value True to use fast approximations, false otherwise.
+       */
+      void fastMath(const bool value);
+
       // PROTECTED METHODS //////////////////////////////////////////////
     protected :
 
@@ -0,0 +1,58 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+// ----------------------------------------------------------------------
+// List of faults implemented with cohesive cells.
+%typemap(in) (pylith::faults::FaultCohesive** faults,
+	      const int numFaults)
+{
+  // Check to make sure input is a list.
+  if (PyList_Check($input)) {
+    const int size = PyList_Size($input);
+    $2 = size;
+    $1 = (size > 0) ? new pylith::faults::FaultCohesive*[size] : 0;
+    for (int i = 0; i < size; i++) {
+      PyObject* s = PyList_GetItem($input,i);
+      pylith::faults::FaultCohesive** fault = 0;
+      int err = SWIG_ConvertPtr(s, (void**) &fault, 
+				$descriptor(pylith::faults::FaultCohesive*),
+				0);
+      if (SWIG_IsOK(err))
+	$1[i] = (pylith::faults::FaultCohesive*) fault;
+      else {
+	PyErr_SetString(PyExc_TypeError, 
+			"List must contain faults with cohesive cells.");
+	delete[] $1;
+	return NULL;
+      } // if
+    } // for
+  } else {
+    PyErr_SetString(PyExc_TypeError,
+		    "Expected list of faults with cohesive cells.");
+    return NULL;
+  } // if/else
+} // typemap(in) [List of faults with cohesive cells.]
+
+// This cleans up the array we malloc'd before the function call
+%typemap(freearg) (pylith::faults::FaultCohesive** faults, 
+		   const int numFaults) {
+  delete[] $1;
+}
+
+
+// End of file
@@ -69,6 +69,38 @@ namespace pylith {
        */
       bool hasStateVars(void) const;
 
+      /** Set relative tolerance for changes in the state variables that
+       * trigger recomputing the stable time step for implicit time
+       * integration in a cell.
+       *
+       * A negative value (default) recomputes the stable time step in
+       * every cell for each query.
+       *
+       * @param value Relative tolerance.
+       */
+      void stableTimeStepTolerance(const PylithScalar value);
+
+      /** Get relative tolerance for changes in the state variables that
+       * trigger recomputing the stable time step for implicit time
+       * integration in a cell.
+       *
+       * @returns Relative tolerance.
+       */
+      PylithScalar stableTimeStepTolerance(void) const;
+
+      /** Set whether state variables are stored in two buffers (state
+       * at time t and trial state at time t+dt).
+       *
+       * @param flag True to use double buffering, false otherwise.
+       */
+      void doubleBufferStateVars(const bool flag);
+
+      /** Get whether state variables are stored in two buffers.
+       *
+       * @returns True if using double buffering, false otherwise.
+       */
+      bool doubleBufferStateVars(void) const;
+
       /** Get stable time step for implicit time integration.
        *
        * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
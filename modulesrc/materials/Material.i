@@ -109,6 +109,15 @@ namespace pylith {
        */
       void normalizer(const spatialdata::units::Nondimensional& dim);
       
+      /** Use a persistent cache for the fields initialized from the
+       * spatial databases.
+       *
+       * @param filename Root of filename for cache files.
+       * @param dbKey Digest of the contents of the spatial databases.
+       */
+      void parameterCache(const char* filename,
+			  const char* dbKey);
+
       /** Get size of stress/strain tensor associated with material.
        *
        * @returns Size of array holding stress/strain tensor.
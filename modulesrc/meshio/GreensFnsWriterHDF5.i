@@ -0,0 +1,162 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/GreensFnsWriterHDF5.i
+ *
+ * @brief Python interface to C++ GreensFnsWriterHDF5 object.
+ */
+
+namespace pylith {
+  namespace meshio {
+
+    class pylith::meshio::GreensFnsWriterHDF5
+    { // GreensFnsWriterHDF5
+      
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      GreensFnsWriterHDF5(void);
+      
+      /// Destructor
+      ~GreensFnsWriterHDF5(void);
+      
+      /** Set filename for HDF5 file.
+       *
+       * @param value Filename.
+       */
+      void filename(const char* value);
+      
+      /** Get filename for HDF5 file.
+       *
+       * @returns Filename.
+       */
+      const char* filename(void) const;
+      
+      /** Set level of gzip compression for responses.
+       *
+       * @param value Level of compression (0=none, 1-9).
+       */
+      void compression(const int value);
+      
+      /** Open file and create dataset for responses.
+       *
+       * @param numImpulses Number of impulses.
+       * @param numPoints Number of points.
+       * @param numComponents Number of components of response.
+       */
+      void open(const int numImpulses,
+		const int numPoints,
+		const int numComponents);
+      
+      /// Close file.
+      void close(void);
+      
+      /** Write coordinates and names of points.
+       *
+       * @param points Array of dimensioned coordinates of points [numPoints*spaceDim].
+       * @param numPoints Number of points.
+       * @param spaceDim Spatial dimension.
+       * @param names Array of names of points.
+       * @param numNames Number of names.
+       */
+      %apply(PylithScalar* IN_ARRAY2, int DIM1, int DIM2) {
+	(const PylithScalar* points,
+	 const int numPoints,
+	 const int spaceDim)
+	  };
+      %apply(const char* const* string_list, const int list_len){
+	(const char* const* names, const int numNames)
+	  };
+      void writePoints(const PylithScalar* points,
+		       const int numPoints,
+		       const int spaceDim,
+		       const char* const* names,
+		       const int numNames);
+      %clear(const PylithScalar* points, const int numPoints, const int spaceDim);
+      %clear(const char* const* names, const int numNames);
+      
+      /** Write information about impulses.
+       *
+       * @param coordinates Array of dimensioned coordinates of fault
+       *   vertices of impulses [numImpulses*spaceDim].
+       * @param numImpulses Number of impulses.
+       * @param spaceDim Spatial dimension.
+       * @param vertices Array of fault vertices of impulses, numbered as
+       *   in the fault output.
+       * @param numVertices Size of array of fault vertices.
+       * @param components Array of indices of components of impulses.
+       * @param numComponents Size of array of components.
+       * @param amplitudes Array of dimensioned amplitudes of impulses.
+       * @param numAmplitudes Size of array of amplitudes.
+       */
+      %apply(PylithScalar* IN_ARRAY2, int DIM1, int DIM2) {
+	(const PylithScalar* coordinates,
+	 const int numImpulses,
+	 const int spaceDim)
+	  };
+      %apply(int* IN_ARRAY1, int DIM1) {
+	(const int* vertices,
+	 const int numVertices),
+	(const int* components,
+	 const int numComponents)
+	  };
+      %apply(PylithScalar* IN_ARRAY1, int DIM1) {
+	(const PylithScalar* amplitudes,
+	 const int numAmplitudes)
+	  };
+      void writeImpulses(const PylithScalar* coordinates,
+			 const int numImpulses,
+			 const int spaceDim,
+			 const int* vertices,
+			 const int numVertices,
+			 const int* components,
+			 const int numComponents,
+			 const PylithScalar* amplitudes,
+			 const int numAmplitudes);
+      %clear(const PylithScalar* coordinates, const int numImpulses, const int spaceDim);
+      %clear(const int* vertices, const int numVertices);
+      %clear(const int* components, const int numComponents);
+      %clear(const PylithScalar* amplitudes, const int numAmplitudes);
+      
+      /** Write responses at points to an impulse.
+       *
+       * @param impulse Index of impulse.
+       * @param values Array of responses [numPoints*numComponents].
+       * @param numPoints Number of points.
+       * @param numComponents Number of components of response.
+       */
+      %apply(PylithScalar* IN_ARRAY2, int DIM1, int DIM2) {
+	(const PylithScalar* values,
+	 const int numPoints,
+	 const int numComponents)
+	  };
+      void writeResponse(const int impulse,
+			 const PylithScalar* values,
+			 const int numPoints,
+			 const int numComponents);
+      %clear(const PylithScalar* values, const int numPoints, const int numComponents);
+      
+    }; // class GreensFnsWriterHDF5
+    
+  } // meshio
+} // pylith
+
+
+// End of file 
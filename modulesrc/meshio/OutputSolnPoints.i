@@ -128,6 +128,34 @@ public :
      */
     void writePointNames(void);
     
+    /** Interpolate vertex field at all points and gather the values
+     * on all processes.
+     *
+     * @param values Array of values [numPoints*fiberDim].
+     * @param size Size of array.
+     * @param field Vertex field.
+     */
+    %apply(PylithScalar* INPLACE_ARRAY1, int DIM1) {
+	(PylithScalar* values,
+	 const int size)
+	    };
+    void gatherPointValues(PylithScalar* values,
+			   const int size,
+			   pylith::topology::Field& field);
+    %clear(PylithScalar* values, const int size);
+    
+    /** Add point force at a point to a vertex field.
+     *
+     * @param field Vertex field (e.g., residual).
+     * @param point Index of point in array of all points.
+     * @param component Index of component of force.
+     * @param value Magnitude of force.
+     */
+    void addPointForce(pylith::topology::Field* field,
+		       const int point,
+		       const int component,
+		       const PylithScalar value);
+    
 }; // OutputSolnPoints
 
   } // meshio
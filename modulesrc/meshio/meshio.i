@@ -40,6 +40,7 @@
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/GreensFnsWriterHDF5.hh"
 #endif
 
 #include "pylith/utils/arrayfwd.hh"
@@ -88,6 +89,7 @@ import_array();
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "GreensFnsWriterHDF5.i"
 #endif
 
 // End of file
@@ -66,6 +66,20 @@ namespace pylith {
        */
       bool useCustomConstraintPC(void) const;
 
+      /** Set flag for batching residual computation of faults with
+       * kinematic (prescribed) slip.
+       *
+       * @param flag True if batching faults, false otherwise.
+       */
+      void batchFaults(const bool flag);
+
+      /** Get flag for batching residual computation of faults with
+       * kinematic (prescribed) slip.
+       *
+       * @returns True if batching faults, false otherwise.
+       */
+      bool batchFaults(void) const;
+
       /** Get solution fields.
        *
        * @returns solution fields.
@@ -61,6 +61,46 @@ namespace pylith {
 		 pylith::topology::Jacobian* jacobian,
 		 const pylith::topology::Field& residual);
 
+      /** Allocate storage for solving systems with multiple right-hand
+       * sides at once.
+       *
+       * @param solution Solution field (provides the layout).
+       * @param blockSize Number of right-hand sides in each block.
+       */
+      void createBlock(const pylith::topology::Field& solution,
+		       const int blockSize);
+
+      /** Get number of right-hand sides in each block.
+       *
+       * @returns Number of right-hand sides (0 if no block storage).
+       */
+      int blockSize(void) const;
+
+      /** Store residual as right-hand side of block.
+       *
+       * @param residual Residual field.
+       * @param index Index of right-hand side in block.
+       */
+      void setBlockRHS(const pylith::topology::Field& residual,
+		       const int index);
+
+      /** Solve the system for the first numRHS right-hand sides of
+       * the block.
+       *
+       * @param jacobian Jacobian of the system.
+       * @param numRHS Number of right-hand sides that have been set.
+       */
+      void solveBlock(pylith::topology::Jacobian* jacobian,
+		      const int numRHS);
+
+      /** Get solution corresponding to right-hand side of block.
+       *
+       * @param solution Solution field.
+       * @param index Index of right-hand side in block.
+       */
+      void getBlockSolution(pylith::topology::Field* solution,
+			    const int index);
+
     }; // SolverLinear
 
   } // problems
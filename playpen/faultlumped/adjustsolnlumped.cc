@@ -0,0 +1,638 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file playpen/faultlumped/adjustsolnlumped.cc
+ *
+ * @brief Standalone microbenchmark comparing implementations of
+ * adjusting the solution on a fault with a lumped Jacobian
+ * (FaultCohesiveDyn::adjustSolnLumped()): the original per-vertex
+ * loop, the per-vertex loop specialized on the spatial dimension, and
+ * the gathered update.
+ *
+ * Usage: adjustsolnlumped [numVertices] [numSteps]
+ */
+
+#include <valarray> // USES std::valarray
+#include <vector> // USES std::vector
+#include <ctime> // USES clock()
+#include <cmath> // USES fabs(), sqrt()
+#include <cstdlib> // USES atoi()
+#include <algorithm> // USES std::max()
+#include <iostream> // USES std::cout
+
+typedef double PylithScalar;
+typedef std::valarray<PylithScalar> scalar_array;
+typedef std::valarray<int> int_array;
+
+// ----------------------------------------------------------------------
+// Synthetic fault with cohesive vertices scattered through the local
+// arrays of the domain fields.
+struct Fault {
+  int numVertices;
+  int spaceDim;
+
+  // Offsets of cohesive vertex points (domain fields and fault fields).
+  int_array offsetsN;
+  int_array offsetsP;
+  int_array offsetsL;
+  int_array offsetsLGlobal;
+  int_array offsetsFault;
+  int_array offsetsOrientation;
+  int_array offsetsArea;
+  std::vector<int> lagrange; ///< Lagrange point (< 0 if clamped).
+
+  // Fields over the domain.
+  scalar_array jacobian;
+  scalar_array residual;
+  scalar_array dispT;
+  scalar_array dispTIncr;
+  scalar_array dispTIncrAdj;
+
+  // Fields over the fault.
+  scalar_array dispRel;
+  scalar_array orientation;
+  scalar_array area;
+  scalar_array friction; ///< Coefficient of friction.
+
+  PylithScalar zeroTolerance;
+  PylithScalar zeroToleranceNormal;
+}; // Fault
+
+// ----------------------------------------------------------------------
+// Create fault with numVertices cohesive vertices in 3-D.
+void
+createFault(Fault* fault,
+	    const int numVertices)
+{ // createFault
+  const int spaceDim = 3;
+  fault->numVertices = numVertices;
+  fault->spaceDim = spaceDim;
+  fault->zeroTolerance = 1.0e-10;
+  fault->zeroToleranceNormal = 1.0e-10;
+
+  // Points in the domain are permuted so that the points of a
+  // cohesive vertex are not adjacent in the local arrays.
+  const int numPoints = 3*numVertices;
+  std::vector<int> perm(numPoints);
+  for (int i=0; i < numPoints; ++i)
+    perm[i] = i;
+  unsigned int seed = 12345;
+  for (int i=numPoints-1; i > 0; --i) {
+    seed = 1103515245*seed + 12345;
+    const int j = (seed >> 8) % (i+1);
+    const int tmp = perm[i]; perm[i] = perm[j]; perm[j] = tmp;
+  } // for
+
+  fault->offsetsN.resize(numVertices);
+  fault->offsetsP.resize(numVertices);
+  fault->offsetsL.resize(numVertices);
+  fault->offsetsLGlobal.resize(numVertices);
+  fault->offsetsFault.resize(numVertices);
+  fault->offsetsOrientation.resize(numVertices);
+  fault->offsetsArea.resize(numVertices);
+  fault->lagrange.resize(numVertices);
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    fault->offsetsN[iVertex] = perm[3*iVertex+0]*spaceDim;
+    fault->offsetsP[iVertex] = perm[3*iVertex+1]*spaceDim;
+    fault->offsetsL[iVertex] = perm[3*iVertex+2]*spaceDim;
+    fault->offsetsLGlobal[iVertex] = (iVertex % 50) ? fault->offsetsL[iVertex] : -1;
+    fault->offsetsFault[iVertex] = iVertex*spaceDim;
+    fault->offsetsOrientation[iVertex] = iVertex*spaceDim*spaceDim;
+    fault->offsetsArea[iVertex] = iVertex;
+    fault->lagrange[iVertex] = (iVertex % 1000) ? perm[3*iVertex+2] : -1;
+  } // for
+
+  const int domainSize = numPoints*spaceDim;
+  fault->jacobian.resize(domainSize);
+  fault->residual.resize(domainSize);
+  fault->dispT.resize(domainSize);
+  fault->dispTIncr.resize(domainSize);
+  fault->dispTIncrAdj.resize(domainSize);
+  fault->dispRel.resize(numVertices*spaceDim);
+  fault->orientation.resize(numVertices*spaceDim*spaceDim);
+  fault->area.resize(numVertices);
+  fault->friction.resize(numVertices);
+
+  for (int i=0; i < domainSize; ++i) {
+    fault->jacobian[i] = 2.0 + 0.5*sin(0.1*i);
+    fault->residual[i] = 0.3*cos(0.07*i);
+    fault->dispTIncr[i] = 0.01*sin(0.03*i);
+    fault->dispT[i] = 0.0;
+  } // for
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    // Initial tractions: compression with shear near the friction
+    // strength so vertices are a mix of stuck, sliding, and open.
+    const int loff = fault->offsetsL[iVertex];
+    const PylithScalar phase = 0.001*iVertex;
+    fault->dispT[loff+0] = 0.6*cos(phase);
+    fault->dispT[loff+1] = 0.6*sin(phase);
+    fault->dispT[loff+2] = (iVertex % 97) ? -1.0 : +0.2;
+
+    fault->area[iVertex] = 1.0 + 0.1*sin(0.5*iVertex);
+    fault->friction[iVertex] = 0.6;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      fault->dispRel[iVertex*spaceDim+iDim] = (iDim < 2) ? 0.1*sin(phase+iDim) : 0.0;
+    } // for
+
+    // Orientation: rotation about the normal (rows are fault directions).
+    const PylithScalar c = cos(0.3*phase);
+    const PylithScalar s = sin(0.3*phase);
+    PylithScalar* R = &fault->orientation[iVertex*9];
+    R[0] = c;   R[1] = s;   R[2] = 0.0;
+    R[3] = -s;  R[4] = c;   R[5] = 0.0;
+    R[6] = 0.0; R[7] = 0.0; R[8] = 1.0;
+  } // for
+} // createFault
+
+// ----------------------------------------------------------------------
+// Static friction.
+inline
+PylithScalar
+calcFriction(const PylithScalar tractionNormal,
+	     const PylithScalar* props)
+{ // calcFriction
+  return (tractionNormal <= 0.0) ? -props[0]*tractionNormal : 0.0;
+} // calcFriction
+
+// ----------------------------------------------------------------------
+// Friction criterion in 3-D (non-iterating path of
+// FaultCohesiveDyn::_constrainSolnSpace3D(); Newton update is a no-op
+// for static friction).
+inline
+void
+constrain3D(PylithScalar* dTractionTpdt,
+	    const PylithScalar* slip,
+	    const PylithScalar* tractionTpdt,
+	    const PylithScalar* props,
+	    const PylithScalar zeroTolerance,
+	    const PylithScalar zeroToleranceNormal)
+{ // constrain3D
+  const PylithScalar tractionNormal = tractionTpdt[2];
+  const PylithScalar tractionShearMag = sqrt(tractionTpdt[0]*tractionTpdt[0] + tractionTpdt[1]*tractionTpdt[1]);
+  if (fabs(slip[2]) < zeroToleranceNormal && tractionNormal < -zeroTolerance) {
+    const PylithScalar frictionStress = calcFriction(tractionNormal, props);
+    if (tractionShearMag > frictionStress && tractionShearMag > 0.0) {
+      dTractionTpdt[0] = -(tractionShearMag - frictionStress) * tractionTpdt[0] / tractionShearMag;
+      dTractionTpdt[1] = -(tractionShearMag - frictionStress) * tractionTpdt[1] / tractionShearMag;
+    } // if
+  } else {
+    dTractionTpdt[0] = -tractionTpdt[0];
+    dTractionTpdt[1] = -tractionTpdt[1];
+    dTractionTpdt[2] = -tractionTpdt[2];
+  } // if/else
+} // constrain3D
+
+// ----------------------------------------------------------------------
+// Friction criterion with the interface of the previous
+// implementation (valarray arguments, called through a member
+// function pointer).
+class FrictionPerVertex {
+public :
+  FrictionPerVertex(const Fault& fault) : _fault(fault) {}
+
+  void constrain3D(scalar_array* dTractionTpdt,
+		   const scalar_array& slip,
+		   const scalar_array& tractionTpdt,
+		   const PylithScalar* props)
+  { ::constrain3D(&(*dTractionTpdt)[0], &slip[0], &tractionTpdt[0], props, _fault.zeroTolerance, _fault.zeroToleranceNormal); }
+
+private :
+  const Fault& _fault;
+}; // FrictionPerVertex
+
+// ----------------------------------------------------------------------
+// Original implementation: one loop over the vertices with runtime
+// spatial dimension.
+void
+adjustPerVertex(Fault* fault)
+{ // adjustPerVertex
+  typedef void (FrictionPerVertex::*constrain_fn_type)
+    (scalar_array*, const scalar_array&, const scalar_array&, const PylithScalar*);
+
+  const int spaceDim = fault->spaceDim;
+  FrictionPerVertex friction(*fault);
+  constrain_fn_type constrainFn = &FrictionPerVertex::constrain3D;
+
+  scalar_array tractionTpdtVertex(spaceDim);
+  scalar_array dTractionTpdtVertex(spaceDim);
+  scalar_array dLagrangeTpdtVertex(spaceDim);
+  scalar_array slipVertex(spaceDim);
+  scalar_array dispIncrVertexN(spaceDim);
+  scalar_array dispIncrVertexP(spaceDim);
+  scalar_array lagrangeTIncrVertex(spaceDim);
+
+  const PylithScalar* jacobianArray = &fault->jacobian[0];
+  const PylithScalar* residualArray = &fault->residual[0];
+  const PylithScalar* dispTArray = &fault->dispT[0];
+  PylithScalar* dispTIncrArray = &fault->dispTIncr[0];
+  PylithScalar* dispTIncrAdjArray = &fault->dispTIncrAdj[0];
+  const PylithScalar* dispRelArray = &fault->dispRel[0];
+  const PylithScalar* orientationArray = &fault->orientation[0];
+  const PylithScalar* areaArray = &fault->area[0];
+
+  const int numVertices = fault->numVertices;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    if (fault->lagrange[iVertex] < 0) {
+      continue;
+    } // if
+    const int noff = fault->offsetsN[iVertex];
+    const int poff = fault->offsetsP[iVertex];
+    const int loff = fault->offsetsL[iVertex];
+    const int droff = fault->offsetsFault[iVertex];
+    const int ooff = fault->offsetsOrientation[iVertex];
+    const PylithScalar areaVertex = areaArray[fault->offsetsArea[iVertex]];
+
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const PylithScalar S = (1.0/jacobianArray[poff+iDim] + 1.0/jacobianArray[noff+iDim]) * areaVertex*areaVertex;
+      lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[loff+iDim] + areaVertex * (dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim]));
+      dispIncrVertexN[iDim] =  areaVertex / jacobianArray[noff+iDim]*lagrangeTIncrVertex[iDim];
+      dispIncrVertexP[iDim] = -areaVertex / jacobianArray[poff+iDim]*lagrangeTIncrVertex[iDim];
+    } // for
+
+    slipVertex = 0.0;
+    tractionTpdtVertex = 0.0;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      for (int jDim=0; jDim < spaceDim; ++jDim) {
+	slipVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * dispRelArray[droff+jDim];
+	tractionTpdtVertex[iDim] += orientationArray[ooff+iDim*spaceDim+jDim] * (dispTArray[loff+jDim] + lagrangeTIncrVertex[jDim]);
+      } // for
+    } // for
+
+    dTractionTpdtVertex = 0.0;
+    (friction.*constrainFn)(&dTractionTpdtVertex, slipVertex, tractionTpdtVertex, &fault->friction[iVertex]);
+
+    dLagrangeTpdtVertex = 0.0;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      for (int jDim=0; jDim < spaceDim; ++jDim) {
+	dLagrangeTpdtVertex[iDim] += orientationArray[ooff+jDim*spaceDim+iDim] * dTractionTpdtVertex[jDim];
+      } // for
+    } // for
+
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[noff+iDim];
+      dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[poff+iDim];
+      lagrangeTIncrVertex[iDim] += dLagrangeTpdtVertex[iDim];
+    } // for
+
+    if (fault->offsetsLGlobal[iVertex] >= 0) {
+      for (int d=0; d < spaceDim; ++d) {
+	dispTIncrAdjArray[noff+d] += dispIncrVertexN[d];
+	dispTIncrAdjArray[poff+d] += dispIncrVertexP[d];
+      } // for
+    } // if
+    for (int d=0; d < spaceDim; ++d) {
+      dispTIncrArray[loff+d] = lagrangeTIncrVertex[d];
+    } // for
+  } // for
+} // adjustPerVertex
+
+// ----------------------------------------------------------------------
+// Buffers for gathered implementation.
+struct LumpedBuffers {
+  int_array index;
+  scalar_array area;
+  scalar_array jacobianN;
+  scalar_array jacobianP;
+  scalar_array residualL;
+  scalar_array dispIncrRel;
+  scalar_array lagrangeT;
+  scalar_array dispRel;
+  scalar_array orientation;
+  scalar_array lagrangeTIncr;
+  scalar_array slip;
+  scalar_array tractionTpdt;
+  scalar_array dTractionTpdt;
+}; // LumpedBuffers
+
+template<int dim>
+inline
+void
+rotateToFault(PylithScalar* valuesFault,
+	      const PylithScalar* orientation,
+	      const PylithScalar* valuesGlobal)
+{ // rotateToFault
+  for (int iDim=0; iDim < dim; ++iDim) {
+    valuesFault[iDim] = 0.0;
+    for (int jDim=0; jDim < dim; ++jDim) {
+      valuesFault[iDim] += orientation[iDim*dim+jDim] * valuesGlobal[jDim];
+    } // for
+  } // for
+} // rotateToFault
+
+template<int dim>
+inline
+void
+rotateToGlobal(PylithScalar* valuesGlobal,
+	       const PylithScalar* orientation,
+	       const PylithScalar* valuesFault)
+{ // rotateToGlobal
+  for (int iDim=0; iDim < dim; ++iDim) {
+    valuesGlobal[iDim] = 0.0;
+    for (int jDim=0; jDim < dim; ++jDim) {
+      valuesGlobal[iDim] += orientation[jDim*dim+iDim] * valuesFault[jDim];
+    } // for
+  } // for
+} // rotateToGlobal
+
+// ----------------------------------------------------------------------
+// Implementation specialized on the spatial dimension: one loop over
+// the vertices with fixed-size work arrays and the friction criterion
+// selected at compile time.
+template<int dim>
+void
+adjustTemplated(Fault* fault)
+{ // adjustTemplated
+  const int spaceDim = dim;
+
+  const PylithScalar* jacobianArray = &fault->jacobian[0];
+  const PylithScalar* residualArray = &fault->residual[0];
+  const PylithScalar* dispTArray = &fault->dispT[0];
+  PylithScalar* dispTIncrArray = &fault->dispTIncr[0];
+  PylithScalar* dispTIncrAdjArray = &fault->dispTIncrAdj[0];
+  const PylithScalar* dispRelArray = &fault->dispRel[0];
+  const PylithScalar* orientationArray = &fault->orientation[0];
+  const PylithScalar* areaArray = &fault->area[0];
+
+  const int numVertices = fault->numVertices;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    PylithScalar slipVertex[dim];
+    PylithScalar tractionTpdtVertex[dim];
+    PylithScalar dTractionTpdtVertex[dim];
+    PylithScalar dLagrangeTpdtVertex[dim];
+    PylithScalar dispIncrVertexN[dim];
+    PylithScalar dispIncrVertexP[dim];
+    PylithScalar lagrangeTIncrVertex[dim];
+
+    if (fault->lagrange[iVertex] < 0) {
+      continue;
+    } // if
+    const int noff = fault->offsetsN[iVertex];
+    const int poff = fault->offsetsP[iVertex];
+    const int loff = fault->offsetsL[iVertex];
+    const int droff = fault->offsetsFault[iVertex];
+    const int ooff = fault->offsetsOrientation[iVertex];
+    const PylithScalar areaVertex = areaArray[fault->offsetsArea[iVertex]];
+
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const PylithScalar S = (1.0/jacobianArray[poff+iDim] + 1.0/jacobianArray[noff+iDim]) * areaVertex*areaVertex;
+      lagrangeTIncrVertex[iDim] = 1.0/S * (-residualArray[loff+iDim] + areaVertex * (dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim]));
+      dispIncrVertexN[iDim] =  areaVertex / jacobianArray[noff+iDim]*lagrangeTIncrVertex[iDim];
+      dispIncrVertexP[iDim] = -areaVertex / jacobianArray[poff+iDim]*lagrangeTIncrVertex[iDim];
+    } // for
+
+    PylithScalar tractionGlobal[dim];
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      tractionGlobal[iDim] = dispTArray[loff+iDim] + lagrangeTIncrVertex[iDim];
+    } // for
+    rotateToFault<dim>(slipVertex, &orientationArray[ooff], &dispRelArray[droff]);
+    rotateToFault<dim>(tractionTpdtVertex, &orientationArray[ooff], tractionGlobal);
+
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      dTractionTpdtVertex[iDim] = 0.0;
+    } // for
+    constrain3D(dTractionTpdtVertex, slipVertex, tractionTpdtVertex, &fault->friction[iVertex],
+		fault->zeroTolerance, fault->zeroToleranceNormal);
+
+    rotateToGlobal<dim>(dLagrangeTpdtVertex, &orientationArray[ooff], dTractionTpdtVertex);
+
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      dispIncrVertexN[iDim] += areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[noff+iDim];
+      dispIncrVertexP[iDim] -= areaVertex * dLagrangeTpdtVertex[iDim] / jacobianArray[poff+iDim];
+      lagrangeTIncrVertex[iDim] += dLagrangeTpdtVertex[iDim];
+    } // for
+
+    if (fault->offsetsLGlobal[iVertex] >= 0) {
+      for (int d=0; d < spaceDim; ++d) {
+	dispTIncrAdjArray[noff+d] += dispIncrVertexN[d];
+	dispTIncrAdjArray[poff+d] += dispIncrVertexP[d];
+      } // for
+    } // if
+    for (int d=0; d < spaceDim; ++d) {
+      dispTIncrArray[loff+d] = lagrangeTIncrVertex[d];
+    } // for
+  } // for
+} // adjustTemplated
+
+// ----------------------------------------------------------------------
+// Current implementation: gather, passes over contiguous arrays, scatter.
+template<int dim>
+void
+adjustGathered(Fault* fault,
+	       LumpedBuffers* buffers)
+{ // adjustGathered
+  const int spaceDim = dim;
+  const int orientationSize = dim*dim;
+
+  const PylithScalar* jacobianArray = &fault->jacobian[0];
+  const PylithScalar* residualArray = &fault->residual[0];
+  const PylithScalar* dispTArray = &fault->dispT[0];
+  PylithScalar* dispTIncrArray = &fault->dispTIncr[0];
+  PylithScalar* dispTIncrAdjArray = &fault->dispTIncrAdj[0];
+  const PylithScalar* dispRelArray = &fault->dispRel[0];
+  const PylithScalar* orientationArray = &fault->orientation[0];
+  const PylithScalar* areaArray = &fault->area[0];
+
+  const int numVertices = fault->numVertices;
+  int numBatch = 0;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    if (fault->lagrange[iVertex] >= 0) {
+      ++numBatch;
+    } // if
+  } // for
+  if (buffers->index.size() != size_t(numBatch)) {
+    buffers->index.resize(numBatch);
+    buffers->area.resize(numBatch);
+    buffers->jacobianN.resize(numBatch*spaceDim);
+    buffers->jacobianP.resize(numBatch*spaceDim);
+    buffers->residualL.resize(numBatch*spaceDim);
+    buffers->dispIncrRel.resize(numBatch*spaceDim);
+    buffers->lagrangeT.resize(numBatch*spaceDim);
+    buffers->dispRel.resize(numBatch*spaceDim);
+    buffers->orientation.resize(numBatch*orientationSize);
+    buffers->lagrangeTIncr.resize(numBatch*spaceDim);
+    buffers->slip.resize(numBatch*spaceDim);
+    buffers->tractionTpdt.resize(numBatch*spaceDim);
+    buffers->dTractionTpdt.resize(numBatch*spaceDim);
+  } // if
+  if (0 == numBatch) {
+    return;
+  } // if
+
+  int* batchIndex = &buffers->index[0];
+  PylithScalar* batchArea = &buffers->area[0];
+  PylithScalar* batchJacobianN = &buffers->jacobianN[0];
+  PylithScalar* batchJacobianP = &buffers->jacobianP[0];
+  PylithScalar* batchResidualL = &buffers->residualL[0];
+  PylithScalar* batchDispIncrRel = &buffers->dispIncrRel[0];
+  PylithScalar* batchLagrangeT = &buffers->lagrangeT[0];
+  PylithScalar* batchDispRel = &buffers->dispRel[0];
+  PylithScalar* batchOrientation = &buffers->orientation[0];
+  PylithScalar* batchLagrangeTIncr = &buffers->lagrangeTIncr[0];
+  PylithScalar* batchSlip = &buffers->slip[0];
+  PylithScalar* batchTractionTpdt = &buffers->tractionTpdt[0];
+  PylithScalar* batchDTractionTpdt = &buffers->dTractionTpdt[0];
+
+  // Gather.
+  int iGather = 0;
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    if (fault->lagrange[iVertex] < 0) {
+      continue;
+    } // if
+    const int noff = fault->offsetsN[iVertex];
+    const int poff = fault->offsetsP[iVertex];
+    const int loff = fault->offsetsL[iVertex];
+    const int droff = fault->offsetsFault[iVertex];
+    const int ooff = fault->offsetsOrientation[iVertex];
+
+    batchIndex[iGather] = iVertex;
+    batchArea[iGather] = areaArray[fault->offsetsArea[iVertex]];
+    const int voff = iGather*spaceDim;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      batchJacobianN[voff+iDim] = jacobianArray[noff+iDim];
+      batchJacobianP[voff+iDim] = jacobianArray[poff+iDim];
+      batchResidualL[voff+iDim] = residualArray[loff+iDim];
+      batchDispIncrRel[voff+iDim] = dispTIncrArray[poff+iDim] - dispTIncrArray[noff+iDim];
+      batchLagrangeT[voff+iDim] = dispTArray[loff+iDim];
+      batchDispRel[voff+iDim] = dispRelArray[droff+iDim];
+    } // for
+    for (int i=0; i < orientationSize; ++i) {
+      batchOrientation[iGather*orientationSize+i] = orientationArray[ooff+i];
+    } // for
+    ++iGather;
+  } // for
+
+  // Stuck solution, slip, and traction.
+  for (int iBatch=0; iBatch < numBatch; ++iBatch) {
+    const int voff = iBatch*spaceDim;
+    const PylithScalar areaVertex = batchArea[iBatch];
+    PylithScalar tractionGlobal[dim];
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const PylithScalar S = (1.0/batchJacobianP[voff+iDim] + 1.0/batchJacobianN[voff+iDim]) * areaVertex*areaVertex;
+      batchLagrangeTIncr[voff+iDim] = 1.0/S * (-batchResidualL[voff+iDim] + areaVertex * batchDispIncrRel[voff+iDim]);
+      tractionGlobal[iDim] = batchLagrangeT[voff+iDim] + batchLagrangeTIncr[voff+iDim];
+    } // for
+    rotateToFault<dim>(&batchSlip[voff], &batchOrientation[iBatch*orientationSize], &batchDispRel[voff]);
+    rotateToFault<dim>(&batchTractionTpdt[voff], &batchOrientation[iBatch*orientationSize], tractionGlobal);
+  } // for
+
+  // Friction.
+  for (int iBatch=0; iBatch < numBatch; ++iBatch) {
+    const int voff = iBatch*spaceDim;
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      batchDTractionTpdt[voff+iDim] = 0.0;
+    } // for
+    constrain3D(&batchDTractionTpdt[voff], &batchSlip[voff], &batchTractionTpdt[voff], &fault->friction[batchIndex[iBatch]],
+		fault->zeroTolerance, fault->zeroToleranceNormal);
+  } // for
+
+  // Rotate change in traction and update Lagrange multipliers.
+  for (int iBatch=0; iBatch < numBatch; ++iBatch) {
+    const int voff = iBatch*spaceDim;
+    PylithScalar dLagrangeTpdtVertex[dim];
+    rotateToGlobal<dim>(dLagrangeTpdtVertex, &batchOrientation[iBatch*orientationSize], &batchDTractionTpdt[voff]);
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      batchLagrangeTIncr[voff+iDim] += dLagrangeTpdtVertex[iDim];
+    } // for
+  } // for
+
+  // Scatter.
+  for (int iBatch=0; iBatch < numBatch; ++iBatch) {
+    const int iVertex = batchIndex[iBatch];
+    const int voff = iBatch*spaceDim;
+    const int noff = fault->offsetsN[iVertex];
+    const int poff = fault->offsetsP[iVertex];
+    const int loff = fault->offsetsL[iVertex];
+    const PylithScalar areaVertex = batchArea[iBatch];
+    if (fault->offsetsLGlobal[iVertex] >= 0) {
+      for (int d=0; d < spaceDim; ++d) {
+	dispTIncrAdjArray[noff+d] +=  areaVertex / batchJacobianN[voff+d] * batchLagrangeTIncr[voff+d];
+	dispTIncrAdjArray[poff+d] += -areaVertex / batchJacobianP[voff+d] * batchLagrangeTIncr[voff+d];
+      } // for
+    } // if
+    for (int d=0; d < spaceDim; ++d) {
+      dispTIncrArray[loff+d] = batchLagrangeTIncr[voff+d];
+    } // for
+  } // for
+} // adjustGathered
+
+// ----------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[])
+{ // main
+  const int numVertices = (argc > 1) ? atoi(argv[1]) : 1000000;
+  const int numSteps = (argc > 2) ? atoi(argv[2]) : 20;
+
+  Fault faultA;
+  createFault(&faultA, numVertices);
+  Fault faultB;
+  createFault(&faultB, numVertices);
+  Fault faultC;
+  createFault(&faultC, numVertices);
+  const scalar_array dispTIncr0 = faultA.dispTIncr;
+
+  // Each step starts from the same increment in the solution (as it
+  // would after the solve with the lumped Jacobian) and accumulates
+  // the adjustment.
+  faultA.dispTIncrAdj = 0.0;
+  clock_t start = clock();
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    faultA.dispTIncr = dispTIncr0;
+    adjustPerVertex(&faultA);
+  } // for
+  const double timePerVertex = double(clock() - start) / CLOCKS_PER_SEC;
+
+  faultB.dispTIncrAdj = 0.0;
+  start = clock();
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    faultB.dispTIncr = dispTIncr0;
+    adjustTemplated<3>(&faultB);
+  } // for
+  const double timeTemplated = double(clock() - start) / CLOCKS_PER_SEC;
+
+  LumpedBuffers buffers;
+  faultC.dispTIncrAdj = 0.0;
+  start = clock();
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    faultC.dispTIncr = dispTIncr0;
+    adjustGathered<3>(&faultC, &buffers);
+  } // for
+  const double timeGathered = double(clock() - start) / CLOCKS_PER_SEC;
+
+  PylithScalar maxDiffTemplated = 0.0;
+  PylithScalar maxDiffGathered = 0.0;
+  for (size_t i=0; i < faultA.dispTIncr.size(); ++i) {
+    maxDiffTemplated = std::max(maxDiffTemplated, fabs(faultA.dispTIncr[i] - faultB.dispTIncr[i]));
+    maxDiffTemplated = std::max(maxDiffTemplated, fabs(faultA.dispTIncrAdj[i] - faultB.dispTIncrAdj[i]));
+    maxDiffGathered = std::max(maxDiffGathered, fabs(faultB.dispTIncr[i] - faultC.dispTIncr[i]));
+    maxDiffGathered = std::max(maxDiffGathered, fabs(faultB.dispTIncrAdj[i] - faultC.dispTIncrAdj[i]));
+  } // for
+
+  std::cout << "Vertices: " << numVertices << ", steps: " << numSteps << "\n"
+	    << "pervertex: " << numSteps/timePerVertex << " steps/s\n"
+	    << "templated: " << numSteps/timeTemplated << " steps/s\n"
+	    << "gathered:  " << numSteps/timeGathered << " steps/s\n"
+	    << "speedup of gathered over templated: " << timeTemplated/timeGathered << "\n"
+	    << "max difference (templated vs pervertex): " << maxDiffTemplated << "\n"
+	    << "max difference (gathered vs templated): " << maxDiffGathered << std::endl;
+
+  return 0;
+} // main
+
+
+// End of file
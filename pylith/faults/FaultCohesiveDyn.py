@@ -47,6 +47,16 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   @li \b open_free_surface If True, enforce traction free surface when
     the fault opens, otherwise use initial tractions even when the
     fault opens.
+  @li \b reuse_sensitivity_factorization If True, keep the matrices
+    and factorization of the sensitivity problem until the Jacobian
+    changes.
+  @li \b active_set_margin Margin below the friction strength (as a
+    fraction of the strength) for skipping the friction evaluation at
+    locked vertices (default of 1.0 disables the active set).
+  @li \b rupture_metrics If True, accumulate rupture time, peak slip
+    rate, and time of peak slip rate at each vertex and rewrite the
+    info file with these fields at the end of the simulation.
+  @li \b rupture_slip_rate_threshold Slip rate defining rupture time.
   
   \b Facilities
   @li \b tract_perturbation Prescribed perturbation in fault tractions.
@@ -71,6 +81,25 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     "the fault opens, otherwise use initial tractions even when the " \
     "fault opens."
 
+  reuseSensitivityFactorization = pyre.inventory.bool("reuse_sensitivity_factorization", default=False)
+  reuseSensitivityFactorization.meta['tip'] = "If True, keep the matrices " \
+    "and factorization of the sensitivity problem until the Jacobian changes."
+
+  activeSetMargin = pyre.inventory.float("active_set_margin", default=1.0, validator=pyre.inventory.range(0.0, 1.0))
+  activeSetMargin.meta['tip'] = "Margin below the friction strength " \
+    "(fraction of strength) for skipping the friction evaluation at " \
+    "locked vertices (default of 1.0 disables the active set)."
+
+  ruptureMetrics = pyre.inventory.bool("rupture_metrics", default=False)
+  ruptureMetrics.meta['tip'] = "If True, accumulate rupture time, peak " \
+    "slip rate, and time of peak slip rate at each vertex and rewrite the " \
+    "info file with these fields at the end of the simulation."
+
+  from pyre.units.length import m
+  from pyre.units.time import s
+  ruptureSlipRateThreshold = pyre.inventory.dimensional("rupture_slip_rate_threshold", default=1.0e-3*m/s)
+  ruptureSlipRateThreshold.meta['tip'] = "Slip rate defining rupture time."
+
   tract = pyre.inventory.facility("traction_perturbation", family="traction_perturbation", factory=NullComponent)
   tract.meta['tip'] = "Prescribed perturbation in fault tractions."
 
@@ -128,6 +157,14 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
       self.tract.preinitialize(mesh)
       self.availableFields['vertex']['info'] += self.tract.availableFields['vertex']['info']
 
+    if self.inventory.ruptureMetrics:
+      metrics = ["rupture_time",
+                 "peak_slip_rate",
+                 "peak_slip_rate_time",
+                 "final_slip"]
+      self.availableFields['vertex']['info'] += metrics
+      self.availableFields['vertex']['data'] += metrics
+
     self.availableFields['vertex']['info'] += \
         self.friction.availableFields['vertex']['info']
     self.availableFields['vertex']['data'] += \
@@ -163,6 +200,10 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     if 0 == comm.rank:
       self._info.log("Initializing fault '%s'." % self.label())
 
+    velocityScale = normalizer.lengthScale() / normalizer.timeScale()
+    thresholdN = normalizer.nondimensionalize(self.inventory.ruptureSlipRateThreshold, velocityScale)
+    ModuleFaultCohesiveDyn.ruptureSlipRateThreshold(self, thresholdN)
+
     Integrator.initialize(self, totalTime, numTimeSteps, normalizer)    
     FaultCohesive.initialize(self, totalTime, numTimeSteps, normalizer)
 
@@ -199,6 +240,9 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     FaultCohesive.finalize(self)
     Integrator.finalize(self)
     self.output.close()
+    if self.inventory.ruptureMetrics:
+      # Info fields now include the final values of the rupture metrics.
+      self.output.writeInfo()
     self.output.finalize()
     return
   
@@ -213,9 +257,13 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     if not isinstance(self.inventory.tract, NullComponent):
       ModuleFaultCohesiveDyn.tractPerturbation(self, self.inventory.tract)
     ModuleFaultCohesiveDyn.frictionModel(self, self.inventory.friction)
+    self.inventory.friction.setupParameterCache(self.inventory.faultLabel)
     ModuleFaultCohesiveDyn.zeroTolerance(self, self.inventory.zeroTolerance)
     ModuleFaultCohesiveDyn.zeroToleranceNormal(self, self.inventory.zeroToleranceNormal)
     ModuleFaultCohesiveDyn.openFreeSurf(self, self.inventory.openFreeSurf)
+    ModuleFaultCohesiveDyn.reuseSensitivityFactorization(self, self.inventory.reuseSensitivityFactorization)
+    ModuleFaultCohesiveDyn.activeSetMargin(self, self.inventory.activeSetMargin)
+    ModuleFaultCohesiveDyn.ruptureMetrics(self, self.inventory.ruptureMetrics)
     self.output = self.inventory.output
     return
 
@@ -66,6 +66,7 @@ class IntegratorElasticity(Integrator):
     # Set integrator's quadrature using quadrature from material
     self.quadrature(material.quadrature)
     self.material(material)
+    self.reuseResidualStress(material.reuseResidualStress)
     return
 
 
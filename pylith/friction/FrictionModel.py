@@ -66,6 +66,8 @@ class FrictionModel(PetscComponent):
     ##
     ## \b Properties
     ## @li \b name Name of friction model.
+    ## @li \b use_parameter_cache Cache initialized parameter fields for reuse.
+    ## @li \b parameter_cache_filename Root of filename for parameter cache.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -76,6 +78,12 @@ class FrictionModel(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for friction model."
 
+    useParameterCache = pyre.inventory.bool("use_parameter_cache", default=False)
+    useParameterCache.meta['tip'] = "Cache fields initialized from spatial databases in HDF5 files and reuse them in later runs with the same mesh and databases."
+
+    parameterCacheFilename = pyre.inventory.str("parameter_cache_filename", default="")
+    parameterCacheFilename.meta['tip'] = "Root of filename for parameter cache (default is 'parameter_cache/CLASS_FAULT_LABEL')."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -105,6 +113,17 @@ class FrictionModel(PetscComponent):
     return
 
 
+  def setupParameterCache(self, faultLabel):
+    """
+    Setup persistent cache of initialized parameter fields if requested.
+
+    @param faultLabel Label of fault using the friction model.
+    """
+    if self.inventory.useParameterCache:
+      self._setupParameterCache(faultLabel)
+    return
+
+
   def finalize(self):
     """
     Cleanup.
@@ -143,6 +162,36 @@ class FrictionModel(PetscComponent):
           "Please implement _createModuleOb() in derived class."
 
 
+  def _setupParameterCache(self, faultLabel):
+    """
+    Setup persistent cache of initialized parameter fields.
+    """
+    import os
+    filename = self.inventory.parameterCacheFilename
+    if 0 == len(filename):
+      # Friction models on different faults often have the same
+      # label, so the default filename includes the fault label.
+      filename = os.path.join("parameter_cache", "%s_%s_%s" % \
+                                (self.__class__.__name__,
+                                 faultLabel.replace(" ", "_"),
+                                 self.inventory.label.replace(" ", "_")))
+    relpath = os.path.dirname(filename)
+    if len(relpath) > 0 and not os.path.exists(relpath):
+      try:
+        os.makedirs(relpath)
+      except OSError:
+        if not os.path.isdir(relpath):
+          raise
+
+    from pylith.utils.NullComponent import NullComponent
+    dbs = [self.inventory.dbProperties]
+    if not isinstance(self.inventory.dbInitialState, NullComponent):
+      dbs.append(self.inventory.dbInitialState)
+    from pylith.utils.parametercache import spatialDBDigest
+    self.parameterCache(filename, spatialDBDigest(dbs))
+    return
+
+
   def _modelMemoryUse(self):
     """
     Model allocated memory.
@@ -46,6 +46,8 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     ## \b Properties
     ## @li \b linear_slip_rate Nondimensional slip rate below which friction 
     ## varies linearly with slip rate.
+    ## @li \b fast_math Use fast approximations of log() and exp()
+    ## (maximum relative error 2.0e-12).
     ##
     ## \b Facilities
     ## @li None
@@ -57,6 +59,10 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     linearSlipRate.meta['tip'] = "Nondimensional slip rate below which friction " \
         "varies linearly with slip rate."
 
+    fastMath = pyre.inventory.bool("fast_math", default=False)
+    fastMath.meta['tip'] = "Use fast approximations of log() and exp() " \
+        "(maximum relative error 2.0e-12)."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="ratestateageing"):
@@ -89,6 +95,7 @@ class RateStateAgeing(FrictionModel, ModuleRateStateAgeing):
     try:
       FrictionModel._configure(self)
       ModuleRateStateAgeing.linearSlipRate(self, self.inventory.linearSlipRate)
+      ModuleRateStateAgeing.fastMath(self, self.inventory.fastMath)
     except ValueError, err:
       aliases = ", ".join(self.aliases)
       raise ValueError("Error while configuring friction model "
@@ -45,7 +45,12 @@ class ElasticMaterial(Material):
     ## Python object for managing FaultCohesiveKin facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b stable_dt_tolerance Relative change in state variables
+    ##   that triggers recomputing the stable implicit time step in a cell.
+    ## @li \b double_buffer_state_vars Keep trial state variables from
+    ##   the residual evaluation and commit them at the end of the time step.
+    ## @li \b reuse_residual_stress Reuse strain and stress from the
+    ##   converged residual evaluation for state variables and output.
     ##
     ## \b Facilities
     ## @li \b output Output manager associated with material data.
@@ -54,6 +59,15 @@ class ElasticMaterial(Material):
 
     import pyre.inventory
 
+    stableTimeStepTolerance = pyre.inventory.float("stable_dt_tolerance", default=-1.0)
+    stableTimeStepTolerance.meta['tip'] = "Relative change in state variables that triggers recomputing the stable implicit time step in a cell (negative to recompute all cells every time step)."
+
+    doubleBufferStateVars = pyre.inventory.bool("double_buffer_state_vars", default=False)
+    doubleBufferStateVars.meta['tip'] = "Keep trial state variables computed in the residual and commit them at the end of the time step (avoids recomputing state variables with the nonlinear solver)."
+
+    reuseResidualStress = pyre.inventory.bool("reuse_residual_stress", default=False)
+    reuseResidualStress.meta['tip'] = "Reuse strain and stress from the converged residual evaluation when updating state variables and writing output (nonlinear solver only)."
+
     from pylith.meshio.OutputMatElastic import OutputMatElastic
     output = pyre.inventory.facility("output", family="output_manager",
                                      factory=OutputMatElastic)
@@ -89,6 +103,9 @@ class ElasticMaterial(Material):
     """
     Material._configure(self)
     self.output = self.inventory.output
+    self.stableTimeStepTolerance(self.inventory.stableTimeStepTolerance)
+    self.doubleBufferStateVars(self.inventory.doubleBufferStateVars)
+    self.reuseResidualStress = self.inventory.reuseResidualStress
     from pylith.utils.NullComponent import NullComponent
     if not isinstance(self.inventory.dbInitialStress, NullComponent):
       self.dbInitialStress(self.inventory.dbInitialStress)
@@ -97,6 +114,19 @@ class ElasticMaterial(Material):
     return
 
   
+  def _parameterCacheDBs(self):
+    """
+    Get spatial databases used to initialize parameter fields.
+    """
+    dbs = Material._parameterCacheDBs(self)
+    from pylith.utils.NullComponent import NullComponent
+    if not isinstance(self.inventory.dbInitialStress, NullComponent):
+      dbs.append(self.inventory.dbInitialStress)
+    if not isinstance(self.inventory.dbInitialStrain, NullComponent):
+      dbs.append(self.inventory.dbInitialStrain)
+    return dbs
+
+
   def _modelMemoryUse(self):
     """
     Model allocated memory.
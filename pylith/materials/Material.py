@@ -67,6 +67,8 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b use_parameter_cache Cache initialized parameter fields for reuse.
+    ## @li \b parameter_cache_filename Root of filename for parameter cache.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +83,12 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    useParameterCache = pyre.inventory.bool("use_parameter_cache", default=False)
+    useParameterCache.meta['tip'] = "Cache fields initialized from spatial databases in HDF5 files and reuse them in later runs with the same mesh and databases."
+
+    parameterCacheFilename = pyre.inventory.str("parameter_cache_filename", default="")
+    parameterCacheFilename.meta['tip'] = "Root of filename for parameter cache (default is 'parameter_cache/CLASS_ID_LABEL')."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -192,6 +200,9 @@ class Material(PetscComponent):
 
       self.quadrature = self.inventory.quadrature
       self.perfLogger = self.inventory.perfLogger
+
+      if self.inventory.useParameterCache:
+        self._setupParameterCache()
     except ValueError, err:
       aliases = ", ".join(self.aliases)
       raise ValueError("Error while configuring material "
@@ -207,6 +218,42 @@ class Material(PetscComponent):
           "Please implement _createModuleOb() in derived class."
 
 
+  def _parameterCacheDBs(self):
+    """
+    Get spatial databases used to initialize parameter fields.
+    """
+    from pylith.utils.NullComponent import NullComponent
+    dbs = [self.inventory.dbProperties]
+    if not isinstance(self.inventory.dbInitialState, NullComponent):
+      dbs.append(self.inventory.dbInitialState)
+    return dbs
+
+
+  def _setupParameterCache(self):
+    """
+    Setup persistent cache of initialized parameter fields.
+    """
+    import os
+    filename = self.inventory.parameterCacheFilename
+    if 0 == len(filename):
+      # Material ids are unique, so the default filename is unique
+      # even if several materials have the same label.
+      filename = os.path.join("parameter_cache", "%s_%d_%s" % \
+                                (self.__class__.__name__, self.inventory.id,
+                                 self.inventory.label.replace(" ", "_")))
+    relpath = os.path.dirname(filename)
+    if len(relpath) > 0 and not os.path.exists(relpath):
+      try:
+        os.makedirs(relpath)
+      except OSError:
+        if not os.path.isdir(relpath):
+          raise
+
+    from pylith.utils.parametercache import spatialDBDigest
+    self.parameterCache(filename, spatialDBDigest(self._parameterCacheDBs()))
+    return
+
+
   def _modelMemoryUse(self):
     """
     Model allocated memory.
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/GreensFnsWriterHDF5.py
+##
+## @brief Python object for writing Green's functions at points as a
+## single HDF5 dataset.
+##
+## Factory: greensfns_writer
+
+from pyre.components.Component import Component
+from meshio import GreensFnsWriterHDF5 as ModuleGreensFnsWriterHDF5
+
+# GreensFnsWriterHDF5 class
+class GreensFnsWriterHDF5(Component, ModuleGreensFnsWriterHDF5):
+  """
+  Python object for writing Green's functions at points as a single
+  HDF5 dataset with dimensions (impulses, points, components).
+
+  Inventory
+
+  \b Properties
+  @li \b filename Name of HDF5 file.
+  @li \b compression Level of gzip compression (0=none).
+  
+  \b Facilities
+  @li None
+
+  Factory: greensfns_writer
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  filename = pyre.inventory.str("filename", default="greensfns.h5")
+  filename.meta['tip'] = "Name of HDF5 file."
+
+  compression = pyre.inventory.int("compression", default=6,
+                                   validator=pyre.inventory.range(0, 9))
+  compression.meta['tip'] = "Level of gzip compression (0=none)."
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="greensfnswriterhdf5"):
+    """
+    Constructor.
+    """
+    Component.__init__(self, name, facility="greensfns_writer")
+    ModuleGreensFnsWriterHDF5.__init__(self)
+    return
+
+
+  def initialize(self):
+    """
+    Initialize writer.
+    """
+    ModuleGreensFnsWriterHDF5.filename(self, self.filename)
+    ModuleGreensFnsWriterHDF5.compression(self, self.compression)
+    return
+  
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def greensfns_writer():
+  """
+  Factory associated with GreensFnsWriterHDF5.
+  """
+  return GreensFnsWriterHDF5()
+
+
+# End of file 
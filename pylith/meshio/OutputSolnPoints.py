@@ -107,6 +107,8 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
         convert(points, mesh.coordsys(), self.coordsys)
 
         ModuleOutputSolnPoints.setupInterpolator(self, mesh, points, stations, normalizer)
+        self.stationNames = stations
+        self.stationCoords = points
         self.mesh = ModuleOutputSolnPoints.pointsMesh(self)
 
         self._eventLogger.eventEnd(logEvent)
@@ -65,6 +65,8 @@ class Formulation(PetscComponent, ModuleFormulation):
     ## @li \b matrix_type Type of PETSc sparse matrix.
     ## @li \b split_fields Split solution fields into displacements and Lagrange constraints.
     ## @li \b use_custom_constraint_pc Use custom preconditioner for Lagrange constraints.
+    ## @li \b batch_faults Compute residual of faults with kinematic slip
+    ##   with one loop over their vertices.
     ## @li \b view_jacobian Flag to output Jacobian matrix when it is reformed.
     ##
     ## \b Facilities
@@ -87,6 +89,10 @@ class Formulation(PetscComponent, ModuleFormulation):
     useCustomConstraintPC.meta['tip'] = "Use custom preconditioner for " \
                                         "Lagrange constraints."
 
+    batchFaults = pyre.inventory.bool("batch_faults", default=False)
+    batchFaults.meta['tip'] = "Compute residual of faults with kinematic " \
+                              "slip with one loop over their vertices."
+
     viewJacobian = pyre.inventory.bool("view_jacobian", default=False)
     viewJacobian.meta['tip'] = "Write Jacobian matrix to binary file."
     
@@ -314,6 +320,7 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     ModuleFormulation.splitFields(self, self.inventory.useSplitFields)
     ModuleFormulation.useCustomConstraintPC(self, self.inventory.useCustomConstraintPC)
+    ModuleFormulation.batchFaults(self, self.inventory.batchFaults)
 
     return
 
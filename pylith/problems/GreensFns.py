@@ -45,9 +45,18 @@ class GreensFns(Problem):
     ##
     ## \b Properties
     ## @li \b faultId Id of fault on which to impose impulses.
+    ## @li \b block_size Number of impulses (or adjoint point forces)
+    ##   to solve for at once.
+    ## @li \b mode Compute responses by solving for each impulse
+    ##   ('forward') or for a point force at each station component
+    ##   ('adjoint').
+    ## @li \b adjoint_filename Name of file for responses in adjoint mode.
     ##
     ## \b Facilities
     ## @li \b formulation Formulation for solving PDE.
+    ## @li \b stations Output manager with stations for adjoint mode
+    ##   and compact output.
+    ## @li \b writer Writer for responses at stations as a single dataset.
     ## @li \b progress_monitor Simple progress monitor via text file.
     ## @li \b checkpoint Checkpoint manager.
 
@@ -56,6 +65,24 @@ class GreensFns(Problem):
     faultId = pyre.inventory.int("fault_id", default=100)
     faultId.meta['tip'] = "Id of fault on which to impose impulses."
 
+    blockSize = pyre.inventory.int("block_size", default=1, validator=pyre.inventory.greaterEqual(1))
+    blockSize.meta['tip'] = "Number of impulses to solve for at once (1=one impulse at a time)."
+
+    mode = pyre.inventory.str("mode", default="forward",
+                              validator=pyre.inventory.choice(["forward", "adjoint"]))
+    mode.meta['tip'] = "Compute responses by solving for each impulse ('forward') or " \
+        "for a point force at each station component ('adjoint')."
+
+    adjointFilename = pyre.inventory.str("adjoint_filename", default="greensfns_adjoint.txt")
+    adjointFilename.meta['tip'] = "Name of file for responses in adjoint mode."
+
+    from pylith.utils.NullComponent import NullComponent
+    stations = pyre.inventory.facility("stations", family="output_manager", factory=NullComponent)
+    stations.meta['tip'] = "Output manager with stations for adjoint mode and compact output (OutputSolnPoints)."
+
+    writer = pyre.inventory.facility("writer", family="greensfns_writer", factory=NullComponent)
+    writer.meta['tip'] = "Writer for responses at stations as a single dataset (GreensFnsWriterHDF5)."
+
     from Implicit import Implicit
     formulation = pyre.inventory.facility("formulation",
                                           family="pde_formulation",
@@ -123,6 +150,28 @@ class GreensFns(Problem):
       raise ValueError("Incompatible source for green's function impulses "
                        "with id '%d' and label '%s'." % \
                          (self.source.id(), self.source.label()))
+    if self.blockSize > 1 and not "initializeBlock" in dir(self.formulation):
+      raise ValueError("Formulation '%s' does not support solving for "
+                       "multiple impulses at once." % self.formulation.name)
+    if self.mode == "adjoint":
+      if not "impulseResponses" in dir(self.source):
+        raise ValueError("Source for green's function impulses with id '%d' and "
+                         "label '%s' does not support adjoint mode." % \
+                           (self.source.id(), self.source.label()))
+      if not "addPointForce" in dir(self.stations):
+        raise ValueError("Adjoint mode for green's functions requires stations "
+                         "from output over points (OutputSolnPoints).")
+      if not "initializeBlock" in dir(self.formulation):
+        raise ValueError("Formulation '%s' does not support adjoint mode for "
+                         "green's functions." % self.formulation.name)
+    if self._hasWriter():
+      if not "impulseInfo" in dir(self.source):
+        raise ValueError("Source for green's function impulses with id '%d' and "
+                         "label '%s' does not support compact output." % \
+                           (self.source.id(), self.source.label()))
+      if not "gatherPointValues" in dir(self.stations):
+        raise ValueError("Compact output for green's functions requires stations "
+                         "from output over points (OutputSolnPoints).")
     return
   
 
@@ -138,6 +187,13 @@ class GreensFns(Problem):
       self._info.log("Initializing problem.")
     self.checkpointTimer.initialize(self.normalizer)
     self.formulation.initialize(self.dimension, self.normalizer)
+    if self.mode == "adjoint" or self._hasWriter():
+      self.stations.preinitialize()
+      self.stations.initialize(self.mesh(), self.normalizer)
+    if self.mode == "adjoint" or self.blockSize > 1:
+      self.formulation.initializeBlock(self.blockSize)
+    if self._hasWriter() and 0 == comm.rank:
+      self.writer.initialize()
     return
 
 
@@ -157,11 +213,22 @@ class GreensFns(Problem):
       material.useElasticBehavior(True)
 
     nimpulses = self.source.numImpulses()
+    self._openWriter(nimpulses)
+    if self.mode == "adjoint":
+      self._runAdjoint(nimpulses)
+      self._closeWriter()
+      return
+
     if nimpulses > 0:
       self.progressMonitor.open()
     
     ipulse = 0;
     dt = 1.0
+    if self.blockSize > 1:
+      while ipulse < nimpulses:
+        nblock = min(self.blockSize, nimpulses-ipulse)
+        self._runBlock(ipulse, nblock, nimpulses, dt)
+        ipulse += nblock
     while ipulse < nimpulses:
       self.progressMonitor.update(ipulse, 0, nimpulses)
 
@@ -194,11 +261,13 @@ class GreensFns(Problem):
                          (ipulse+1, nimpulses))
       self._eventLogger.stagePush("Poststep")
       self.formulation.poststep(t, dt)
+      self._writeResponse(ipulse)
       self._eventLogger.stagePop()
 
       # Update time/impulse
       ipulse += 1
 
+    self._closeWriter()
     self.progressMonitor.close()      
     return
 
@@ -227,6 +296,202 @@ class GreensFns(Problem):
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
+  def _runBlock(self, ipulse, nblock, nimpulses, dt):
+    """
+    Compute Green's functions for a block of impulses, solving for all
+    of the impulses in the block at once.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    if 0 == comm.rank:
+      self._info.log("Main loop, impulses %d-%d of %d." % \
+                       (ipulse+1, ipulse+nblock, nimpulses))
+
+    # Assemble right-hand side for each impulse in block.
+    for iblock in xrange(nblock):
+      self.progressMonitor.update(ipulse+iblock, 0, nimpulses)
+
+      # Implicit time stepping computes solution at t+dt, so set
+      # t=ipulse-dt, so that t+dt corresponds to the impulse
+      t = float(ipulse+iblock)-dt
+
+      # Checkpoint if necessary
+      self.checkpointTimer.update(t)
+
+      self._eventLogger.stagePush("Prestep")
+      self.formulation.prestep(t, dt)
+      self._eventLogger.stagePop()
+
+      self._eventLogger.stagePush("Step")
+      self.formulation.stepBlockRHS(t, dt, iblock)
+      self._eventLogger.stagePop()
+
+    if 0 == comm.rank:
+      self._info.log("Computing response to impulses %d-%d of %d." %
+                       (ipulse+1, ipulse+nblock, nimpulses))
+    self._eventLogger.stagePush("Step")
+    self.formulation.solveBlock(nblock)
+    self._eventLogger.stagePop()
+
+    # Write response to each impulse in block.
+    if 0 == comm.rank:
+      self._info.log("Finishing impulses %d-%d of %d." % \
+                       (ipulse+1, ipulse+nblock, nimpulses))
+    self._eventLogger.stagePush("Poststep")
+    for iblock in xrange(nblock):
+      t = float(ipulse+iblock)-dt
+      self.source.updateRelativeDisp(t+dt)
+      self.formulation.stepBlockSoln(t, dt, iblock)
+      self.formulation.poststep(t, dt)
+      self._writeResponse(ipulse+iblock)
+    self._eventLogger.stagePop()
+    return
+
+
+  def _runAdjoint(self, nimpulses):
+    """
+    Compute Green's functions at stations using reciprocity.
+
+    The response at a station component to each impulse follows from
+    the solution for a unit point force at the station component, so
+    we solve one problem per station component instead of one problem
+    per impulse.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    import numpy
+    spaceDim = self.mesh().coordsys().spaceDim()
+    stationNames = self.stations.stationNames
+    nobs = len(stationNames)*spaceDim
+    responses = numpy.zeros((nobs, nimpulses), dtype=numpy.float64)
+    values = numpy.zeros(nimpulses, dtype=numpy.float64)
+
+    if nobs > 0:
+      self.progressMonitor.open()
+
+    # The impulses do not contribute to the adjoint problem, so we only
+    # need to form the Jacobian.
+    dt = 1.0
+    t = -dt
+    self._eventLogger.stagePush("Prestep")
+    self.formulation.prestep(t, dt)
+    self._eventLogger.stagePop()
+
+    dispIncr = self.formulation.fields.get("dispIncr(t->t+dt)")
+    iobs = 0
+    while iobs < nobs:
+      nblock = min(self.blockSize, nobs-iobs)
+      self.progressMonitor.update(iobs, 0, nobs)
+
+      if 0 == comm.rank:
+        self._info.log("Main loop, station components %d-%d of %d." % \
+                         (iobs+1, iobs+nblock, nobs))
+      self._eventLogger.stagePush("Step")
+      for iblock in xrange(nblock):
+        ipoint, icomp = divmod(iobs+iblock, spaceDim)
+        self.formulation.stepAdjointRHS(self.stations, ipoint, icomp, iblock)
+      self.formulation.solveBlock(nblock)
+      self._eventLogger.stagePop()
+
+      self._eventLogger.stagePush("Poststep")
+      for iblock in xrange(nblock):
+        self.formulation.stepBlockSoln(t, dt, iblock)
+        self.source.impulseResponses(values, dispIncr)
+        responses[iobs+iblock,:] = values
+      dispIncr.zeroAll()
+      self._eventLogger.stagePop()
+
+      iobs += nblock
+
+    if self._hasWriter():
+      npoints = len(stationNames)
+      for ipulse in xrange(nimpulses):
+        self._writeResponse(ipulse, responses[:,ipulse].reshape((npoints, spaceDim)))
+    elif 0 == comm.rank:
+      self._info.log("Writing responses to '%s'." % self.adjointFilename)
+      fout = open(self.adjointFilename, "w")
+      fout.write("# Green's functions: station, component, response to each impulse\n")
+      for iobs in xrange(nobs):
+        ipoint, icomp = divmod(iobs, spaceDim)
+        fout.write("%s %d" % (stationNames[ipoint], icomp))
+        for value in responses[iobs,:]:
+          fout.write(" %14.6e" % value)
+        fout.write("\n")
+      fout.close()
+
+    self.progressMonitor.close()
+    return
+
+
+  def _hasWriter(self):
+    """
+    Check whether responses at stations are written as a single dataset.
+    """
+    from pylith.utils.NullComponent import NullComponent
+    return not isinstance(self.writer, NullComponent)
+
+
+  def _openWriter(self, nimpulses):
+    """
+    Open writer for responses at stations and write information about
+    the stations and impulses.
+    """
+    if not self._hasWriter():
+      return
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    import numpy
+    spaceDim = self.mesh().coordsys().spaceDim()
+    coordinates = numpy.zeros(nimpulses*spaceDim, dtype=numpy.float64)
+    vertices = numpy.zeros(nimpulses, dtype=numpy.int32)
+    amplitudes = numpy.zeros(nimpulses, dtype=numpy.float64)
+    components = numpy.zeros(nimpulses, dtype=numpy.int32)
+    self.source.impulseInfo(coordinates, vertices, amplitudes, components)
+
+    stationNames = self.stations.stationNames
+    self._responseValues = numpy.zeros(len(stationNames)*spaceDim, dtype=numpy.float64)
+    if 0 == comm.rank:
+      self.writer.open(nimpulses, len(stationNames), spaceDim)
+      self.writer.writePoints(self.stations.stationCoords, stationNames)
+      self.writer.writeImpulses(coordinates.reshape((nimpulses, spaceDim)), vertices,
+                                components, amplitudes)
+    return
+
+
+  def _writeResponse(self, impulse, values=None):
+    """
+    Write responses at stations to impulse. If values are not given,
+    the responses are interpolated from the current displacement field.
+    """
+    if not self._hasWriter():
+      return
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    spaceDim = self.mesh().coordsys().spaceDim()
+    if values is None:
+      disp = self.formulation.fields.get("disp(t)")
+      self.stations.gatherPointValues(self._responseValues, disp)
+      values = self._responseValues.reshape((-1, spaceDim))
+    if 0 == comm.rank:
+      self.writer.writeResponse(impulse, values)
+    return
+
+
+  def _closeWriter(self):
+    """
+    Close writer for responses at stations.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    if self._hasWriter() and 0 == comm.rank:
+      self.writer.close()
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
@@ -234,6 +499,11 @@ class GreensFns(Problem):
     Problem._configure(self)
 
     self.faultId = self.inventory.faultId
+    self.blockSize = self.inventory.blockSize
+    self.mode = self.inventory.mode
+    self.adjointFilename = self.inventory.adjointFilename
+    self.stations = self.inventory.stations
+    self.writer = self.inventory.writer
     self.formulation = self.inventory.formulation
     self.progressMonitor = self.inventory.progressMonitor
     self.checkpointTimer = self.inventory.checkpointTimer
@@ -247,6 +247,80 @@ class Implicit(Formulation, ModuleImplicit):
     return
 
 
+  def initializeBlock(self, blockSize):
+    """
+    Allocate storage for solving for a block of right-hand sides at
+    once (linear problems only).
+    """
+    if not "createBlock" in dir(self.solver):
+      raise ValueError("Solving for multiple right-hand sides at once "
+                       "requires a linear solver.")
+    self.solver.createBlock(self.fields.solution(), blockSize)
+    return
+
+
+  def stepBlockRHS(self, t, dt, index):
+    """
+    Compute residual for step from t to t+dt and store it as a
+    right-hand side in the block.
+
+    The displacement field at time t is set to zero, so the solution
+    for each right-hand side is the entire response rather than the
+    change relative to the previous step.
+    """
+    disp = self.fields.get("disp(t)")
+    disp.zeroAll()
+
+    self._reformResidual(t+dt, dt)
+
+    residual = self.fields.get("residual")
+    self.solver.setBlockRHS(residual, index)
+    return
+
+
+  def stepAdjointRHS(self, stations, point, component, index):
+    """
+    Set right-hand side of adjoint problem for a unit point force at a
+    point and store it as a right-hand side in the block.
+    """
+    residual = self.fields.get("residual")
+    residual.zeroAll()
+    stations.addPointForce(residual, point, component, 1.0)
+    residual.complete()
+    self.solver.setBlockRHS(residual, index)
+    return
+
+
+  def solveBlock(self, numRHS):
+    """
+    Solve for the right-hand sides stored in the block.
+    """
+    comm = self.mesh().comm()
+
+    if 0 == comm.rank:
+      self._info.log("Solving equations for %d right-hand sides." % numRHS)
+    self._eventLogger.stagePush("Solve")
+    self.solver.solveBlock(self.jacobian, numRHS)
+    self._eventLogger.stagePop()
+    return
+
+
+  def stepBlockSoln(self, t, dt, index):
+    """
+    Set solution for step from t to t+dt from the solution for a
+    right-hand side in the block. Follow with poststep().
+    """
+    dispIncr = self.fields.get("dispIncr(t->t+dt)")
+    dispIncr.zeroAll()
+    for constraint in self.constraints:
+      constraint.setFieldIncr(t, t+dt, dispIncr)
+    disp = self.fields.get("disp(t)")
+    disp.zeroAll()
+
+    self.solver.getBlockSolution(dispIncr, index)
+    return
+
+
   def prestepElastic(self, t, dt):
     """
     Hook for doing stuff before advancing time step.
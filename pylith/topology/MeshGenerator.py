@@ -45,6 +45,9 @@ class MeshGenerator(PetscComponent):
     ## \b Properties
     ## @li \b debug Debugging flag for mesh.
     ## @li \b interpolate Build intermediate mesh topology elements (if true)
+    ## @li \b batch_faults Create cohesive cells for all faults with a
+    ##   single split of the mesh (faults that share vertices are
+    ##   inserted one at a time).
     ##
     ## \b Facilities
     ## @li None
@@ -57,6 +60,11 @@ class MeshGenerator(PetscComponent):
     interpolate = pyre.inventory.bool("interpolate", default=False)
     interpolate.meta['tip'] = "Build intermediate mesh topology elements"
 
+    batchFaults = pyre.inventory.bool("batch_faults", default=False)
+    batchFaults.meta['tip'] = "Create cohesive cells for all faults with a " \
+        "single split of the mesh (faults that share vertices are inserted " \
+        "one at a time)."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -67,6 +75,7 @@ class MeshGenerator(PetscComponent):
     PetscComponent.__init__(self, name, facility="meshgenerator")
     self.debug = False
     self.interpolate = False
+    self.batchFaults = False
     return
 
 
@@ -90,6 +99,7 @@ class MeshGenerator(PetscComponent):
     PetscComponent._configure(self)
     self.debug = self.inventory.debug
     self.interpolate = self.inventory.interpolate
+    self.batchFaults = self.inventory.batchFaults
     return
 
 
@@ -106,7 +116,10 @@ class MeshGenerator(PetscComponent):
     #self._info.activate()
     #mesh.view("===== MESH BEFORE ADJUSTING TOPOLOGY =====")
 
-    if not interfaces is None:
+    adjusted = False
+    if not interfaces is None and self.batchFaults and len(interfaces) > 1:
+      adjusted = self._adjustTopologyBatch(mesh, interfaces)
+    if not interfaces is None and not adjusted:
       firstFaultVertex    = 0
       firstLagrangeVertex = 0
       firstFaultCell      = 0
@@ -133,6 +146,42 @@ class MeshGenerator(PetscComponent):
     return
   
 
+  def _adjustTopologyBatch(self, mesh, interfaces):
+    """
+    Adjust topology for all interfaces with a single split of the mesh.
+
+    Returns False if the interfaces share points and must be
+    adjusted one at a time.
+    """
+    import time
+    import journal
+    from pylith.utils.profiling import resourceUsageString
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    # Report memory usage after each phase (label, split, material)
+    # along with the totals.
+    if self._info.state:
+      journal.info("cohesivetopology").activate()
+
+    if 0 == comm.rank:
+      self._info.log("Adjusting topology for %d faults in a single pass." % \
+                       len(interfaces))
+      self._info.log("Before adjusting topology: %s" % resourceUsageString())
+    t0 = time.time()
+
+    from pylith.faults.faults import FaultCohesive as ModuleFaultCohesive
+    adjusted = ModuleFaultCohesive.adjustTopologyBatch(mesh, interfaces)
+
+    if 0 == comm.rank:
+      if adjusted:
+        self._info.log("After adjusting topology (%.2f s): %s" % \
+                         (time.time()-t0, resourceUsageString()))
+      else:
+        self._info.log("Faults share points; adjusting topology one fault at a time.")
+    return adjusted
+
+
   def _setupLogging(self):
     """
     Setup event logging.
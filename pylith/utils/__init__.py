@@ -22,7 +22,8 @@ __all__ = ['CheckpointTimer',
            'PetscComponent',
            'PetscManager',
            'testarray',
-           'importing']
+           'importing',
+           'parametercache']
 
 
 # End of file
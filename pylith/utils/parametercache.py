@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/utils/parametercache.py
+##
+## @brief Digest of spatial databases used as the key for the
+## persistent cache of initialized parameter fields.
+
+def spatialDBDigest(dbs):
+  """
+  Compute digest of the configuration of the spatial databases and
+  the contents of any files they reference.
+  """
+  import hashlib
+  digest = hashlib.sha1()
+  for db in dbs:
+    _updateDigest(digest, db)
+  return digest.hexdigest()
+
+
+def _updateDigest(digest, obj):
+  """
+  Add properties of component and its facilities to digest. Property
+  values that name existing files contribute the file contents.
+  """
+  import os
+
+  digest.update("%s:%s;" % (obj.__class__.__name__, getattr(obj, "name", "")))
+  if not hasattr(obj, "inventory"):
+    return
+
+  propertyNames = obj.inventory.propertyNames()
+  propertyNames.sort()
+  facilityNames = obj.inventory.facilityNames()
+  facilityNames.sort()
+
+  propertiesOmit = [
+    "help",
+    "help-components",
+    "help-persistence",
+    "help-properties",
+    "typos",
+    ]
+  for name in propertyNames:
+    if name in facilityNames or name in propertiesOmit:
+      continue
+    value = obj.inventory.getTraitDescriptor(name).value
+    digest.update("%s=%s;" % (name, str(value)))
+    if isinstance(value, str) and len(value) > 0 and os.path.isfile(value):
+      fin = open(value, "rb")
+      digest.update(fin.read())
+      fin.close()
+
+  for name in facilityNames:
+    if name == "weaver":
+      continue
+    _updateDigest(digest, obj.inventory.getTraitDescriptor(name).value)
+  return
+
+
+# End of file
@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/tri3/TestGreensFnsAdjoint.py
+##
+## @brief Test suite for testing Green's functions computed at
+## stations using reciprocity (adjoint mode).
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+from TestGreensFnsBlock import GreensFnsSeqApp
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class GreensFnsAdjointApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfnsadjoint")
+    return
+
+
+class TestGreensFnsAdjoint(unittest.TestCase):
+  """
+  Test suite for testing that the responses at stations from the
+  adjoint problems match the forward Green's functions.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    self.nimpulses = 9
+    self.stations = ["ZZ.AAA", "ZZ.BBB", "ZZ.CCC", "ZZ.DDD"]
+    self.spaceDim = 2
+    self.tolerance = 1.0e-6
+    run_pylith(GreensFnsSeqApp)
+    run_pylith(GreensFnsAdjointApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_responses(self):
+    """
+    Check responses at stations.
+    """
+    if not self.checkResults:
+      return
+
+    import h5py
+    h5 = h5py.File("greensfnsseq-points.h5", "r", driver="sec2")
+    dispE = h5['vertex_fields/displacement'][:]
+    h5.close()
+    nstations = len(self.stations)
+    self.assertEqual((self.nimpulses, nstations, self.spaceDim), dispE.shape)
+
+    disp = numpy.zeros(dispE.shape, dtype=numpy.float64)
+    nlines = 0
+    for line in open("greensfnsadjoint.txt", "r"):
+      if line.startswith("#"):
+        continue
+      fields = line.split()
+      self.assertEqual(2+self.nimpulses, len(fields))
+      istation = self.stations.index(fields[0])
+      icomp = int(fields[1])
+      disp[:,istation,icomp] = map(float, fields[2:])
+      nlines += 1
+    self.assertEqual(nstations*self.spaceDim, nlines)
+
+    # Adjoint responses are written with 7 significant digits.
+    scale = max(1.0, numpy.max(numpy.abs(dispE)))
+    diff = numpy.abs(disp - dispE) / scale
+    for istep in xrange(self.nimpulses):
+      if numpy.max(diff[istep]) > self.tolerance:
+        print "Error in response to impulse %d." % istep
+        print "Expected values: ",dispE[istep]
+        print "Output values: ",disp[istep]
+      self.assertTrue(numpy.max(diff[istep]) <= self.tolerance)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestGreensFnsAdjoint import TestGreensFnsAdjoint as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
@@ -0,0 +1,137 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/tri3/TestGreensFnsBlock.py
+##
+## @brief Test suite for testing Green's functions computed by solving
+## for blocks of impulses at once.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class GreensFnsSeqApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfnsseq")
+    return
+
+
+class GreensFnsBlockApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfnsblock")
+    return
+
+
+class TestGreensFnsBlock(unittest.TestCase):
+  """
+  Test suite for testing that solving for blocks of impulses gives
+  the same responses as solving for one impulse at a time.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    self.nimpulses = 9
+    self.tolerance = 1.0e-6
+    run_pylith(GreensFnsSeqApp)
+    run_pylith(GreensFnsBlockApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_soln(self):
+    """
+    Check solution (displacement) field.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkField("greensfnsseq.h5", "greensfnsblock.h5", "displacement")
+    return
+
+
+  def test_points_data(self):
+    """
+    Check displacement at stations.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkField("greensfnsseq-points.h5", "greensfnsblock-points.h5", "displacement")
+    return
+
+
+  def test_fault_data(self):
+    """
+    Check fault slip.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkField("greensfnsseq-fault.h5", "greensfnsblock-fault.h5", "slip")
+    return
+
+
+  def _checkField(self, filenameSeq, filenameBlock, name):
+    """
+    Check that the vertex field in the output from the block solve
+    matches the one from the sequential solve for each impulse.
+    """
+    import h5py
+    h5 = h5py.File(filenameSeq, "r", driver="sec2")
+    valuesE = h5['vertex_fields/%s' % name][:]
+    h5.close()
+
+    h5 = h5py.File(filenameBlock, "r", driver="sec2")
+    values = h5['vertex_fields/%s' % name][:]
+    h5.close()
+
+    self.assertEqual(self.nimpulses, valuesE.shape[0])
+    self.assertEqual(valuesE.shape, values.shape)
+
+    scale = max(1.0, numpy.max(numpy.abs(valuesE)))
+    diff = numpy.abs(values - valuesE) / scale
+    for istep in xrange(self.nimpulses):
+      if numpy.max(diff[istep]) > self.tolerance:
+        print "Error in %s for impulse %d." % (name, istep)
+        print "Expected values: ",valuesE[istep]
+        print "Output values: ",values[istep]
+      self.assertTrue(numpy.max(diff[istep]) <= self.tolerance)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestGreensFnsBlock import TestGreensFnsBlock as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
@@ -63,6 +63,12 @@ class TestApp(FullTestApp):
     from TestFaultsIntersect import TestFaultsIntersect
     suite.addTest(unittest.makeSuite(TestFaultsIntersect))
 
+    from TestGreensFnsBlock import TestGreensFnsBlock
+    suite.addTest(unittest.makeSuite(TestGreensFnsBlock))
+
+    from TestGreensFnsAdjoint import TestGreensFnsAdjoint
+    suite.addTest(unittest.makeSuite(TestGreensFnsAdjoint))
+
     return suite
 
 
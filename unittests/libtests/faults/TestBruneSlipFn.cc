@@ -30,12 +30,15 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min(), std::max()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestBruneSlipFn );
 
@@ -431,6 +434,8 @@ pylith::faults::TestBruneSlipFn::_testInitialize(const _TestBruneSlipFn::DataStr
   const PetscInt vEnd = verticesStratum.end();
 
   const PylithScalar tolerance = 1.0e-06;
+  PylithScalar startTimeE = pylith::PYLITH_MAXSCALAR;
+  PylithScalar completionTimeE = -pylith::PYLITH_MAXSCALAR;
   for(PetscInt v = vStart, iPoint = 0; v < vEnd; ++v, ++iPoint) {
     const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
     CPPUNIT_ASSERT_EQUAL(spaceDim, finalSlipVisitor.sectionDof(v));
@@ -446,7 +451,12 @@ pylith::faults::TestBruneSlipFn::_testInitialize(const _TestBruneSlipFn::DataStr
     } // for
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.slipTimeE[iPoint]+originTime, slipTimeArray[stoff], tolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.riseTimeE[iPoint], riseTimeArray[rtoff], tolerance);
+    startTimeE = std::min(startTimeE, data.slipTimeE[iPoint]+originTime);
+    // Slip is complete to machine precision after 45 time constants.
+    completionTimeE = std::max(completionTimeE, data.slipTimeE[iPoint]+originTime + 45.0*0.21081916*data.riseTimeE[iPoint]);
   } // for
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(startTimeE, slipfn.startTime(), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(completionTimeE, slipfn.completionTime(), tolerance);
 
   PYLITH_METHOD_END;
 } // _testInitialize
@@ -325,6 +325,100 @@ pylith::faults::TestFaultCohesive::testAdjustTopologyQuad4h(void)
   PYLITH_METHOD_END;
 } // testAdjustTopologyQuad4h
 
+// ----------------------------------------------------------------------
+// Test adjustTopologyBatch() with 2-D quadrilateral element.
+void
+pylith::faults::TestFaultCohesive::testAdjustTopologyBatchQuad4h(void)
+{ // testAdjustTopologyBatchQuad4h
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataQuad4h data;
+
+  topology::Mesh mesh;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(data.filename);
+  iohandler.debug(false);
+  iohandler.read(&mesh);
+
+  FaultCohesiveTract faultA;
+  faultA.id(1);
+  faultA.label("faultA");
+  FaultCohesiveTract faultB;
+  faultB.id(2);
+  faultB.label("faultB");
+  FaultCohesive* faults[2] = { &faultA, &faultB };
+  CPPUNIT_ASSERT(FaultCohesive::adjustTopologyBatch(&mesh, faults, 2));
+
+  CPPUNIT_ASSERT_EQUAL(data.cellDim, mesh.dimension());
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err;
+
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(data.numVertices, verticesStratum.size());
+
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  CPPUNIT_ASSERT_EQUAL(data.numCells, cellsStratum.size());
+
+  // Cohesive cells for the faults are created together, so their
+  // order may differ from sequential insertion; compare the number of
+  // cells with each material id.
+  PetscDMLabel labelMaterials = NULL;
+  err = DMGetLabel(dmMesh, "material-id", &labelMaterials);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(labelMaterials);
+  int numCellsA = 0, numCellsB = 0, numCellsAE = 0, numCellsBE = 0;
+  for (PetscInt c = cStart, cell = 0; c < cEnd; ++c, ++cell) {
+    PetscInt value;
+    err = DMLabelGetValue(labelMaterials, c, &value);PYLITH_CHECK_ERROR(err);
+    numCellsA += (faultA.id() == value) ? 1 : 0;
+    numCellsB += (faultB.id() == value) ? 1 : 0;
+    numCellsAE += (faultA.id() == data.materialIds[cell]) ? 1 : 0;
+    numCellsBE += (faultB.id() == data.materialIds[cell]) ? 1 : 0;
+  } // for
+  CPPUNIT_ASSERT_EQUAL(numCellsAE, numCellsA);
+  CPPUNIT_ASSERT_EQUAL(numCellsBE, numCellsB);
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyBatchQuad4h
+
+// ----------------------------------------------------------------------
+// Test adjustTopologyBatch() with faults that share points.
+void
+pylith::faults::TestFaultCohesive::testAdjustTopologyBatchShared(void)
+{ // testAdjustTopologyBatchShared
+  PYLITH_METHOD_BEGIN;
+
+  CohesiveDataQuad4h data;
+
+  topology::Mesh mesh;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(data.filename);
+  iohandler.debug(false);
+  iohandler.read(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  const PetscInt numVertices = topology::Stratum(dmMesh, topology::Stratum::DEPTH, 0).size();
+  const PetscInt numCells = topology::Stratum(dmMesh, topology::Stratum::HEIGHT, 0).size();
+
+  // Both faults use the same group of vertices.
+  FaultCohesiveTract faultA;
+  faultA.id(1);
+  faultA.label("faultA");
+  FaultCohesiveTract faultB;
+  faultB.id(2);
+  faultB.label("faultA");
+  FaultCohesive* faults[2] = { &faultA, &faultB };
+  CPPUNIT_ASSERT(!FaultCohesive::adjustTopologyBatch(&mesh, faults, 2));
+
+  // Mesh is unchanged, so faults can be inserted one at a time.
+  CPPUNIT_ASSERT(dmMesh == mesh.dmMesh());
+  CPPUNIT_ASSERT_EQUAL(numVertices, topology::Stratum(dmMesh, topology::Stratum::DEPTH, 0).size());
+  CPPUNIT_ASSERT_EQUAL(numCells, topology::Stratum(dmMesh, topology::Stratum::HEIGHT, 0).size());
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyBatchShared
+
 // ----------------------------------------------------------------------
 #include "data/CohesiveDataQuad4i.hh" // USES CohesiveDataQuad4i
 
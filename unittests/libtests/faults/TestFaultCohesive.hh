@@ -65,6 +65,8 @@ class pylith::faults::TestFaultCohesive : public CppUnit::TestFixture
   CPPUNIT_TEST( testAdjustTopologyQuad4f );
   CPPUNIT_TEST( testAdjustTopologyQuad4g );
   CPPUNIT_TEST( testAdjustTopologyQuad4h );
+  CPPUNIT_TEST( testAdjustTopologyBatchQuad4h );
+  CPPUNIT_TEST( testAdjustTopologyBatchShared );
   CPPUNIT_TEST( testAdjustTopologyQuad4i );
   CPPUNIT_TEST( testAdjustTopologyTet4 );
   CPPUNIT_TEST( testAdjustTopologyTet4b );
@@ -151,6 +153,12 @@ public :
   /// Test adjustTopology() with 2-D quadrilateral element (2 faults).
   void testAdjustTopologyQuad4h(void);
 
+  /// Test adjustTopologyBatch() with 2-D quadrilateral element (2 faults).
+  void testAdjustTopologyBatchQuad4h(void);
+
+  /// Test adjustTopologyBatch() with faults that share points.
+  void testAdjustTopologyBatchShared(void);
+
   /// Test adjustTopology() with 2-D quadrilateral element (embedded fault).
   void testAdjustTopologyQuad4i(void);
 
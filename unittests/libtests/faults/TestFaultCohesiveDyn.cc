@@ -35,6 +35,8 @@
 #include "pylith/topology/VisitorSubMesh.hh" // USES SubMeshIS
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/friction/StaticFriction.hh" // USES StaticFriction
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
@@ -150,6 +152,71 @@ pylith::faults::TestFaultCohesiveDyn::testOpenFreeSurf(void)
   CPPUNIT_ASSERT_EQUAL(value, fault._openFreeSurf);
  } // testOpenFreeSurf
 
+// ----------------------------------------------------------------------
+// Test reuseSensitivityFactorization().
+void
+pylith::faults::TestFaultCohesiveDyn::testReuseSensitivityFactorization(void)
+{ // testReuseSensitivityFactorization
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveDyn fault;
+
+  CPPUNIT_ASSERT_EQUAL(false, fault._reuseSensitivityFactorization); // default
+  CPPUNIT_ASSERT(!fault._jacobianPositive);
+  CPPUNIT_ASSERT(!fault._kspPositive);
+
+  const bool value = true;
+  fault.reuseSensitivityFactorization(value);
+  CPPUNIT_ASSERT_EQUAL(value, fault._reuseSensitivityFactorization);
+
+  PYLITH_METHOD_END;
+} // testReuseSensitivityFactorization
+
+// ----------------------------------------------------------------------
+// Test activeSetMargin().
+void
+pylith::faults::TestFaultCohesiveDyn::testActiveSetMargin(void)
+{ // testActiveSetMargin
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveDyn fault;
+
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(1.0), fault._activeSetMargin); // default
+
+  const PylithScalar value = 0.25;
+  fault.activeSetMargin(value);
+  CPPUNIT_ASSERT_EQUAL(value, fault._activeSetMargin);
+
+  CPPUNIT_ASSERT_THROW(fault.activeSetMargin(-0.1), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(fault.activeSetMargin(1.1), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testActiveSetMargin
+
+// ----------------------------------------------------------------------
+// Test ruptureMetrics() and ruptureSlipRateThreshold().
+void
+pylith::faults::TestFaultCohesiveDyn::testRuptureMetrics(void)
+{ // testRuptureMetrics
+  PYLITH_METHOD_BEGIN;
+
+  FaultCohesiveDyn fault;
+
+  CPPUNIT_ASSERT_EQUAL(false, fault._ruptureMetrics); // default
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), fault._ruptureSlipRateThreshold); // default
+
+  fault.ruptureMetrics(true);
+  CPPUNIT_ASSERT_EQUAL(true, fault._ruptureMetrics);
+
+  const PylithScalar value = 1.0e-3;
+  fault.ruptureSlipRateThreshold(value);
+  CPPUNIT_ASSERT_EQUAL(value, fault._ruptureSlipRateThreshold);
+
+  CPPUNIT_ASSERT_THROW(fault.ruptureSlipRateThreshold(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testRuptureMetrics
+
 // ----------------------------------------------------------------------
 // Test initialize().
 void
@@ -242,6 +309,7 @@ pylith::faults::TestFaultCohesiveDyn::testConstrainSolnSpaceStick(void)
   const PylithScalar t = 2.134 / _data->timeScale;
   const PylithScalar dt = 0.01 / _data->timeScale;
   fault.timeStep(dt);
+  fault.activeSetMargin(0.1);
   fault.constrainSolnSpace(&fields, t, jacobian);
   
   topology::Field& solution = fields.solution();
@@ -250,6 +318,19 @@ pylith::faults::TestFaultCohesiveDyn::testConstrainSolnSpaceStick(void)
 
   fault.updateStateVars(t, &fields);
 
+  if (spaceDim > 1) { // Check active set
+    // All unclamped vertices are locked for the stick case.
+    const int numVertices = fault._cohesiveVertices.size();
+    CPPUNIT_ASSERT_EQUAL(size_t(numVertices), fault._activeSetStatus.size());
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+      if (fault._cohesiveVertices[iVertex].lagrange < 0) {
+        continue;
+      } // if
+      CPPUNIT_ASSERT_EQUAL(int(FaultCohesiveDyn::VERTEX_LOCKED), fault._activeSetStatus[iVertex]);
+      CPPUNIT_ASSERT(fault._activeSetStrength[iVertex] > 0.0);
+    } // for
+  } // Check active set
+
   { // Check solution values
     // No change to Lagrange multipliers for stick case.
 
@@ -505,6 +586,9 @@ pylith::faults::TestFaultCohesiveDyn::testUpdateStateVars(void)
 
   topology::Mesh mesh;
   FaultCohesiveDyn fault;
+  fault.ruptureMetrics(true);
+  const PylithScalar threshold = 1.0e-6;
+  fault.ruptureSlipRateThreshold(threshold);
   topology::SolutionFields fields(mesh);
   _initialize(&mesh, &fault, &fields);
   topology::Jacobian jacobian(fields.solution());
@@ -518,6 +602,22 @@ pylith::faults::TestFaultCohesiveDyn::testUpdateStateVars(void)
   // :TODO: Need to verify that fault constitutive updateStateVars is called.
   // We don't have a way to verify state variables inside friction object.
 
+  // Check consistency of rupture metrics.
+  const size_t numVertices = fault._cohesiveVertices.size();
+  CPPUNIT_ASSERT_EQUAL(numVertices, fault._ruptureTime.size());
+  for (size_t i=0; i < numVertices; ++i) {
+    const PylithScalar peakSlipRate = fault._peakSlipRate[i];
+    CPPUNIT_ASSERT(peakSlipRate >= 0.0);
+    if (peakSlipRate > threshold) {
+      CPPUNIT_ASSERT_EQUAL(t, fault._ruptureTime[i]);
+    } else {
+      CPPUNIT_ASSERT_EQUAL(PYLITH_MAXSCALAR, fault._ruptureTime[i]);
+    } // if/else
+    if (peakSlipRate > 0.0) {
+      CPPUNIT_ASSERT_EQUAL(t, fault._peakSlipRateTime[i]);
+    } // if
+  } // for
+
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
@@ -590,6 +690,57 @@ pylith::faults::TestFaultCohesiveDyn::testCalcTractions(void)
   PYLITH_METHOD_END;
 } // testCalcTractions
 
+// ----------------------------------------------------------------------
+// Test constrainSolnSpace() and adjustSolnLumped() with and without active set.
+void
+pylith::faults::TestFaultCohesiveDyn::testActiveSet(void)
+{ // testActiveSet
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  const int numCases = 2;
+  const PylithScalar* fieldIncrCases[numCases] = { _data->fieldIncrStick, _data->fieldIncrSlip };
+  for (int iCase=0; iCase < numCases; ++iCase) {
+    scalar_array slipE, tractionE, solutionE;
+    _adjustSolnActiveSet(&slipE, &tractionE, &solutionE, 1.0, fieldIncrCases[iCase]);
+
+    scalar_array slip, traction, solution;
+    _adjustSolnActiveSet(&slip, &traction, &solution, 0.1, fieldIncrCases[iCase]);
+
+    const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-5;
+
+    CPPUNIT_ASSERT_EQUAL(slipE.size(), slip.size());
+    for (size_t i=0; i < slipE.size(); ++i) {
+      if (fabs(slipE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, slip[i]/slipE[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(slipE[i], slip[i], tolerance);
+      } // if/else
+    } // for
+
+    CPPUNIT_ASSERT_EQUAL(tractionE.size(), traction.size());
+    for (size_t i=0; i < tractionE.size(); ++i) {
+      if (fabs(tractionE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, traction[i]/tractionE[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(tractionE[i], traction[i], tolerance);
+      } // if/else
+    } // for
+
+    CPPUNIT_ASSERT_EQUAL(solutionE.size(), solution.size());
+    for (size_t i=0; i < solutionE.size(); ++i) {
+      if (fabs(solutionE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, solution[i]/solutionE[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(solutionE[i], solution[i], tolerance);
+      } // if/else
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testActiveSet
+
 // ----------------------------------------------------------------------
 // Initialize FaultCohesiveDyn interface condition.
 void
@@ -787,6 +938,88 @@ pylith::faults::TestFaultCohesiveDyn::_setFieldsJacobian(topology::Mesh* const m
   PYLITH_METHOD_END;
 } // _setFieldsJacobian
 
+// ----------------------------------------------------------------------
+// Adjust solution for two iterations and get slip, tractions, and solution.
+void
+pylith::faults::TestFaultCohesiveDyn::_adjustSolnActiveSet(scalar_array* slip,
+							   scalar_array* traction,
+							   scalar_array* solution,
+							   const PylithScalar margin,
+							   const PylithScalar* const fieldIncr)
+{ // _adjustSolnActiveSet
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(slip);
+  CPPUNIT_ASSERT(traction);
+  CPPUNIT_ASSERT(solution);
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveDyn fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+  topology::Jacobian jacobian(fields.solution());
+  _setFieldsJacobian(&mesh, &fault, &fields, &jacobian, fieldIncr);
+
+  fault.activeSetMargin(margin);
+
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+
+  topology::Field& dispIncr = fields.solution();
+  const topology::Field& dispIncrAdj = fields.get("dispIncr adjust");
+
+  // First iteration classifies vertices, second iteration uses the
+  // active set when it is enabled.
+  for (int iter=0; iter < 2; ++iter) {
+    fault.constrainSolnSpace(&fields, t, jacobian);
+    dispIncr += dispIncrAdj;
+    fault.updateStateVars(t, &fields);
+  } // for
+
+  // Lumped Jacobian with unit values.
+  topology::Field jacobianLumped(mesh);
+  jacobianLumped.label("Jacobian");
+  jacobianLumped.cloneSection(fields.get("residual"));
+  PetscErrorCode err = VecSet(jacobianLumped.localVector(), 1.0);PYLITH_CHECK_ERROR(err);
+  jacobianLumped.complete();
+
+  for (int iter=0; iter < 2; ++iter) {
+    fault.adjustSolnLumped(&fields, t, jacobianLumped);
+    dispIncr += dispIncrAdj;
+    fault.updateStateVars(t, &fields);
+  } // for
+
+  PetscInt size = 0;
+  const PetscScalar* values = NULL;
+
+  const topology::Field& slipField = fault.vertexField("slip", &fields);
+  err = VecGetLocalSize(slipField.localVector(), &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(slipField.localVector(), &values);PYLITH_CHECK_ERROR(err);
+  slip->resize(size);
+  for (PetscInt i=0; i < size; ++i)
+    (*slip)[i] = values[i];
+  err = VecRestoreArrayRead(slipField.localVector(), &values);PYLITH_CHECK_ERROR(err);
+
+  const topology::Field& tractionField = fault.vertexField("traction", &fields);
+  err = VecGetLocalSize(tractionField.localVector(), &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(tractionField.localVector(), &values);PYLITH_CHECK_ERROR(err);
+  traction->resize(size);
+  for (PetscInt i=0; i < size; ++i)
+    (*traction)[i] = values[i];
+  err = VecRestoreArrayRead(tractionField.localVector(), &values);PYLITH_CHECK_ERROR(err);
+
+  err = VecGetLocalSize(dispIncr.localVector(), &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(dispIncr.localVector(), &values);PYLITH_CHECK_ERROR(err);
+  solution->resize(size);
+  for (PetscInt i=0; i < size; ++i)
+    (*solution)[i] = values[i];
+  err = VecRestoreArrayRead(dispIncr.localVector(), &values);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _adjustSolnActiveSet
+
 // ----------------------------------------------------------------------
 // Determine if point is a Lagrange multiplier constraint point.
 bool
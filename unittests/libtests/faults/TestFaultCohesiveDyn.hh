@@ -33,6 +33,7 @@
 #include "pylith/topology/topologyfwd.hh" // USES Mesh
 #include "pylith/feassemble/feassemblefwd.hh" // HOLDSA Quadrature
 #include "pylith/friction/frictionfwd.hh" // HOLDSA FrictionModel
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA SpatialDB
 #include <vector> // HASA std::vector
 /// Namespace for pylith package
@@ -55,6 +56,9 @@ class pylith::faults::TestFaultCohesiveDyn: public CppUnit::TestFixture
   CPPUNIT_TEST( testTractPerturbation );
   CPPUNIT_TEST( testZeroTolerance );
   CPPUNIT_TEST( testOpenFreeSurf );
+  CPPUNIT_TEST( testReuseSensitivityFactorization );
+  CPPUNIT_TEST( testActiveSetMargin );
+  CPPUNIT_TEST( testRuptureMetrics );
 
   // Tests in derived classes:
   // testInitialize()
@@ -63,6 +67,7 @@ class pylith::faults::TestFaultCohesiveDyn: public CppUnit::TestFixture
   // testConstrainSolnSpaceOpen()
   // testUpdateStateVars()
   // testCalcTractions()
+  // testActiveSet()
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -97,6 +102,15 @@ public:
   /// Test openFreeSurf().
   void testOpenFreeSurf(void);
 
+  /// Test reuseSensitivityFactorization().
+  void testReuseSensitivityFactorization(void);
+
+  /// Test activeSetMargin().
+  void testActiveSetMargin(void);
+
+  /// Test ruptureMetrics() and ruptureSlipRateThreshold().
+  void testRuptureMetrics(void);
+
   /// Test initialize().
   void testInitialize(void);
 
@@ -115,6 +129,9 @@ public:
   /// Test _calcTractions().
   void testCalcTractions(void);
 
+  /// Test constrainSolnSpace() and adjustSolnLumped() with and without active set.
+  void testActiveSet(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private:
 
@@ -146,6 +163,21 @@ private:
       topology::Jacobian* const jacobian,
       const PylithScalar* const fieldIncrVals);
 
+  /** Adjust solution with constrainSolnSpace() and adjustSolnLumped()
+   * for two iterations and get resulting slip, tractions, and solution.
+   *
+   * @param slip Slip at fault vertices (output).
+   * @param traction Tractions at fault vertices (output).
+   * @param solution Solution increment (output).
+   * @param margin Margin for active set (1.0 disables active set).
+   * @param fieldIncrVals Values for solution increment field.
+   */
+  void _adjustSolnActiveSet(scalar_array* slip,
+			    scalar_array* traction,
+			    scalar_array* solution,
+			    const PylithScalar margin,
+			    const PylithScalar* const fieldIncrVals);
+
   /** Determine if point is a Lagrange multiplier constraint point.
    *
    * @param point Label of point.
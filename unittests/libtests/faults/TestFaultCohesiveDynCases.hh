@@ -54,6 +54,7 @@ class pylith::faults::TestFaultCohesiveDynTri3 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testActiveSet );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -80,6 +81,7 @@ class pylith::faults::TestFaultCohesiveDynTri3d : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testActiveSet );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -106,6 +108,7 @@ class pylith::faults::TestFaultCohesiveDynQuad4 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testActiveSet );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -132,6 +135,7 @@ class pylith::faults::TestFaultCohesiveDynTet4 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testActiveSet );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -158,6 +162,7 @@ class pylith::faults::TestFaultCohesiveDynHex8 : public TestFaultCohesiveDyn
   CPPUNIT_TEST( testConstrainSolnSpaceOpen );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testCalcTractions );
+  CPPUNIT_TEST( testActiveSet );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -31,6 +31,7 @@
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
@@ -306,6 +307,72 @@ pylith::faults::TestFaultCohesiveImpulses::testIntegrateResidual(void)
   PYLITH_METHOD_END;
 } // testIntegrateResidual
 
+// ----------------------------------------------------------------------
+// Test impulseResponses() against responses from forward problems.
+void
+pylith::faults::TestFaultCohesiveImpulses::testImpulseResponses(void)
+{ // testImpulseResponses
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveImpulses fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  const int numImpulses = fault.numImpulses();
+  CPPUNIT_ASSERT(numImpulses > 0);
+
+  // Solution of adjoint problem with a distinct value for every DOF.
+  topology::Field& dispIncr = fields.get("dispIncr(t->t+dt)");
+  PetscInt adjointSize = 0;
+  PetscErrorCode err = VecGetLocalSize(dispIncr.localVector(), &adjointSize);CPPUNIT_ASSERT(!err);
+  PetscScalar* adjointArray = NULL;
+  err = VecGetArray(dispIncr.localVector(), &adjointArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < adjointSize; ++i) {
+    adjointArray[i] = 0.1*(i+1) * ((i % 2) ? -1.0 : 1.0);
+  } // for
+  err = VecRestoreArray(dispIncr.localVector(), &adjointArray);CPPUNIT_ASSERT(!err);
+
+  scalar_array responses(numImpulses);
+  fault.impulseResponses(&responses[0], numImpulses, dispIncr);
+
+  topology::Field adjoint(mesh);
+  adjoint.label("adjoint");
+  adjoint.cloneSection(dispIncr);
+  adjoint.copy(dispIncr);
+
+  // By reciprocity, the forward response to an impulse is the
+  // product of the adjoint solution and the residual for the impulse
+  // with zero displacement.
+  fields.get("disp(t)").zeroAll();
+  dispIncr.zeroAll();
+
+  const PylithScalar dt = 1.0;
+  fault.timeStep(dt);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  topology::Field& residual = fields.get("residual");
+  for (int impulse=0; impulse < numImpulses; ++impulse) {
+    const PylithScalar t = impulse;
+    residual.zeroAll();
+    fault.integrateResidual(residual, t, &fields);
+
+    PylithScalar responseE = 0.0;
+    err = VecDot(adjoint.localVector(), residual.localVector(), &responseE);CPPUNIT_ASSERT(!err);
+    responseE *= _data->lengthScale;
+
+    if (fabs(responseE) > tolerance) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, responses[impulse]/responseE, tolerance);
+    } else {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(responseE, responses[impulse], tolerance);
+    } // if/else
+  } // for
+
+  PYLITH_METHOD_END;
+} // testImpulseResponses
+
 // ----------------------------------------------------------------------
 // Initialize FaultCohesiveImpulses interface condition.
 void
@@ -60,6 +60,7 @@ class pylith::faults::TestFaultCohesiveImpulses: public CppUnit::TestFixture
   // testNumImpulses()
   // testInitialize()
   // testIntegrateResidual()
+  // testImpulseResponses()
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -100,6 +101,9 @@ public:
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test impulseResponses() against responses from forward problems.
+  void testImpulseResponses(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private:
 
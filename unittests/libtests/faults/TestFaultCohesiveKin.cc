@@ -21,6 +21,7 @@
 #include "TestFaultCohesiveKin.hh" // Implementation of class methods
 
 #include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/faults/FaultCohesiveKinBatch.hh" // USES FaultCohesiveKinBatch
 
 #include "data/CohesiveKinData.hh" // USES CohesiveKinData
 
@@ -313,6 +314,63 @@ pylith::faults::TestFaultCohesiveKin::testIntegrateResidual(void)
   PYLITH_METHOD_END;
 } // testIntegrateResidual
 
+// ----------------------------------------------------------------------
+// Test integrateResidual() for batch of faults.
+void
+pylith::faults::TestFaultCohesiveKin::testIntegrateResidualBatch(void)
+{ // testIntegrateResidualBatch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  FaultCohesiveKinBatch batch;
+  batch.addFault(&fault);
+  CPPUNIT_ASSERT_EQUAL(1, batch.numFaults());
+
+  CPPUNIT_ASSERT(_data->fieldT);
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT, _data->lengthScale);
+  
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  batch.timeStep(dt);
+  topology::Field& residual = fields.get("residual");
+  batch.integrateResidual(residual, t, &fields);
+
+  // Check values
+  CPPUNIT_ASSERT(_data->residual);
+  const PylithScalar* valsE = _data->residual;
+
+  PetscInt pStart, pEnd;
+  PetscErrorCode err = PetscSectionGetChart(residual.localSection(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+      
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  const int spaceDim = _data->spaceDim;
+  const PylithScalar residualScale = _data->lengthScale * pow(_data->lengthScale, spaceDim-1);
+  for (PetscInt p = pStart, iPoint = 0; p < pEnd; ++p) {
+    if (residualVisitor.sectionDof(p) > 0) {
+      const PetscInt off = residualVisitor.sectionOffset(p);
+      CPPUNIT_ASSERT_EQUAL(spaceDim, residualVisitor.sectionDof(p));
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+	const PylithScalar valE = valsE[iPoint*spaceDim+d];
+	if (fabs(valE) > tolerance)
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualArray[off+d]/valE*residualScale, tolerance);
+	else
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(valE, residualArray[off+d]*residualScale, tolerance);
+      } // for
+      ++iPoint;
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualBatch
+
 // ----------------------------------------------------------------------
 // Test integrateJacobian().
 void
@@ -598,6 +656,219 @@ pylith::faults::TestFaultCohesiveKin::testCalcTractionsChange(void)
   PYLITH_METHOD_END;
 } // testCalcTractionsChange
 
+// ----------------------------------------------------------------------
+// Test reuse of derived fields in vertexField().
+void
+pylith::faults::TestFaultCohesiveKin::testVertexFieldCache(void)
+{ // testVertexFieldCache
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_data->fieldT);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT);
+
+  const PylithScalar t = 0;
+  fault.updateStateVars(t, &fields);
+
+  PetscErrorCode err = 0;
+  PetscObjectState slipState = 0, tractionState = 0, stateCache = 0;
+
+  // First requests compute slip and tractions in separate buffers.
+  const topology::Field& slip = fault.vertexField("slip", &fields);
+  err = PetscObjectStateGet((PetscObject)slip.localVector(), &slipState);PYLITH_CHECK_ERROR(err);
+
+  const topology::Field& traction = fault.vertexField("traction_change", &fields);
+  CPPUNIT_ASSERT(&slip != &traction);
+  err = PetscObjectStateGet((PetscObject)traction.localVector(), &tractionState);PYLITH_CHECK_ERROR(err);
+
+  // Computing tractions only reads orientation, so slip is reused
+  // without touching its buffer.
+  const topology::Field& slipCache = fault.vertexField("slip", &fields);
+  CPPUNIT_ASSERT(&slip == &slipCache);
+  err = PetscObjectStateGet((PetscObject)slipCache.localVector(), &stateCache);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(slipState, stateCache);
+
+  // Likewise, computing slip does not invalidate tractions.
+  const topology::Field& tractionCache = fault.vertexField("traction_change", &fields);
+  CPPUNIT_ASSERT(&traction == &tractionCache);
+  err = PetscObjectStateGet((PetscObject)tractionCache.localVector(), &stateCache);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(tractionState, stateCache);
+
+  // Changing solution forces tractions, but not slip, to be recomputed.
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT);
+  const topology::Field& tractionNew = fault.vertexField("traction_change", &fields);
+  CPPUNIT_ASSERT(&traction == &tractionNew);
+  err = PetscObjectStateGet((PetscObject)tractionNew.localVector(), &stateCache);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(tractionState != stateCache);
+
+  const topology::Field& slipNew = fault.vertexField("slip", &fields);
+  CPPUNIT_ASSERT(&slip == &slipNew);
+  err = PetscObjectStateGet((PetscObject)slipNew.localVector(), &stateCache);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(slipState, stateCache);
+
+  PYLITH_METHOD_END;
+} // testVertexFieldCache
+
+// ----------------------------------------------------------------------
+// Test _updateCohesiveOffsets().
+void
+pylith::faults::TestFaultCohesiveKin::testUpdateCohesiveOffsets(void)
+{ // testUpdateCohesiveOffsets
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  fault._updateCohesiveOffsets(fields);
+
+  const topology::Field& solution = fields.solution();
+  topology::VecVisitorMesh solnVisitor(solution);
+  PetscSection solnGlobalSection = solution.globalSection();CPPUNIT_ASSERT(solnGlobalSection);
+  CPPUNIT_ASSERT(fault._fields);
+  topology::VecVisitorMesh dispRelVisitor(fault._fields->get("relative disp"));
+  topology::VecVisitorMesh orientationVisitor(fault._fields->get("orientation"));
+  topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+
+  const FaultCohesiveKin::CohesiveOffsets& offsets = fault._cohesiveOffsets;
+  const size_t numVertices = fault._cohesiveVertices.size();
+  CPPUNIT_ASSERT_EQUAL(numVertices, offsets.lagrange.size());
+  CPPUNIT_ASSERT(solution.localSection() == offsets.solnSection);
+
+  PetscErrorCode err = 0;
+  for (size_t i=0; i < numVertices; ++i) {
+    const PetscInt e_lagrange = fault._cohesiveVertices[i].lagrange;
+    const PetscInt v_fault = fault._cohesiveVertices[i].fault;
+    const PetscInt v_negative = fault._cohesiveVertices[i].negative;
+    const PetscInt v_positive = fault._cohesiveVertices[i].positive;
+    if (e_lagrange < 0) { // clamped edges
+      CPPUNIT_ASSERT_EQUAL(PetscInt(-1), offsets.lagrange[i]);
+      CPPUNIT_ASSERT_EQUAL(PetscInt(-1), offsets.lagrangeGlobal[i]);
+      continue;
+    } // if
+
+    CPPUNIT_ASSERT_EQUAL(solnVisitor.sectionOffset(v_negative), offsets.negative[i]);
+    CPPUNIT_ASSERT_EQUAL(solnVisitor.sectionOffset(v_positive), offsets.positive[i]);
+    CPPUNIT_ASSERT_EQUAL(solnVisitor.sectionOffset(e_lagrange), offsets.lagrange[i]);
+
+    PetscInt goff = 0;
+    err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &goff);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(goff, offsets.lagrangeGlobal[i]);
+    err = PetscSectionGetOffset(solnGlobalSection, v_negative, &goff);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(goff < 0 ? -(goff+1) : goff, offsets.negativeGlobal[i]);
+    err = PetscSectionGetOffset(solnGlobalSection, v_positive, &goff);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(goff < 0 ? -(goff+1) : goff, offsets.positiveGlobal[i]);
+
+    CPPUNIT_ASSERT_EQUAL(dispRelVisitor.sectionOffset(v_fault), offsets.fault[i]);
+    CPPUNIT_ASSERT_EQUAL(orientationVisitor.sectionOffset(v_fault), offsets.orientation[i]);
+    CPPUNIT_ASSERT_EQUAL(areaVisitor.sectionOffset(v_fault), offsets.area[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testUpdateCohesiveOffsets
+
+
+// ----------------------------------------------------------------------
+// Test _updatePreconditionerCache().
+void
+pylith::faults::TestFaultCohesiveKin::testPreconditionerCache(void)
+{ // testPreconditionerCache
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  CPPUNIT_ASSERT(_data->fieldT);
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT);
+
+  const PylithScalar t = 2.134;
+  topology::Jacobian jacobian(fields.solution());
+  fault.integrateJacobian(&jacobian, t, &fields);
+  jacobian.assemble("final_assembly");
+
+  // Build cache.
+  fault._updatePreconditionerCache(jacobian, fields);
+  FaultCohesiveKin::PreconditionerCache& cache = fault._precondCache;
+  const size_t numVertices = fault._cohesiveVertices.size();
+  const int spaceDim = _data->spaceDim;
+  CPPUNIT_ASSERT_EQUAL(numVertices, cache.lagrange.size());
+  CPPUNIT_ASSERT_EQUAL(numVertices*spaceDim, cache.values.size());
+  CPPUNIT_ASSERT(cache.jacobianNP);
+  CPPUNIT_ASSERT(cache.diagonalNP);
+  CPPUNIT_ASSERT(cache.indicesNP);
+  CPPUNIT_ASSERT(jacobian.matrix() == cache.jacobianMatrix);
+  PetscSection solnSection = fields.solution().localSection();CPPUNIT_ASSERT(solnSection);
+  CPPUNIT_ASSERT(solnSection == cache.solnSection);
+
+  const PetscMat jacobianNP = cache.jacobianNP;
+  const PetscIS indicesNP = cache.indicesNP;
+  const int_array lagrangeE = cache.lagrange;
+  PetscInt numIndicesNP = 0;
+  PetscErrorCode err = ISGetLocalSize(indicesNP, &numIndicesNP);CPPUNIT_ASSERT(!err);
+  scalar_array diagonalE(numIndicesNP);
+  const PetscScalar* diagonalArray = NULL;
+  err = VecGetArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < numIndicesNP; ++i) {
+    diagonalE[i] = diagonalArray[i];
+  } // for
+  err = VecRestoreArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+
+  // Layout is unchanged, so the cache is reused and only the values
+  // of the submatrix are updated. Values inserted into the
+  // preconditioner are retained.
+  const PylithScalar shift = 2.0;
+  err = MatShift(jacobian.matrix(), shift);CPPUNIT_ASSERT(!err);
+  cache.values = 1.0;
+  fault._updatePreconditionerCache(jacobian, fields);
+  CPPUNIT_ASSERT(jacobianNP == cache.jacobianNP);
+  CPPUNIT_ASSERT(indicesNP == cache.indicesNP);
+  for (size_t i=0; i < cache.values.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(1.0), cache.values[i]);
+  } // for
+
+  const PylithScalar tolerance = 1.0e-06;
+  err = VecGetArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < numIndicesNP; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(diagonalE[i]+shift, diagonalArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+
+  // Change in state of the layout of the solution field forces the
+  // cache to be rebuilt.
+  err = PetscObjectStateIncrease((PetscObject)solnSection);CPPUNIT_ASSERT(!err);
+  PetscObjectState solnState = 0;
+  err = PetscObjectStateGet((PetscObject)solnSection, &solnState);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(solnState != cache.solnState);
+  fault._updatePreconditionerCache(jacobian, fields);
+  CPPUNIT_ASSERT_EQUAL(solnState, cache.solnState);
+  for (size_t i=0; i < cache.values.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), cache.values[i]);
+  } // for
+  CPPUNIT_ASSERT_EQUAL(lagrangeE.size(), cache.lagrange.size());
+  for (size_t i=0; i < numVertices; ++i) {
+    CPPUNIT_ASSERT_EQUAL(lagrangeE[i], cache.lagrange[i]);
+  } // for
+  err = VecGetArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < numIndicesNP; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(diagonalE[i]+shift, diagonalArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(cache.diagonalNP, &diagonalArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testPreconditionerCache
 
 // ----------------------------------------------------------------------
 void
@@ -93,6 +93,9 @@ public :
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test integrateResidual() for batch of faults.
+  void testIntegrateResidualBatch(void);
+
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
@@ -105,6 +108,15 @@ public :
   /// Test _calcTractionsChange().
   void testCalcTractionsChange(void);
 
+  /// Test reuse of derived fields in vertexField().
+  void testVertexFieldCache(void);
+
+  /// Test _updateCohesiveOffsets().
+  void testUpdateCohesiveOffsets(void);
+
+  /// Test _updatePreconditionerCache().
+  void testPreconditionerCache(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
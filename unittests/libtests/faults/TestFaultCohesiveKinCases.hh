@@ -53,10 +53,14 @@ class pylith::faults::TestFaultCohesiveKinTri3 : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -79,9 +83,13 @@ class pylith::faults::TestFaultCohesiveKinTri3d : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -104,9 +112,13 @@ class pylith::faults::TestFaultCohesiveKinTri3g : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -129,10 +141,14 @@ class pylith::faults::TestFaultCohesiveKinQuad4 : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -155,9 +171,13 @@ class pylith::faults::TestFaultCohesiveKinQuad4e : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -179,9 +199,13 @@ class pylith::faults::TestFaultCohesiveKinQuad4i : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -204,10 +228,14 @@ class pylith::faults::TestFaultCohesiveKinTet4 : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -230,9 +258,13 @@ class pylith::faults::TestFaultCohesiveKinTet4e : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -255,9 +287,13 @@ class pylith::faults::TestFaultCohesiveKinTet4f : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -280,10 +316,14 @@ class pylith::faults::TestFaultCohesiveKinHex8 : public TestFaultCohesiveKin
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualBatch );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testVertexFieldCache );
+  CPPUNIT_TEST( testUpdateCohesiveOffsets );
+  CPPUNIT_TEST( testPreconditionerCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -30,12 +30,15 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min(), std::max()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestLiuCosSlipFn );
 
@@ -424,6 +427,8 @@ pylith::faults::TestLiuCosSlipFn::_testInitialize(const _TestLiuCosSlipFn::DataS
   const PetscInt vEnd = verticesStratum.end();
 
   const PylithScalar tolerance = 1.0e-06;
+  PylithScalar startTimeE = pylith::PYLITH_MAXSCALAR;
+  PylithScalar completionTimeE = -pylith::PYLITH_MAXSCALAR;
   for(PetscInt v = vStart, iPoint = 0; v < vEnd; ++v, ++iPoint) {
     const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
     CPPUNIT_ASSERT_EQUAL(spaceDim, finalSlipVisitor.sectionDof(v));
@@ -439,7 +444,12 @@ pylith::faults::TestLiuCosSlipFn::_testInitialize(const _TestLiuCosSlipFn::DataS
     } // for
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.slipTimeE[iPoint]+originTime, slipTimeArray[stoff], tolerance);
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.riseTimeE[iPoint], riseTimeArray[rtoff], tolerance);
+    startTimeE = std::min(startTimeE, data.slipTimeE[iPoint]+originTime);
+    // Slip is complete at 1.525 times the rise time.
+    completionTimeE = std::max(completionTimeE, data.slipTimeE[iPoint]+originTime + 1.525*data.riseTimeE[iPoint]);
   } // for
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(startTimeE, slipfn.startTime(), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(completionTimeE, slipfn.completionTime(), tolerance);
 
   PYLITH_METHOD_END;
 } // _testInitialize
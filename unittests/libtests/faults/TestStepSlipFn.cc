@@ -30,12 +30,15 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::min(), std::max()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestStepSlipFn );
 
@@ -340,6 +343,8 @@ pylith::faults::TestStepSlipFn::_testInitialize(const _TestStepSlipFn::DataStruc
   const PetscInt vEnd = verticesStratum.end();
 
   const PylithScalar tolerance = 1.0e-06;
+  PylithScalar startTimeE = pylith::PYLITH_MAXSCALAR;
+  PylithScalar completionTimeE = -pylith::PYLITH_MAXSCALAR;
   for(PetscInt v = vStart, iPoint = 0; v < vEnd; ++v, ++iPoint) {
     const PetscInt fsoff = finalSlipVisitor.sectionOffset(v);
     CPPUNIT_ASSERT_EQUAL(spaceDim, finalSlipVisitor.sectionDof(v));
@@ -351,7 +356,12 @@ pylith::faults::TestStepSlipFn::_testInitialize(const _TestStepSlipFn::DataStruc
       CPPUNIT_ASSERT_DOUBLES_EQUAL(data.finalSlipE[iPoint*spaceDim+d], finalSlipArray[fsoff+d], tolerance);
     } // for
     CPPUNIT_ASSERT_DOUBLES_EQUAL(data.slipTimeE[iPoint]+originTime, slipTimeArray[stoff], tolerance);
+    startTimeE = std::min(startTimeE, data.slipTimeE[iPoint]+originTime);
+    // Slip is complete at the latest slip time.
+    completionTimeE = std::max(completionTimeE, data.slipTimeE[iPoint]+originTime);
   } // for
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(startTimeE, slipfn.startTime(), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(completionTimeE, slipfn.completionTime(), tolerance);
 
   PYLITH_METHOD_END;
 } // _testInitialize
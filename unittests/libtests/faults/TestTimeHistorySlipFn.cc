@@ -253,6 +253,43 @@ pylith::faults::TestTimeHistorySlipFn::testSlip(void)
   PYLITH_METHOD_END;
 } // testSlip
 
+// ----------------------------------------------------------------------
+// Test _setupSlipTimeGroups().
+void
+pylith::faults::TestTimeHistorySlipFn::testSlipTimeGroups(void)
+{ // testSlipTimeGroups
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar slipTimeE[] = { 1.2, 1.3 };
+  const int numGroupsE = 2;
+  const PylithScalar originTime = 5.064;
+
+  topology::Mesh mesh;
+  topology::Mesh faultMesh;
+  TimeHistorySlipFn slipfn;
+  spatialdata::spatialdb::TimeHistory th;
+  _initialize(&mesh, &faultMesh, &slipfn, &th, originTime);
+
+  CPPUNIT_ASSERT_EQUAL(size_t(numGroupsE), slipfn._groupSlipTime.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numGroupsE+1), slipfn._groupStart.size());
+  CPPUNIT_ASSERT_EQUAL(0, int(slipfn._groupStart[0]));
+
+  PetscDM dmMesh = faultMesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+
+  // Each vertex has a different slip time, so each group holds one
+  // vertex and the groups follow the order of the slip times.
+  const PylithScalar tolerance = 1.0e-06;
+  for(int iGroup = 0; iGroup < numGroupsE; ++iGroup) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(slipTimeE[iGroup]+originTime, slipfn._groupSlipTime[iGroup], tolerance);
+    CPPUNIT_ASSERT_EQUAL(iGroup+1, int(slipfn._groupStart[iGroup+1]));
+    CPPUNIT_ASSERT_EQUAL(vStart+iGroup, PetscInt(slipfn._groupVertices[iGroup]));
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSlipTimeGroups
+
 // ----------------------------------------------------------------------
 // Initialize TimeHistorySlipFn.
 void
@@ -58,6 +58,7 @@ class pylith::faults::TestTimeHistorySlipFn : public CppUnit::TestFixture
   CPPUNIT_TEST( testInitialize2D );
   CPPUNIT_TEST( testInitialize3D );
   CPPUNIT_TEST( testSlip );
+  CPPUNIT_TEST( testSlipTimeGroups );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -85,6 +86,9 @@ public :
   /// Test slip().
   void testSlip(void);
 
+  /// Test _setupSlipTimeGroups().
+  void testSlipTimeGroups(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -192,6 +192,72 @@ pylith::faults::TestTractPerturbation::testCalculate(void)
   PYLITH_METHOD_END;
 } // testCalculate
 
+// ----------------------------------------------------------------------
+// Test calculate() with static perturbation using 2-D mesh().
+void
+pylith::faults::TestTractPerturbation::testCalculateStatic(void)
+{ // testCalculateStatic
+  PYLITH_METHOD_BEGIN;
+
+  const PylithScalar tractionE[4] = { 
+    -1.0*(-2.0+1.0), -1.0*(1.0-0.5), // initial + change
+    -1.0*(-2.1+0.8), -1.0*(1.1-0.7), // initial + change
+  };
+
+  topology::Mesh mesh;
+  topology::Mesh faultMesh;
+  TractPerturbation tract;
+  _initialize(&mesh, &faultMesh, &tract);
+
+  // Vertices have different start times.
+  CPPUNIT_ASSERT_EQUAL(size_t(2), tract._changeStartTime.size());
+  CPPUNIT_ASSERT_EQUAL(false, tract._isCalculated);
+
+  const PylithScalar t = 3.0 / _TestTractPerturbation::timeScale;
+  tract.calculate(t);
+  CPPUNIT_ASSERT_EQUAL(true, tract._isCalculated);
+
+  const spatialdata::geocoords::CoordSys* cs = faultMesh.coordsys();CPPUNIT_ASSERT(cs);
+  const int spaceDim = cs->spaceDim();
+
+  PetscDM faultDMMesh = faultMesh.dmMesh();CPPUNIT_ASSERT(faultDMMesh);
+  topology::Stratum verticesStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  CPPUNIT_ASSERT(tract._parameters);
+  topology::VecVisitorMesh valueVisitor(tract._parameters->get("value"));
+  PetscScalar* valueArray = valueVisitor.localArray();CPPUNIT_ASSERT(valueArray);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for(PetscInt v = vStart, iPoint = 0; v < vEnd; ++v, ++iPoint) {
+    const PetscInt voff = valueVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, valueVisitor.sectionDof(v));
+
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      const PylithScalar valueE = tractionE[iPoint*spaceDim+d];
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, valueArray[voff+d]*_TestTractPerturbation::pressureScale, tolerance);
+    } // for
+  } // for
+
+  // All changes have started, so value should not be recomputed.
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt voff = valueVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      valueArray[voff+d] = 0.0;
+    } // for
+  } // for
+  tract.calculate(2.0*t);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt voff = valueVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, valueArray[voff+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCalculateStatic
+
 // ----------------------------------------------------------------------
 // Test parameterFields() using 2-D mesh.
 void
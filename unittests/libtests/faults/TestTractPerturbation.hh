@@ -51,6 +51,7 @@ class pylith::faults::TestTractPerturbation : public CppUnit::TestFixture
   CPPUNIT_TEST( testHasParameter );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testCalculate );
+  CPPUNIT_TEST( testCalculateStatic );
   CPPUNIT_TEST( testParameterFields );
   CPPUNIT_TEST( testVertexField );
 
@@ -74,6 +75,9 @@ public :
   /// Test calculate() with 2-D mesh.
   void testCalculate(void);
 
+  /// Test calculate() with static perturbation using 2-D mesh().
+  void testCalculateStatic(void);
+
   /// Test parameterFields() with 2-D mesh.
   void testParameterFields(void);
 
@@ -303,6 +303,65 @@ pylith::feassemble::TestElasticityImplicit::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test reuse of strain and stress from residual evaluation.
+void
+pylith::feassemble::TestElasticityImplicit::testReuseResidualStress(void)
+{ // testReuseResidualStress
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityImplicit integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  CPPUNIT_ASSERT(!integrator.reuseResidualStress());
+  integrator.reuseResidualStress(true);
+  CPPUNIT_ASSERT(integrator.reuseResidualStress());
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+
+  // Residual used disp(t) + dispIncr; make disp(t) match as at the
+  // end of a time step.
+  fields.get("disp(t)") += fields.get("dispIncr(t->t+dt)");
+
+  const int numNames = 2;
+  const char* names[numNames] = { "total_strain", "stress" };
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (int iName=0; iName < numNames; ++iName) {
+    // Recompute from solution.
+    integrator.trialStateVarsCurrent(false);
+    const topology::Field& fieldE = integrator.cellField(names[iName], mesh, &fields);
+    topology::VecVisitorMesh fieldEVisitor(fieldE);
+    PetscInt size = 0;
+    PetscErrorCode err = VecGetLocalSize(fieldEVisitor.localVec(), &size);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(size > 0);
+    scalar_array valuesE(fieldEVisitor.localArray(), size);
+    fieldEVisitor.clear();
+
+    // Reuse values from residual evaluation.
+    integrator.trialStateVarsCurrent(true);
+    const topology::Field& field = integrator.cellField(names[iName], mesh, &fields);
+    topology::VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* values = fieldVisitor.localArray();CPPUNIT_ASSERT(values);
+    for (PetscInt i=0; i < size; ++i) {
+      if (fabs(valuesE[i]) > 1.0)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, values[i]/valuesE[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i], values[i], tolerance);
+    } // for
+  } // for
+
+  // Update of state variables uses stored strain.
+  integrator.updateStateVars(t, &fields);
+
+  PYLITH_METHOD_END;
+} // testReuseResidualStress
+
 // ----------------------------------------------------------------------
 // Test StableTimeStep().
 void
@@ -97,6 +97,9 @@ public :
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /// Test reuse of strain and stress from residual evaluation.
+  void testReuseResidualStress(void);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -57,6 +57,7 @@ class pylith::feassemble::TestElasticityImplicit2DLinear :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -83,6 +84,7 @@ class pylith::feassemble::TestElasticityImplicit2DQuadratic :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -109,6 +111,7 @@ class pylith::feassemble::TestElasticityImplicit3DLinear :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -135,6 +138,7 @@ class pylith::feassemble::TestElasticityImplicit3DQuadratic :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -161,6 +165,7 @@ class pylith::feassemble::TestElasticityImplicitGrav2DLinear :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -187,6 +192,7 @@ class pylith::feassemble::TestElasticityImplicitGrav2DQuadratic :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -213,6 +219,7 @@ class pylith::feassemble::TestElasticityImplicitGrav3DLinear :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
@@ -239,6 +246,7 @@ class pylith::feassemble::TestElasticityImplicitGrav3DQuadratic :
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testReuseResidualStress );
   CPPUNIT_TEST( testStableTimeStep );
 
   CPPUNIT_TEST_SUITE_END();
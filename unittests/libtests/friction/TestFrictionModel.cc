@@ -282,6 +282,25 @@ pylith::friction::TestFrictionModel::testRetrievePropsStateVars(void)
     else
       CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], fieldsVertex[index++], tolerance);
 
+  // Retrieve using visitors created before looping over points.
+  const scalar_array fieldsVertexTmp(fieldsVertex);
+  friction.createPropsStateVarsVisitors();
+  CPPUNIT_ASSERT_EQUAL(numProperties + numStateVars, friction._propsStateVarsVisitors.size());
+  friction._propsStateVarsVertex = 0.0;
+  friction.retrievePropsStateVars(vertex);
+
+  // Retrieve into buffer supplied by caller.
+  CPPUNIT_ASSERT_EQUAL(int(numProperties + numStateVars), friction.propsStateVarsSize());
+  scalar_array propsStateVarsBuffer(friction.propsStateVarsSize());
+  friction.retrievePropsStateVars(&propsStateVarsBuffer[0], vertex);
+
+  friction.destroyPropsStateVarsVisitors();
+  CPPUNIT_ASSERT(friction._propsStateVarsVisitors.empty());
+  for (size_t i=0; i < fieldsVertex.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(fieldsVertexTmp[i], fieldsVertex[i]);
+    CPPUNIT_ASSERT_EQUAL(fieldsVertexTmp[i], propsStateVarsBuffer[i]);
+  } // for
+
   PYLITH_METHOD_END;
 } // testRetrievePropsStateVars
 
@@ -318,6 +337,14 @@ pylith::friction::TestFrictionModel::testCalcFriction(void)
     CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, frictionV, tolerance);
   } // if/else
 
+  // Properties and state variables supplied by caller.
+  scalar_array propsStateVars(friction.propsStateVarsSize());
+  friction.createPropsStateVarsVisitors();
+  friction.retrievePropsStateVars(&propsStateVars[0], vertex);
+  friction.destroyPropsStateVarsVisitors();
+  const PylithScalar frictionBuffer = friction.calcFriction(t, slip, slipRate, normalTraction, &propsStateVars[0]);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionV, frictionBuffer, tolerance);
+
   PYLITH_METHOD_END;
 } // testCalcFriction
     
@@ -626,7 +653,9 @@ pylith::friction::TestFrictionModel::testDBToStateVars(void)
     CPPUNIT_ASSERT( (0 < stateVarsSize && stateVarsE) ||
 		    (0 == stateVarsSize && !stateVarsE) );
     const PylithScalar tolerance = 1.0e-06;
-    for (int i=0; i < stateVarsSize; ++i) {
+    // State variables following those in the database are computed
+    // from them in initialize().
+    for (int i=0; i < numDBStateVars; ++i) {
       if (fabs(stateVarsE[i]) > tolerance)
 	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVars[i]/stateVarsE[i], tolerance);
       else
@@ -653,7 +682,7 @@ pylith::friction::TestFrictionModel::testNonDimStateVars(void)
 
   for (int iLoc=0; iLoc < numLocs; ++iLoc) {
     for (int i=0; i < stateVarsSize; ++i)
-      stateVars[i] = _data->dbStateVars[iLoc*stateVarsSize+i];
+      stateVars[i] = _data->stateVars[iLoc*stateVarsSize+i];
     _friction->_nondimStateVars(&stateVars[0], stateVars.size());
     
     const PylithScalar* const stateVarsNondimE =
@@ -856,6 +885,93 @@ pylith::friction::TestFrictionModel::test_updateStateVars(void)
   PYLITH_METHOD_END;
 } // test_updateStateVars
 
+// ----------------------------------------------------------------------
+// Test _calcFrictionBatch(), _calcFrictionDerivBatch(), and _updateStateVarsBatch().
+void
+pylith::friction::TestFrictionModel::test_batch(void)
+{ // test_batch
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_friction);
+  CPPUNIT_ASSERT(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  const int numValues = numPropsVertex + numVarsVertex;
+
+  // One array over the locations for each property and state variable.
+  scalar_array propsStateVars(numValues*numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      propsStateVars[i*numLocs+iLoc] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      propsStateVars[(numPropsVertex+i)*numLocs+iLoc] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  scalar_array propsStateVarsDefault(propsStateVars);
+
+  const PylithScalar t = 1.5;
+  _friction->timeStep(_data->dt);
+
+  scalar_array friction(numLocs);
+  _friction->_calcFrictionBatch(&friction[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+				&propsStateVars[0], numLocs);
+  scalar_array frictionDeriv(numLocs);
+  _friction->_calcFrictionDerivBatch(&frictionDeriv[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+				     &propsStateVars[0], numLocs);
+
+  // Default implementation evaluates one vertex at a time.
+  scalar_array frictionDefault(numLocs);
+  _friction->FrictionModel::_calcFrictionBatch(&frictionDefault[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+					       &propsStateVarsDefault[0], numLocs);
+  scalar_array frictionDerivDefault(numLocs);
+  _friction->FrictionModel::_calcFrictionDerivBatch(&frictionDerivDefault[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+						    &propsStateVarsDefault[0], numLocs);
+
+  const PylithScalar tolerance = 1.0e-06;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    const PylithScalar frictionE = _data->friction[iLoc];
+    if (0.0 != frictionE) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE, tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionDefault[iLoc]/frictionE, tolerance);
+    } else {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, friction[iLoc], tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE, frictionDefault[iLoc], tolerance);
+    } // if/else
+
+    const PylithScalar frictionDerivE = _data->frictionDeriv[iLoc];
+    if (0.0 != frictionDerivE) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionDeriv[iLoc]/frictionDerivE, tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionDerivDefault[iLoc]/frictionDerivE, tolerance);
+    } else {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionDerivE, frictionDeriv[iLoc], tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionDerivE, frictionDerivDefault[iLoc], tolerance);
+    } // if/else
+  } // for
+
+  if (numVarsVertex > 0) {
+    _friction->_updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction,
+				     &propsStateVars[0], numLocs);
+    _friction->FrictionModel::_updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction,
+						    &propsStateVarsDefault[0], numLocs);
+    for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+      const PylithScalar* stateVarsE = &_data->stateVarsUpdated[iLoc*numVarsVertex];
+      for (int i=0; i < numVarsVertex; ++i) {
+	const int index = (numPropsVertex+i)*numLocs+iLoc;
+	if (0.0 != stateVarsE[i]) {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propsStateVars[index]/stateVarsE[i], tolerance);
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propsStateVarsDefault[index]/stateVarsE[i], tolerance);
+	} else {
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], propsStateVars[index], tolerance);
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], propsStateVarsDefault[index], tolerance);
+	} // if/else
+      } // for
+    } // for
+  } // if
+
+  PYLITH_METHOD_END;
+} // test_batch
+
 // ----------------------------------------------------------------------
 // Setup nondimensionalization.
 void
@@ -139,6 +139,9 @@ public :
   /// Test _updateStateVars().
   void test_updateStateVars(void);
 
+  /// Test _calcFrictionBatch(), _calcFrictionDerivBatch(), and _updateStateVarsBatch().
+  void test_batch(void);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
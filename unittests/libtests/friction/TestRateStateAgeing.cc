@@ -24,6 +24,8 @@
 
 #include "pylith/friction/RateStateAgeing.hh" // USES RateStateAgeing
 
+#include "pylith/utils/array.hh" // USES scalar_array
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::friction::TestRateStateAgeing );
 
@@ -50,6 +52,78 @@ pylith::friction::TestRateStateAgeing::testLinearSlipRate(void)
   model.linearSlipRate(value);
   CPPUNIT_ASSERT_EQUAL(value, model._linearSlipRate);
 } // testLinearSlipRate
+
+// ----------------------------------------------------------------------
+// Test fastMath().
+void
+pylith::friction::TestRateStateAgeing::testFastMath(void)
+{ // testFastMath
+  CPPUNIT_ASSERT(_data);
+
+  RateStateAgeing model;
+  CPPUNIT_ASSERT_EQUAL(false, model._fastMath); // default
+
+  const int numLocs = _data->numLocs;
+  const int numPropsVertex = _data->numPropsVertex;
+  const int numVarsVertex = _data->numVarsVertex;
+  const int numValues = numPropsVertex + numVarsVertex;
+
+  scalar_array propsStateVars(numValues*numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numPropsVertex; ++i)
+      propsStateVars[i*numLocs+iLoc] = _data->properties[iLoc*numPropsVertex+i];
+    for (int i=0; i < numVarsVertex; ++i)
+      propsStateVars[(numPropsVertex+i)*numLocs+iLoc] = _data->stateVars[iLoc*numVarsVertex+i];
+  } // for
+  scalar_array propsStateVarsE(propsStateVars);
+
+  const PylithScalar t = 1.5;
+  model.timeStep(_data->dt);
+
+  // Values using standard library functions.
+  scalar_array frictionE(numLocs);
+  model._calcFrictionBatch(&frictionE[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+			   &propsStateVarsE[0], numLocs);
+  model._updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction,
+			      &propsStateVarsE[0], numLocs);
+
+  model.fastMath(true);
+  CPPUNIT_ASSERT_EQUAL(true, model._fastMath);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-10 : 1.0e-5;
+  scalar_array friction(numLocs);
+  model._calcFrictionBatch(&friction[0], t, _data->slip, _data->slipRate, _data->normalTraction,
+			   &propsStateVars[0], numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    if (0.0 != frictionE[iLoc])
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, friction[iLoc]/frictionE[iLoc], tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(frictionE[iLoc], friction[iLoc], tolerance);
+  } // for
+
+  // Per-vertex evaluation uses the same kernel.
+  scalar_array propsStateVarsVertex(numValues);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numValues; ++i)
+      propsStateVarsVertex[i] = propsStateVars[i*numLocs+iLoc];
+    const PylithScalar frictionVertex = model.calcFriction(t, _data->slip[iLoc], _data->slipRate[iLoc], _data->normalTraction[iLoc],
+							   &propsStateVarsVertex[0]);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, frictionVertex/friction[iLoc], tolerance);
+  } // for
+
+  // Update of state variable and state term.
+  model._updateStateVarsBatch(t, _data->slip, _data->slipRate, _data->normalTraction,
+			      &propsStateVars[0], numLocs);
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    for (int i=0; i < numVarsVertex; ++i) {
+      const int index = (numPropsVertex+i)*numLocs+iLoc;
+      if (0.0 != propsStateVarsE[index])
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propsStateVars[index]/propsStateVarsE[index], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(propsStateVarsE[index], propsStateVars[index], tolerance);
+    } // for
+  } // for
+} // testFastMath
   
 // ----------------------------------------------------------------------
 // Test properties metadata.
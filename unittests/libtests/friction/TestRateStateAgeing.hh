@@ -44,6 +44,7 @@ class pylith::friction::TestRateStateAgeing : public TestFrictionModel
   CPPUNIT_TEST_SUITE( TestRateStateAgeing );
 
   CPPUNIT_TEST( testLinearSlipRate );
+  CPPUNIT_TEST( testFastMath );
   CPPUNIT_TEST( testPropertiesMetadata );
   CPPUNIT_TEST( testStateVarsMetadata );
   CPPUNIT_TEST( testDBToProperties );
@@ -56,6 +57,7 @@ class pylith::friction::TestRateStateAgeing : public TestFrictionModel
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
   CPPUNIT_TEST( test_updateStateVars );
+  CPPUNIT_TEST( test_batch );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -67,6 +69,9 @@ public :
 
   /// Test cutoff for linear slip rate.
   void testLinearSlipRate(void);
+
+  /// Test fastMath().
+  void testFastMath(void);
   
   /// Test properties metadata.
   void testPropertiesMetadata(void);
@@ -55,6 +55,7 @@ class pylith::friction::TestSlipWeakeningTimeStable : public TestFrictionModel
   CPPUNIT_TEST( test_calcFriction );
   CPPUNIT_TEST( test_calcFrictionDeriv );
   CPPUNIT_TEST( test_updateStateVars );
+  CPPUNIT_TEST( test_batch );
 
   CPPUNIT_TEST_SUITE_END();
 
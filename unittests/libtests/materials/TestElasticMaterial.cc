@@ -31,6 +31,7 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/PowerLawPlaneStrain.hh" // USES PowerLawPlaneStrain
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
 
@@ -38,6 +39,7 @@
 
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -141,17 +143,10 @@ pylith::materials::TestElasticMaterial::testInitialize(void)
   } // for
 
   // Test cell arrays
-  size_t size = data.numLocs*data.numPropsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, material._propertiesCell.size());
-
-  size = data.numLocs*data.numVarsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, material._stateVarsCell.size());
-
-  size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, material._initialStressCell.size());
-
-  size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, material._initialStrainCell.size());
+  size_t size = data.numLocs*tensorSize;
+  CPPUNIT_ASSERT_EQUAL(size, material._zeroTensorCell.size());
+  for (size_t i=0; i < size; ++i)
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), material._zeroTensorCell[i]);
 
   size = data.numLocs;
   CPPUNIT_ASSERT_EQUAL(size, material._densityCell.size());
@@ -202,19 +197,18 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
 
   material.createPropsAndVarsVisitors();
   material.retrievePropsAndVars(cell);
-  material.destroyPropsAndVarsVisitors();
 
   const PylithScalar tolerance = 1.0e-06;
   const int tensorSize = material._tensorSize;
   const int numQuadPts = data.numLocs;
   const int numVarsQuadPt = data.numVarsQuadPt;
 
-  // Test cell arrays
+  // Test cell arrays (views into local arrays of fields)
   const PylithScalar* propertiesE = data.propertiesNondim;
   CPPUNIT_ASSERT(propertiesE);
-  const scalar_array& properties = material._propertiesCell;
+  const PylithScalar* properties = material._propertiesCell;
+  CPPUNIT_ASSERT(properties);
   size_t size = data.numLocs*data.numPropsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, properties.size());
   for (size_t i=0; i < size; ++i)
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i]/propertiesE[i],
 				 tolerance);
@@ -222,31 +216,35 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   const PylithScalar* stateVarsE = data.stateVarsNondim;
   CPPUNIT_ASSERT( (0 < numVarsQuadPt && 0 != stateVarsE) ||
 		  (0 == numVarsQuadPt && 0 == stateVarsE) );
-  const scalar_array& stateVars = material._stateVarsCell;
+  const PylithScalar* stateVars = material._stateVarsCell;
+  CPPUNIT_ASSERT( (0 < numVarsQuadPt && 0 != stateVars) ||
+		  (0 == numVarsQuadPt && 0 == stateVars) );
   size = data.numLocs*numVarsQuadPt;
-  CPPUNIT_ASSERT_EQUAL(size, stateVars.size());
   for (size_t i=0; i < size; ++i)
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVars[i]/stateVarsE[i],
 				 tolerance);
 
   const PylithScalar* initialStressE = data.initialStress;
   CPPUNIT_ASSERT(initialStressE);
-  const scalar_array& initialStress = material._initialStressCell;
+  const PylithScalar* initialStress = material._initialStressCell;
+  CPPUNIT_ASSERT(initialStress);
   size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, initialStress.size());
   for (size_t i=0; i < size; ++i)
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, initialStress[i]/initialStressE[i]*data.pressureScale,
 				 tolerance);
 
   const PylithScalar* initialStrainE = data.initialStrain;
   CPPUNIT_ASSERT(initialStrainE);
-  const scalar_array& initialStrain = material._initialStrainCell;
+  const PylithScalar* initialStrain = material._initialStrainCell;
+  CPPUNIT_ASSERT(initialStrain);
   size = data.numLocs*tensorSize;
-  CPPUNIT_ASSERT_EQUAL(size, initialStrain.size());
   for (size_t i=0; i < size; ++i)
     CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, initialStrain[i]/initialStrainE[i],
 				 tolerance);
 
+  material.destroyPropsAndVarsVisitors();
+  CPPUNIT_ASSERT(!material._propertiesCell);
+
   PYLITH_METHOD_END;
 } // testRetrievePropsAndVars
 
@@ -272,8 +270,8 @@ pylith::materials::TestElasticMaterial::testCalcDensity(void)
 
   material.createPropsAndVarsVisitors();
   material.retrievePropsAndVars(cell);
-  material.destroyPropsAndVarsVisitors();
   const scalar_array& density = material.calcDensity();
+  material.destroyPropsAndVarsVisitors();
 
   const int tensorSize = material._tensorSize;
   const int numQuadPts = data.numLocs;
@@ -317,8 +315,8 @@ pylith::materials::TestElasticMaterial::testCalcStress(void)
 
   material.createPropsAndVarsVisitors();
   material.retrievePropsAndVars(cell);
-  material.destroyPropsAndVarsVisitors();
   const scalar_array& stress = material.calcStress(strain);
+  material.destroyPropsAndVarsVisitors();
 
   const PylithScalar* stressE = data.stress;
   CPPUNIT_ASSERT(stressE);
@@ -359,8 +357,8 @@ pylith::materials::TestElasticMaterial::testCalcDerivElastic(void)
 
   material.createPropsAndVarsVisitors();
   material.retrievePropsAndVars(cell);
-  material.destroyPropsAndVarsVisitors();
   const scalar_array& elasticConsts = material.calcDerivElastic(strain);
+  material.destroyPropsAndVarsVisitors();
 
   int numElasticConsts = 0;
   switch (data.dimension)
@@ -407,6 +405,54 @@ pylith::materials::TestElasticMaterial::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test doubleBufferStateVars(), trialStateVarsCurrent(), and commitStateVars().
+void
+pylith::materials::TestElasticMaterial::testDoubleBufferStateVars(void)
+{ // testDoubleBufferStateVars
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  CPPUNIT_ASSERT(!material.doubleBufferStateVars());
+  material.doubleBufferStateVars(true);
+  CPPUNIT_ASSERT(material.doubleBufferStateVars());
+
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+
+  // Material without state variables has no trial buffer, so there
+  // is never anything to commit.
+  CPPUNIT_ASSERT(!material._stateVarsTpdt);
+  CPPUNIT_ASSERT(!material.commitStateVars());
+  material.trialStateVarsCurrent(true);
+  CPPUNIT_ASSERT(!material.commitStateVars());
+
+  const topology::Field* stateVars = material.stateVarsField();
+  material.trialStateVarsCurrent(false);
+  CPPUNIT_ASSERT(!material.commitStateVars());
+  CPPUNIT_ASSERT(stateVars == material.stateVarsField());
+
+  PYLITH_METHOD_END;
+} // testDoubleBufferStateVars
+
+// ----------------------------------------------------------------------
+// Test stableTimeStepTolerance()
+void
+pylith::materials::TestElasticMaterial::testStableTimeStepTolerance(void)
+{ // testStableTimeStepTolerance
+  PYLITH_METHOD_BEGIN;
+
+  ElasticPlaneStrain material;
+  CPPUNIT_ASSERT(material.stableTimeStepTolerance() < 0.0);
+
+  const PylithScalar value = 1.0e-3;
+  material.stableTimeStepTolerance(value);
+  CPPUNIT_ASSERT_EQUAL(value, material.stableTimeStepTolerance());
+
+  PYLITH_METHOD_END;
+} // testStableTimeStepTolerance
+
 // ----------------------------------------------------------------------
 // Test calcStableTimeStepImplicit()
 void
@@ -439,6 +485,152 @@ pylith::materials::TestElasticMaterial::testStableTimeStepImplicit(void)
   PYLITH_METHOD_END;
 } // testStableTimeStepImplicit
 
+// ----------------------------------------------------------------------
+// Test stableTimeStepImplicit() with incremental updates.
+void
+pylith::materials::TestElasticMaterial::testStableTimeStepIncremental(void)
+{ // testStableTimeStepIncremental
+  PYLITH_METHOD_BEGIN;
+
+  // Use a power-law material, because its stable time step depends on
+  // the state variables.
+  topology::Mesh mesh;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(&mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh.dimension());
+  cs.initialize();
+  mesh.coordsys(&cs);
+
+  spatialdata::units::Nondimensional normalizer;
+  topology::MeshOps::nondimensionalize(&mesh, normalizer);
+
+  // Setup quadrature
+  feassemble::Quadrature quadrature;
+  feassemble::GeometryTri2D geometry;
+  quadrature.refGeometry(&geometry);
+  const int cellDim = 2;
+  const int numCorners = 3;
+  const int numQuadPts = 2;
+  const int spaceDim = 2;
+  const PylithScalar basis[numQuadPts*numCorners] = {
+    1.0/6.0, 1.0/3.0, 1.0/2.0,
+    1.0/6.0, 1.0/2.0, 1.0/3.0,
+  };
+  const PylithScalar basisDeriv[numQuadPts*numCorners*cellDim] = { 
+    -0.5, 0.5,
+    -0.5, 0.0,
+     0.0, 0.5,
+    -0.5, 0.5,
+    -0.5, 0.0,
+     0.0, 0.5,
+  };
+  const PylithScalar quadPtsRef[numQuadPts*spaceDim] = { 
+    -1.0/3.0,        0,
+           0, -1.0/3.0,
+  };
+  const PylithScalar quadWts[numQuadPts] = {
+    1.0, 1.0,
+  };
+  quadrature.initialize(basis, numQuadPts, numCorners,
+			basisDeriv, numQuadPts, numCorners, cellDim,
+			quadPtsRef, numQuadPts, cellDim,
+			quadWts, numQuadPts,
+			spaceDim);
+  quadrature.initializeGeometry();
+
+  spatialdata::spatialdb::UniformDB db("TestElasticMaterial power-law");
+  const int numValues = 6;
+  const char* names[numValues] = {
+    "density",
+    "vs",
+    "vp",
+    "reference-strain-rate",
+    "reference-stress",
+    "power-law-exponent",
+  };
+  const char* units[numValues] = {
+    "kg/m**3",
+    "m/s",
+    "m/s",
+    "1/s",
+    "Pa",
+    "none",
+  };
+  const double values[numValues] = {
+    2500.0,
+    3000.0,
+    5196.15242,
+    1.0e-6,
+    1.0e+6,
+    3.5,
+  };
+  db.setData(names, units, values, numValues);
+
+  const int materialId = 24;
+  PowerLawPlaneStrain material;
+  material.dbProperties(&db);
+  material.id(materialId);
+  material.label("my_material");
+  material.normalizer(normalizer);
+  material.initialize(mesh, &quadrature);
+  CPPUNIT_ASSERT(material.hasStateVars());
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+  CPPUNIT_ASSERT(numCells > 1);
+
+  // Populate cache; stresses are zero, so every cell is unbounded.
+  material.stableTimeStepTolerance(0.0);
+  const PylithScalar dtInitial = material.stableTimeStepImplicit(mesh);
+  CPPUNIT_ASSERT_EQUAL(pylith::PYLITH_MAXSCALAR, dtInitial);
+
+  // Change the stress state variables in the first cell only.
+  const int numVarsQuadPt = 9;
+  const int stress4Offset = 5;
+  const PylithScalar stress4[4] = { 2.0e-3, -1.0e-3, 0.5e-3, 1.0e-3 };
+  const topology::Field* stateVars = material.stateVarsField();CPPUNIT_ASSERT(stateVars);
+  { // write state variables
+    topology::VecVisitorMesh stateVarsVisitor(*stateVars);
+    PetscScalar* stateVarsArray = stateVarsVisitor.localArray();CPPUNIT_ASSERT(stateVarsArray);
+    const PetscInt off = stateVarsVisitor.sectionOffset(cells[0]);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(numQuadPts*numVarsQuadPt), stateVarsVisitor.sectionDof(cells[0]));
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      for (int i=0; i < 4; ++i) {
+	stateVarsArray[off+iQuad*numVarsQuadPt+stress4Offset+i] = stress4[i];
+      } // for
+    } // for
+  } // write state variables
+
+  const PylithScalar dtIncremental = material.stableTimeStepImplicit(mesh);
+  const scalar_array dtCellsIncremental = material._dtStableImplicitCells;
+  CPPUNIT_ASSERT(dtIncremental < pylith::PYLITH_MAXSCALAR);
+
+  // Force a full recompute.
+  material.stableTimeStepTolerance(-1.0);
+  const PylithScalar dtFull = material.stableTimeStepImplicit(mesh);
+  const scalar_array& dtCellsFull = material._dtStableImplicitCells;
+
+  const PylithScalar tolerance = 1.0e-06;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtIncremental/dtFull, tolerance);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numQuadPts), dtCellsFull.size());
+  CPPUNIT_ASSERT_EQUAL(dtCellsFull.size(), dtCellsIncremental.size());
+  for (size_t i=0; i < dtCellsFull.size(); ++i) {
+    if (dtCellsFull[i] < pylith::PYLITH_MAXSCALAR) {
+      CPPUNIT_ASSERT(i < size_t(numQuadPts));
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtCellsIncremental[i]/dtCellsFull[i], tolerance);
+    } else {
+      CPPUNIT_ASSERT_EQUAL(dtCellsFull[i], dtCellsIncremental[i]);
+    } // if/else
+  } // for
+
+  PYLITH_METHOD_END;
+} // testStableTimeStepIncremental
+
 // ----------------------------------------------------------------------
 // Test calcStableTimeStepExplicit()
 void
@@ -501,6 +693,11 @@ pylith::materials::TestElasticMaterial::testStableTimeStepExplicit(void)
   const PylithScalar dtE = 2.0*1.757359312880716 / 5196.15242;
   CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dt/dtE, tolerance);
 
+  // Second query uses cached value.
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numQuadPts), material._dtStableExplicitCells.size());
+  const PylithScalar dtCached = material.stableTimeStepExplicit(mesh, &quadrature);
+  CPPUNIT_ASSERT_EQUAL(dt, dtCached);
+
   PYLITH_METHOD_END;
 } // testStableTimeStepExplicit
 
@@ -55,7 +55,10 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testCalcStress );
   CPPUNIT_TEST( testCalcDerivElastic );
   CPPUNIT_TEST( testUpdateStateVars );
+  CPPUNIT_TEST( testDoubleBufferStateVars );
+  CPPUNIT_TEST( testStableTimeStepTolerance );
   CPPUNIT_TEST( testStableTimeStepImplicit );
+  CPPUNIT_TEST( testStableTimeStepIncremental );
   CPPUNIT_TEST( testStableTimeStepExplicit );
 
   CPPUNIT_TEST_SUITE_END();
@@ -87,9 +90,18 @@ public :
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /// Test doubleBufferStateVars(), trialStateVarsCurrent(), and commitStateVars().
+  void testDoubleBufferStateVars(void);
+
+  /// Test stableTimeStepTolerance().
+  void testStableTimeStepTolerance(void);
+
   /// Test stableTimeStepImplicit().
   void testStableTimeStepImplicit(void);
 
+  /// Test stableTimeStepImplicit() with incremental updates.
+  void testStableTimeStepIncremental(void);
+
   /// Test stableTimeStepExplicit().
   void testStableTimeStepExplicit(void);
 
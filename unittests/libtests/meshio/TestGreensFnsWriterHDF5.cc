@@ -0,0 +1,164 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestGreensFnsWriterHDF5.hh" // Implementation of class methods
+
+#include "pylith/meshio/GreensFnsWriterHDF5.hh" // USES GreensFnsWriterHDF5
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <string> // USES std::string
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestGreensFnsWriterHDF5 );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::meshio::TestGreensFnsWriterHDF5::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  GreensFnsWriterHDF5 writer;
+  CPPUNIT_ASSERT(!writer._h5);
+  CPPUNIT_ASSERT_EQUAL(6, writer._compression);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test filename() and compression().
+void
+pylith::meshio::TestGreensFnsWriterHDF5::testAccessors(void)
+{ // testAccessors
+  PYLITH_METHOD_BEGIN;
+
+  GreensFnsWriterHDF5 writer;
+
+  const std::string filename = "greensfns_test.h5";
+  writer.filename(filename.c_str());
+  CPPUNIT_ASSERT_EQUAL(filename, std::string(writer.filename()));
+
+  writer.compression(0);
+  CPPUNIT_ASSERT_EQUAL(0, writer._compression);
+  writer.compression(9);
+  CPPUNIT_ASSERT_EQUAL(9, writer._compression);
+  CPPUNIT_ASSERT_THROW(writer.compression(10), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testAccessors
+
+// ----------------------------------------------------------------------
+// Test open(), writePoints(), writeImpulses(), writeResponse(), and close().
+void
+pylith::meshio::TestGreensFnsWriterHDF5::testWrite(void)
+{ // testWrite
+  PYLITH_METHOD_BEGIN;
+
+  const int numImpulses = 3;
+  const int numPoints = 2;
+  const int numComponents = 2;
+  const int spaceDim = 2;
+
+  const PylithScalar points[numPoints*spaceDim] = {
+    1.0, 2.0,
+    -3.0, 4.0,
+  };
+  const char* names[numPoints] = { "AA", "BB" };
+  const PylithScalar coordinates[numImpulses*spaceDim] = {
+    0.0, -1.0,
+    0.0, -1.0,
+    0.0, -2.0,
+  };
+  const int vertices[numImpulses] = { 0, 0, 1 };
+  const int components[numImpulses] = { 0, 1, 0 };
+  const PylithScalar amplitudes[numImpulses] = { 1.5, 1.5, 2.5 };
+  const PylithScalar responses[numImpulses*numPoints*numComponents] = {
+    1.1, 1.2,  1.3, 1.4,
+    2.1, 2.2,  2.3, 2.4,
+    3.1, 3.2,  3.3, 3.4,
+  };
+
+  const char* filename = "greensfns_test.h5";
+  GreensFnsWriterHDF5 writer;
+  writer.filename(filename);
+  writer.compression(4);
+  writer.open(numImpulses, numPoints, numComponents);
+  writer.writePoints(points, numPoints, spaceDim, names, numPoints);
+  writer.writeImpulses(coordinates, numImpulses, spaceDim, vertices, numImpulses,
+		       components, numImpulses, amplitudes, numImpulses);
+  // Write responses out of order.
+  const int order[numImpulses] = { 2, 0, 1 };
+  const int sizeResponse = numPoints*numComponents;
+  for (int i=0; i < numImpulses; ++i) {
+    writer.writeResponse(order[i], &responses[order[i]*sizeResponse], numPoints, numComponents);
+  } // for
+  CPPUNIT_ASSERT_THROW(writer.writeResponse(numImpulses, responses, numPoints, numComponents), std::out_of_range);
+  writer.close();
+
+  // Check file.
+  HDF5 h5(filename, H5F_ACC_RDONLY);
+  CPPUNIT_ASSERT(h5.hasDataset("/responses"));
+  CPPUNIT_ASSERT(h5.hasDataset("/points/coordinates"));
+  CPPUNIT_ASSERT(h5.hasDataset("/points/names"));
+  CPPUNIT_ASSERT(h5.hasDataset("/impulses/coordinates"));
+  CPPUNIT_ASSERT(h5.hasDataset("/impulses/vertex"));
+  CPPUNIT_ASSERT(h5.hasDataset("/impulses/component"));
+  CPPUNIT_ASSERT(h5.hasDataset("/impulses/amplitude"));
+
+  hsize_t* dims = 0;
+  int ndims = 0;
+  h5.getDatasetDims(&dims, &ndims, "/", "responses");
+  CPPUNIT_ASSERT_EQUAL(3, ndims);
+  CPPUNIT_ASSERT_EQUAL(hsize_t(numImpulses), dims[0]);
+  CPPUNIT_ASSERT_EQUAL(hsize_t(numPoints), dims[1]);
+  CPPUNIT_ASSERT_EQUAL(hsize_t(numComponents), dims[2]);
+  delete[] dims; dims = 0;
+
+  const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+  const double tolerance = 1.0e-6;
+  for (int iImpulse=0; iImpulse < numImpulses; ++iImpulse) {
+    char* data = 0;
+    h5.readDatasetChunk("/", "responses", &data, &dims, &ndims, iImpulse, scalartype);
+    CPPUNIT_ASSERT_EQUAL(3, ndims);
+    CPPUNIT_ASSERT_EQUAL(hsize_t(1), dims[0]);
+    const PylithScalar* values = (const PylithScalar*)data;
+    for (int i=0; i < sizeResponse; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(responses[iImpulse*sizeResponse+i], values[i], tolerance);
+    } // for
+    delete[] data; data = 0;
+    delete[] dims; dims = 0;
+  } // for
+
+  const pylith::string_vector namesFile = h5.readDataset("/points", "names");
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), namesFile.size());
+  for (int i=0; i < numPoints; ++i) {
+    CPPUNIT_ASSERT_EQUAL(std::string(names[i]), namesFile[i]);
+  } // for
+
+  h5.close();
+
+  PYLITH_METHOD_END;
+} // testWrite
+
+
+// End of file 
@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestGreensFnsWriterHDF5.hh
+ *
+ * @brief C++ TestGreensFnsWriterHDF5 object
+ *
+ * C++ unit testing for GreensFnsWriterHDF5.
+ */
+
+#if !defined(pylith_meshio_testgreensfnswriterhdf5_hh)
+#define pylith_meshio_testgreensfnswriterhdf5_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestGreensFnsWriterHDF5;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for GreensFnsWriterHDF5
+class pylith::meshio::TestGreensFnsWriterHDF5 : public CppUnit::TestFixture
+{ // class TestGreensFnsWriterHDF5
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestGreensFnsWriterHDF5 );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testAccessors );
+  CPPUNIT_TEST( testWrite );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test filename() and compression().
+  void testAccessors(void);
+
+  /// Test open(), writePoints(), writeImpulses(), writeResponse(), and close().
+  void testWrite(void);
+
+}; // class TestGreensFnsWriterHDF5
+
+#endif // pylith_meshio_testgreensfnswriterhdf5_hh
+
+// End of file 
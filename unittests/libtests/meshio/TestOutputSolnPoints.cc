@@ -87,6 +87,21 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateTri3(void)
 } // testInterpolateTri3
 
 
+// ----------------------------------------------------------------------
+// Test addPointForce() for tri3 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAddPointForceTri3(void)
+{ // testAddPointForceTri3
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTri3 data;
+
+    _testAddPointForce(data);
+
+    PYLITH_METHOD_END;
+} // testAddPointForceTri3
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for quad4 mesh.
 void
@@ -119,6 +134,21 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateQuad4(void)
 } // testInterpolateQuad4
 
 
+// ----------------------------------------------------------------------
+// Test addPointForce() for quad4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAddPointForceQuad4(void)
+{ // testAddPointForceQuad4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataQuad4 data;
+
+    _testAddPointForce(data);
+
+    PYLITH_METHOD_END;
+} // testAddPointForceQuad4
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for tet4 mesh.
 void
@@ -151,6 +181,21 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateTet4(void)
 } // testInterpolateTet4
 
 
+// ----------------------------------------------------------------------
+// Test addPointForce() for tet4 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAddPointForceTet4(void)
+{ // testAddPointForceTet4
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataTet4 data;
+
+    _testAddPointForce(data);
+
+    PYLITH_METHOD_END;
+} // testAddPointForceTet4
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for hex8 mesh.
 void
@@ -183,6 +228,21 @@ pylith::meshio::TestOutputSolnPoints::testInterpolateHex8(void)
 } // testInterpolateHex8
 
 
+// ----------------------------------------------------------------------
+// Test addPointForce() for hex8 mesh.
+void
+pylith::meshio::TestOutputSolnPoints::testAddPointForceHex8(void)
+{ // testAddPointForceHex8
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPointsDataHex8 data;
+
+    _testAddPointForce(data);
+
+    PYLITH_METHOD_END;
+} // testAddPointForceHex8
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator().
 void
@@ -339,6 +399,94 @@ pylith::meshio::TestOutputSolnPoints::_testInterpolate(const OutputSolnPointsDat
 } // _testInterpolate
 
 
+// ----------------------------------------------------------------------
+// Test addPointForce().
+void
+pylith::meshio::TestOutputSolnPoints::_testAddPointForce(const OutputSolnPointsData& data)
+{ // _testAddPointForce
+    PYLITH_METHOD_BEGIN;
+
+    const int numPoints = data.numPoints;
+    const int spaceDim = data.spaceDim;
+
+    topology::Mesh mesh;
+    spatialdata::geocoords::CSCart cs;
+    spatialdata::units::Nondimensional normalizer;
+
+    cs.setSpaceDim(spaceDim);
+    cs.initialize();
+    mesh.coordsys(&cs);
+    MeshIOCubit iohandler;
+    iohandler.filename(data.meshFilename);
+    iohandler.read(&mesh);
+
+    OutputSolnPoints output;
+    CPPUNIT_ASSERT(data.points);
+    output.setupInterpolator(&mesh, data.points, numPoints, spaceDim, data.names, numPoints, normalizer);
+
+    // Create field with data.
+    const int fiberDim = data.fiberDim;
+    pylith::topology::Field field(mesh);
+    field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
+    field.allocate();
+    field.label("data_field");
+    field.zeroAll();
+    this->_calcField(&field, data);
+
+    pylith::topology::Field force(mesh);
+    force.cloneSection(field);
+    force.allocate();
+    force.label("force");
+
+    topology::Stratum verticesStratum(mesh.dmMesh(), topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+
+    // Point force is the transpose of interpolation, so the work done
+    // by the force on the field is the interpolated value of the field.
+    const int component = fiberDim-1;
+    const double tolerance = 1.0e-6;
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+	force.zeroAll();
+	output.addPointForce(&force, iPoint, component, 1.0);
+
+	topology::VecVisitorMesh fieldVisitor(field);
+	const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+	topology::VecVisitorMesh forceVisitor(force);
+	const PetscScalar* forceArray = forceVisitor.localArray();CPPUNIT_ASSERT(forceArray);
+
+	PylithScalar work = 0.0;
+	PylithScalar forceSum = 0.0;
+	for (PetscInt v = vStart; v < vEnd; ++v) {
+	    const PetscInt off = forceVisitor.sectionOffset(v);
+	    CPPUNIT_ASSERT_EQUAL(fiberDim, forceVisitor.sectionDof(v));
+	    CPPUNIT_ASSERT_EQUAL(off, fieldVisitor.sectionOffset(v));
+	    for (PetscInt d = 0; d < fiberDim; ++d) {
+		work += forceArray[off+d]*fieldArray[off+d];
+		if (d == component) {
+		    forceSum += forceArray[off+d];
+		} else {
+		    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, forceArray[off+d], tolerance);
+		} // if/else
+	    } // for
+	} // for
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, forceSum, tolerance);
+
+	PylithScalar workE = 0.0;
+	for (int iDim=0; iDim < spaceDim; ++iDim) {
+	    workE += data.coefs[component*spaceDim+iDim]*data.points[iPoint*spaceDim+iDim];
+	} // for
+	if (fabs(workE) > 1.0) {
+	    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, work / workE, tolerance);
+	} else {
+	    CPPUNIT_ASSERT_DOUBLES_EQUAL(workE, work, tolerance);
+	} // if/else
+    } // for
+
+    PYLITH_METHOD_END;
+} // _testAddPointForce
+
+
 // ----------------------------------------------------------------------
 void
 pylith::meshio::TestOutputSolnPoints::_calcField(pylith::topology::Field* field,
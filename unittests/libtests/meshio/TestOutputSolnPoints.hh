@@ -51,15 +51,19 @@ class pylith::meshio::TestOutputSolnPoints : public CppUnit::TestFixture
     
     CPPUNIT_TEST( testSetupInterpolatorTri3 );
     CPPUNIT_TEST( testInterpolateTri3 );
+    CPPUNIT_TEST( testAddPointForceTri3 );
 
     CPPUNIT_TEST( testSetupInterpolatorQuad4 );
     CPPUNIT_TEST( testInterpolateQuad4 );
+    CPPUNIT_TEST( testAddPointForceQuad4 );
 
     CPPUNIT_TEST( testSetupInterpolatorTet4 );
     CPPUNIT_TEST( testInterpolateTet4 );
+    CPPUNIT_TEST( testAddPointForceTet4 );
 
     CPPUNIT_TEST( testSetupInterpolatorHex8 );
     CPPUNIT_TEST( testInterpolateHex8 );
+    CPPUNIT_TEST( testAddPointForceHex8 );
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -75,24 +79,36 @@ public :
   /// Test interpolation for tri3 mesh.
   void testInterpolateTri3(void);
 
+  /// Test addPointForce() for tri3 mesh.
+  void testAddPointForceTri3(void);
+
   /// Test setupInterpolator for quad4 mesh.
   void testSetupInterpolatorQuad4(void);
 
   /// Test interpolation for quad4 mesh.
   void testInterpolateQuad4(void);
 
+  /// Test addPointForce() for quad4 mesh.
+  void testAddPointForceQuad4(void);
+
   /// Test setupInterpolator for tet4 mesh.
   void testSetupInterpolatorTet4(void);
 
   /// Test interpolation for tet4 mesh.
   void testInterpolateTet4(void);
 
+  /// Test addPointForce() for tet4 mesh.
+  void testAddPointForceTet4(void);
+
   /// Test setupInterpolator for hex8 mesh.
   void testSetupInterpolatorHex8(void);
 
   /// Test interpolation for hex8 mesh.
   void testInterpolateHex8(void);
 
+  /// Test addPointForce() for hex8 mesh.
+  void testAddPointForceHex8(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -108,6 +124,12 @@ private :
    */
   void _testInterpolate(const OutputSolnPointsData& data);
 
+  /** Test addPointForce().
+   *
+   * @param data Test data.
+   */
+  void _testAddPointForce(const OutputSolnPointsData& data);
+
   /** Compute values of field at vertices in mesh.
    *
    * @param field Field to hold values.
@@ -0,0 +1,214 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestParameterCache.hh" // Implementation of class methods
+
+#include "pylith/meshio/ParameterCache.hh" // USES ParameterCache
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestParameterCache );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::meshio::TestParameterCache::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  ParameterCache cache;
+  CPPUNIT_ASSERT_EQUAL(std::string(""), cache._dbKey);
+  CPPUNIT_ASSERT_EQUAL(0, cache._rank);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test filename().
+void
+pylith::meshio::TestParameterCache::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  const std::string filename = "cache_material";
+
+  ParameterCache cache;
+  cache.filename(filename.c_str());
+  CPPUNIT_ASSERT_EQUAL(filename, std::string(cache.filename()));
+  CPPUNIT_ASSERT_EQUAL(std::string("cache_material_p0.h5"), cache._filenameLocal());
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test dbKey(), resetKey(), hashMesh(), hashNormalizer(), and key().
+void
+pylith::meshio::TestParameterCache::testKey(void)
+{ // testKey
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  std::vector<PetscInt> cells;
+  for (PetscInt c = cellsStratum.begin(); c < cellsStratum.end(); ++c) {
+    cells.push_back(c);
+  } // for
+  CPPUNIT_ASSERT(cells.size() > 1);
+
+  spatialdata::units::Nondimensional normalizer;
+
+  ParameterCache cacheA;
+  cacheA.dbKey("abc");
+  cacheA.hashMesh(mesh, &cells[0], cells.size());
+  cacheA.hashNormalizer(normalizer);
+
+  ParameterCache cacheB;
+  cacheB.dbKey("abc");
+  cacheB.hashMesh(mesh, &cells[0], cells.size());
+  cacheB.hashNormalizer(normalizer);
+  CPPUNIT_ASSERT_EQUAL(16, int(cacheA.key().length()));
+  CPPUNIT_ASSERT_EQUAL(cacheA.key(), cacheB.key());
+
+  // Different user key.
+  cacheB.dbKey("abd");
+  CPPUNIT_ASSERT(cacheA.key() != cacheB.key());
+
+  // Different subset of mesh.
+  ParameterCache cacheC;
+  cacheC.dbKey("abc");
+  cacheC.hashMesh(mesh, &cells[0], cells.size()-1);
+  cacheC.hashNormalizer(normalizer);
+  CPPUNIT_ASSERT(cacheA.key() != cacheC.key());
+
+  // Different scales.
+  spatialdata::units::Nondimensional normalizerD;
+  normalizerD.lengthScale(2.0);
+  ParameterCache cacheD;
+  cacheD.dbKey("abc");
+  cacheD.hashMesh(mesh, &cells[0], cells.size());
+  cacheD.hashNormalizer(normalizerD);
+  CPPUNIT_ASSERT(cacheA.key() != cacheD.key());
+
+  // Computing the key again after resetKey() gives the same key.
+  cacheD.resetKey();
+  cacheD.hashMesh(mesh, &cells[0], cells.size());
+  cacheD.hashNormalizer(normalizer);
+  CPPUNIT_ASSERT_EQUAL(cacheA.key(), cacheD.key());
+
+  PYLITH_METHOD_END;
+} // testKey
+
+// ----------------------------------------------------------------------
+// Test write() and read().
+void
+pylith::meshio::TestParameterCache::testWriteRead(void)
+{ // testWriteRead
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 2;
+  const PylithScalar fieldValues[] = {
+    1.1, 1.2,
+    2.1, 2.2,
+    3.1, 3.2,
+    4.1, 4.2
+  };
+  const PylithScalar tolerance = 1.0e-6;
+
+  topology::Mesh mesh;
+  MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  std::vector<PetscInt> vertices;
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    vertices.push_back(v);
+  } // for
+
+  topology::Field field(mesh);
+  field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
+  field.allocate();
+  field.label("field");
+  { // setup field
+    topology::VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+    for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for (PetscInt d = 0; d < fiberDim; ++d, ++index) {
+	fieldArray[off+d] = fieldValues[index];
+      } // for
+    } // for
+  } // setup field
+
+  const char* filename = "parameter_cache";
+  ParameterCache cache;
+  cache.filename(filename);
+  cache.dbKey("abc");
+  cache.hashMesh(mesh, &vertices[0], vertices.size());
+
+  topology::Field fieldCache(mesh);
+  fieldCache.newSection(field, fiberDim);
+  fieldCache.allocate();
+
+  // File with a different key is ignored and replaced.
+  ParameterCache cacheOther;
+  cacheOther.filename(filename);
+  cacheOther.dbKey("xyz");
+  cacheOther.write(field, "field");
+  CPPUNIT_ASSERT(!cache.read(&fieldCache, "field"));
+
+  cache.write(field, "field");
+  CPPUNIT_ASSERT(!cache.read(&fieldCache, "missing"));
+  CPPUNIT_ASSERT(cache.read(&fieldCache, "field"));
+
+  topology::VecVisitorMesh cacheVisitor(fieldCache);
+  const PetscScalar* cacheArray = cacheVisitor.localArray();CPPUNIT_ASSERT(cacheArray);
+  for (PetscInt v = vStart, index = 0; v < vEnd; ++v) {
+    const PetscInt off = cacheVisitor.sectionOffset(v);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, cacheVisitor.sectionDof(v));
+    for (PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cacheArray[off+d]/fieldValues[index], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testWriteRead
+
+
+// End of file 
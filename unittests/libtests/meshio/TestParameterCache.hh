@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestParameterCache.hh
+ *
+ * @brief C++ TestParameterCache object
+ *
+ * C++ unit testing for ParameterCache.
+ */
+
+#if !defined(pylith_meshio_testparametercache_hh)
+#define pylith_meshio_testparametercache_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestParameterCache;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for ParameterCache
+class pylith::meshio::TestParameterCache : public CppUnit::TestFixture
+{ // class TestParameterCache
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestParameterCache );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testKey );
+  CPPUNIT_TEST( testWriteRead );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test filename().
+  void testFilename(void);
+
+  /// Test dbKey(), resetKey(), hashMesh(), hashNormalizer(), and key().
+  void testKey(void);
+
+  /// Test write() and read().
+  void testWriteRead(void);
+
+}; // class TestParameterCache
+
+#endif // pylith_meshio_testparametercache_hh
+
+// End of file 